@@ -8,10 +8,20 @@ const cfg = {
   help: args.includes("--help"),
   extensions: args.includes("--extensions"),
   freetype: args.includes("--freetype"),
+  node: args.includes("--node"),
+  split: args.includes("--split"),
+  wasm: args.includes("--wasm"),
+  simd: args.includes("--simd"),
+  pthread: args.includes("--pthread"),
+  instrument: args.includes("--instrument"),
+  profile: args.find((arg) => arg.startsWith("--profile="))?.split("=")[1] ?? "size",
   generateData: args.includes("--generate-data"),
 };
 
-const HELP = "Usage: node|bun|deno build.ts [--extensions] [--freetype]\n";
+const HELP =
+  "Usage: node|bun|deno build.ts [--extensions] [--freetype] [--node] [--split] [--wasm] [--simd]\n" +
+  "                              [--pthread] [--instrument]\n" +
+  "                              [--profile=size|speed|balanced|debug]\n";
 
 if (cfg.help) {
   stdout.write(HELP);
@@ -73,8 +83,8 @@ const emccConfig = {
     "--cache=./.em_cache",
     "-std=c++26",
     "-lembind",
-    `-sEXPORTED_RUNTIME_METHODS=FS,MEMFS,GL,WebGPU`,
-    "-sENVIRONMENT=web",
+    `-sEXPORTED_RUNTIME_METHODS=FS,MEMFS,GL,WebGPU,HEAPU8`,
+    "-sENVIRONMENT=web,worker",
     "-sWASM_BIGINT",
     "-sMIN_WEBGL_VERSION=1",
     "-sMAX_WEBGL_VERSION=2",
@@ -83,14 +93,40 @@ const emccConfig = {
     "-sSINGLE_FILE",
     "-sEXPORT_ES6=1",
     "-DIMGUI_DISABLE_OBSOLETE_FUNCTIONS=1",
-    "-Oz",
-    "-flto",
     "-sMALLOC=emmalloc",
     "-sALLOW_MEMORY_GROWTH=1",
-    "-sASSERTIONS=1",
   ],
 };
 
+// Optimization flags of the build profiles. `glue` applies to the bindings and the link, `core`
+// (if set) to the Dear ImGui sources which are then compiled separately without LTO. `link` (if
+// set) replaces `glue` for the link, so wasm-opt doesn't shrink the -O3 objects back down, and the
+// bindings are compiled separately as well.
+// - size: Smallest download, the default for releases.
+// - speed: Faster widget and draw loops for a bigger WASM.
+// - balanced: Dear ImGui at -O3, the mostly call-forwarding bindings at -Oz.
+// - debug: Runtime assertions and debug info.
+const profiles: Record<string, { glue: string[]; core?: string[]; link?: string[] }> = {
+  size: { glue: ["-Oz", "-flto", "-sASSERTIONS=0"] },
+  speed: { glue: ["-O3", "-flto", "-sASSERTIONS=0"] },
+  balanced: { glue: ["-Oz"], core: ["-O3"], link: ["-O3", "-sASSERTIONS=0"] },
+  debug: { glue: ["-O0", "-g", "-sASSERTIONS=2"] },
+};
+
+const profile = profiles[cfg.profile];
+if (!profile) {
+  stdout.write(`Unknown profile: ${cfg.profile}\n${HELP}`);
+  exit(1);
+}
+
+emccConfig.flags.push(...(profile.link ?? profile.glue));
+
+// Enables the SIMD string scan of TextFilterIndex. Mod.init() falls back to the scalar loader on
+// engines without WASM SIMD.
+if (cfg.simd) {
+  emccConfig.flags.push("-msimd128");
+}
+
 if (cfg.freetype) {
   emccConfig.sources.push("third_party/imgui/misc/freetype/imgui_freetype.cpp");
   emccConfig.flags.push("-sUSE_FREETYPE=1");
@@ -98,12 +134,144 @@ if (cfg.freetype) {
   emccConfig.flags.push("-DIMGUI_ENABLE_FREETYPE=1");
 }
 
-if (cfg.extensions) {
+if (cfg.extensions && !cfg.split) {
   emccConfig.sources.push("third_party/imnodes/imnodes.cpp");
   emccConfig.includes.push("third_party/imnodes/");
 }
 
-const outPath = `build/loader${cfg.extensions ? "-extensions" : ""}${cfg.freetype ? "-freetype" : ""}.js`;
+// A standalone .wasm is compiled while it downloads (instantiateStreaming) and is a third smaller
+// than the base64 data URL. Node can't load the WASM embedded as data URL at all.
+if (cfg.wasm || cfg.node || cfg.split) {
+  emccConfig.flags = emccConfig.flags.filter((flag) => flag !== "-sSINGLE_FILE");
+}
+
+if (cfg.node) {
+  emccConfig.flags = emccConfig.flags.map((flag) =>
+    flag === "-sENVIRONMENT=web,worker" ? "-sENVIRONMENT=node,web,worker" : flag,
+  );
+}
+
+// Heap allocation counting replaces the global allocator, only for benchmarks and profiling.
+if (cfg.instrument) {
+  emccConfig.flags.push("-DJSIMGUI_INSTRUMENT=1");
+}
+
+// Shared WASM memory for the async sorts of TableSorter. The pooled thread starts them without
+// waiting for a new worker. ImGuiImplWeb.InitInWorker() doesn't need it, every loader runs in
+// workers.
+if (cfg.pthread) {
+  emccConfig.flags.push("-pthread", "-sPTHREAD_POOL_SIZE=1");
+}
+
+const outName = `loader${cfg.extensions && !cfg.split ? "-extensions" : ""}${cfg.freetype ? "-freetype" : ""}${cfg.split ? "-split" : ""}${cfg.simd ? "-simd" : ""}${cfg.pthread ? "-pthread" : ""}${cfg.wasm && !cfg.split && !cfg.node ? "-wasm" : ""}${cfg.node ? "-node" : ""}`;
+
+// Code which only some pages run is built as side modules of the split build, loaded at runtime
+// by Mod.loadModules() for the chosen backend and options. They are compiled with the ABI flags
+// of the variant, so each variant gets its own directory.
+const sideDir = `build/side/${outName}`;
+const sideModules: Record<string, { sources: string[]; includes?: string[]; flags?: string[] }> = {
+  demo: { sources: ["third_party/imgui/imgui_demo.cpp"] },
+  opengl3: {
+    sources: [
+      "src/imgui/data/dcimgui_impl_opengl3_fix.cpp",
+      "third_party/imgui/backends/imgui_impl_opengl3.cpp",
+    ],
+  },
+  wgpu: {
+    sources: [
+      "src/imgui/data/dcimgui_impl_wgpu_fix.cpp",
+      "third_party/imgui/backends/imgui_impl_wgpu.cpp",
+    ],
+    flags: ["--use-port=emdawnwebgpu"],
+  },
+  imnodes: { sources: ["third_party/imnodes/imnodes.cpp"], includes: ["third_party/imnodes/"] },
+};
+
+const sideModuleCmds: string[] = [];
+
+if (cfg.split) {
+  // Nothing calls the C wrappers of the internal API, the split build leaves them out.
+  const split = [
+    ...Object.values(sideModules).flatMap((module) => module.sources),
+    "src/imgui/data/dcimgui_internal.cpp",
+  ];
+  emccConfig.sources = emccConfig.sources.filter((source) => !split.includes(source));
+
+  // MAIN_MODULE=1 keeps all of libc and the JS libraries (GL, WebGPU) the side modules import.
+  // The calls from the bindings into side modules are resolved when the module is loaded.
+  emccConfig.flags = emccConfig.flags.map((flag) =>
+    flag.startsWith("-sEXPORTED_RUNTIME_METHODS=") ? `${flag},loadDynamicLibrary` : flag,
+  );
+  emccConfig.flags.push("-sMAIN_MODULE=1", "-sERROR_ON_UNDEFINED_SYMBOLS=0");
+
+  // Everything changing the ABI of Dear ImGui has to match the main module.
+  const sharedFlags = emccConfig.flags.filter(
+    (flag) =>
+      flag.startsWith("-D") ||
+      flag.startsWith("--cache") ||
+      flag.startsWith("-std") ||
+      flag === "-msimd128" ||
+      flag === "-pthread",
+  );
+
+  for (const [name, module] of Object.entries(sideModules)) {
+    sideModuleCmds.push(
+      [
+        "emcc",
+        ...module.sources,
+        ...[...emccConfig.includes, ...(module.includes ?? [])].map((i) => `-I${i}`),
+        ...sharedFlags,
+        ...(module.flags ?? []),
+        profile.glue[0],
+        "-sSIDE_MODULE=1",
+        "-o",
+        `${sideDir}/${name}.wasm`,
+      ].join(" "),
+    );
+  }
+}
+
+// Flags which affect compiling (headers, defines, ABI), shared by all objects of the module.
+const compileFlags = emccConfig.flags.filter(
+  (flag) =>
+    flag.startsWith("-D") ||
+    flag.startsWith("-std") ||
+    flag.startsWith("--cache") ||
+    flag.startsWith("--use-port") ||
+    flag.startsWith("-sUSE_FREETYPE") ||
+    flag === "-msimd128" ||
+    flag === "-pthread",
+);
+
+const objectCmds: string[] = [];
+
+if (profile.core) {
+  const isCore = (source: string) => source.startsWith("third_party/");
+  const sources = emccConfig.sources.filter(
+    (source) => isCore(source) || profile.link !== undefined,
+  );
+  emccConfig.sources = emccConfig.sources.filter((source) => !sources.includes(source));
+
+  for (const source of sources) {
+    const object = `build/obj/${source.replaceAll("/", "_").replace(/\.cpp$/, ".o")}`;
+    const optimization = isCore(source) ? profile.core : profile.glue;
+    objectCmds.push(
+      [
+        "emcc",
+        "-c",
+        source,
+        ...emccConfig.includes.map((i) => `-I${i}`),
+        ...compileFlags,
+        ...optimization,
+        "-o",
+        object,
+      ].join(" "),
+    );
+    emccConfig.sources.push(object);
+  }
+}
+
+const outPath = `build/${outName}.js`;
 const cmd = [
   "emcc",
   ...emccConfig.sources,
@@ -114,12 +282,27 @@ const cmd = [
 ].join(" ");
 
 stdout.write("Generating Bindings...\n");
-generateImGuiBindings();
+generateImGuiBindings(cfg.instrument);
 
 stdout.write("Compiling WASM...\n");
 mkdirSync("build/", { recursive: true });
+
+if (objectCmds.length > 0) {
+  mkdirSync("build/obj/", { recursive: true });
+  for (const objectCmd of objectCmds) {
+    stdout.write(execSync(objectCmd).toString());
+  }
+}
 stdout.write(execSync(cmd).toString());
 
+if (cfg.split) {
+  stdout.write("Compiling Side Modules...\n");
+  mkdirSync(sideDir, { recursive: true });
+  for (const sideModuleCmd of sideModuleCmds) {
+    stdout.write(execSync(sideModuleCmd).toString());
+  }
+}
+
 stdout.write("Compiling TS...\n");
 stdout.write(execSync("node_modules/.bin/tsgo --project src/tsconfig.build.json").toString());
 
@@ -130,6 +313,12 @@ stdout.write("Done.\n");
 
 stdout.write("Output:\n");
 const outputFiles = ["build/imgui.d.ts", "build/imgui.js", `${outPath}`];
+if (cfg.node || cfg.split || cfg.wasm) {
+  outputFiles.push(`build/${outName}.wasm`);
+}
+if (cfg.split) {
+  outputFiles.push(...Object.keys(sideModules).map((name) => `${sideDir}/${name}.wasm`));
+}
 for (const file of outputFiles) {
   const stats = statSync(file);
   const size = (stats.size / 1024).toFixed(1);
@@ -57,4 +57,8 @@ export interface GeneratorConfig {
 
 export interface GeneratorContext {
   config: GeneratorConfig;
+  /**
+   * Wrap each generated binding with a call counter and timer, see `GetBindingStats()`.
+   */
+  instrument?: boolean;
 }
@@ -1,5 +1,5 @@
 import type { GeneratorContext } from "./config.ts";
-import type { FunctionBinding } from "./function.ts";
+import { type FunctionBinding, hasInternedBinding, hasViewBinding } from "./function.ts";
 
 const POINTER_MAP = new Map<string, string>([
   ["bool*", "bool"],
@@ -32,6 +32,11 @@ function getPreProcess(function_: FunctionBinding): string {
         return "";
       }
 
+      // Read-only pointers without bounds are arrays of arbitrary length (e.g. plot values).
+      if (arg.type.startsWith("const ") && !arg.arrayBounds) {
+        return `    auto param_${arg.name} = get_vector_param<${type}>(${arg.name});\n`;
+      }
+
       const size = arg.arrayBounds ?? 1;
 
       return `    auto param_${arg.name} = get_array_param<${type}, ${size}>(${arg.name});\n`;
@@ -43,7 +48,7 @@ function getPreProcess(function_: FunctionBinding): string {
 function getPostprocess(function_: FunctionBinding): string {
   return function_.arguments
     .map((arg) => {
-      if (isPrimitivePointer(arg.type)) {
+      if (isPrimitivePointer(arg.type) && !arg.type.startsWith("const ")) {
         return `    write_back_array_param(param_${arg.name}, ${arg.name});\n`;
       }
       return "";
@@ -52,7 +57,7 @@ function getPostprocess(function_: FunctionBinding): string {
     .join("");
 }
 
-function getArguments(function_: FunctionBinding): string {
+function getArguments(function_: FunctionBinding, interned = false): string {
   return function_.arguments
     .map((arg) => {
       if (isPrimitivePointer(arg.type)) {
@@ -60,7 +65,7 @@ function getArguments(function_: FunctionBinding): string {
       }
 
       if (arg.type === "const char*") {
-        return `${arg.name}.c_str()`;
+        return interned ? `get_interned_string(${arg.name})` : `${arg.name}.c_str()`;
       }
 
       return arg.name;
@@ -68,11 +73,11 @@ function getArguments(function_: FunctionBinding): string {
     .join(", ");
 }
 
-function getParameters(function_: FunctionBinding): string {
+function getParameters(function_: FunctionBinding, interned = false): string {
   return function_.arguments
     .map((arg) => {
       if (arg.type === "const char*") {
-        return `std::string ${arg.name}`;
+        return interned ? `int ${arg.name}` : `std::string ${arg.name}`;
       }
 
       if (isPrimitivePointer(arg.type)) {
@@ -84,6 +89,95 @@ function getParameters(function_: FunctionBinding): string {
     .join(", ");
 }
 
+function getViewArguments(function_: FunctionBinding, interned: boolean): string {
+  return function_.arguments
+    .map((arg) => {
+      const type = POINTER_MAP.get(arg.type);
+      if (type) {
+        return `heap_view_param<${type}>(${arg.name})`;
+      }
+
+      if (arg.type === "const char*") {
+        return interned ? `get_interned_string(${arg.name})` : `${arg.name}.c_str()`;
+      }
+
+      return arg.name;
+    })
+    .join(", ");
+}
+
+function getViewParameters(function_: FunctionBinding, interned: boolean): string {
+  return function_.arguments
+    .map((arg) => {
+      if (arg.type === "const char*") {
+        return interned ? `int ${arg.name}` : `std::string ${arg.name}`;
+      }
+
+      if (isPrimitivePointer(arg.type)) {
+        return `uintptr_t ${arg.name}`;
+      }
+
+      return `${arg.type} ${arg.name}`;
+    })
+    .join(", ");
+}
+
+// Counts the calls of a binding and times them, declared first so the scope covers the whole body.
+function getInstrumentation(context: GeneratorContext, name: string): string {
+  if (!context.instrument) {
+    return "";
+  }
+
+  return (
+    `    static auto& binding_stats = register_binding("${name}");\n` +
+    "    auto const binding_timer = binding_scope(binding_stats);\n"
+  );
+}
+
+// Hand-written overrides are instrumented after the opening line of each free function binding.
+function getInstrumentedOverride(context: GeneratorContext, lines: string[]): string {
+  return lines
+    .map((line) => {
+      const match = line.match(/^bind_fn\("(\w+)", \[\]\(.*\{\s*$/);
+      return match ? line + getInstrumentation(context, match[1]) : line;
+    })
+    .join("");
+}
+
+// Second binding of a function taking WASM heap addresses for its primitive pointer parameters,
+// so typed array views can be read and written in place without per-element marshalling.
+function getViewBindingCpp(
+  context: GeneratorContext,
+  function_: FunctionBinding,
+  returnType: string,
+  policies: string,
+  interned = false,
+): string {
+  const name = function_.name;
+  const parameters = getViewParameters(function_, interned);
+  const args = getViewArguments(function_, interned);
+  const suffix = interned ? "_Interned" : "_View";
+
+  const call = (() => {
+    if (returnType === "void") {
+      return `    ${name}(${args});\n`;
+    }
+
+    if (returnType === "std::string") {
+      return `    return std::string(${name}(${args}));\n`;
+    }
+
+    return `    return ${name}(${args});\n`;
+  })();
+
+  return (
+    `bind_fn("${name}${suffix}", [](${parameters}) -> ${returnType} {\n` +
+    getInstrumentation(context, `${name}${suffix}`) +
+    call +
+    `}${policies});\n\n`
+  );
+}
+
 export function getFunctionCodeCpp(
   context: GeneratorContext,
   function_: FunctionBinding,
@@ -91,11 +185,10 @@ export function getFunctionCodeCpp(
 ): string {
   const config = context.config.functions?.[function_.name];
   if (config?.exclude) return "";
-  if (config?.override?.cpp) return config.override.cpp.join("");
+  if (config?.override?.cpp) return getInstrumentedOverride(context, config.override.cpp);
 
   const name = function_.name;
   const parameters = getParameters(function_);
-  const args = getArguments(function_);
   const preProcess = getPreProcess(function_);
   const postProcess = getPostprocess(function_);
 
@@ -104,7 +197,7 @@ export function getFunctionCodeCpp(
     returnType = "std::string";
   }
 
-  const call = (() => {
+  const getCall = (args: string) => {
     if (returnType === "void") {
       return `    ${name}(${args});\n`;
     }
@@ -122,7 +215,7 @@ export function getFunctionCodeCpp(
     }
 
     return `    return ${name}(${args});\n`;
-  })();
+  };
 
   const policies = (() => {
     if (returnType.includes("*")) {
@@ -141,19 +234,51 @@ export function getFunctionCodeCpp(
   if (isMethod) {
     return (
       `.function("${name}", override([](${parameters}) -> ${returnType} {\n` +
-      call +
+      getInstrumentation(context, name) +
+      getCall(getArguments(function_)) +
       `}), allow_raw_ptrs{})\n` +
       "\n"
     );
   }
 
+  const viewBinding = hasViewBinding(function_)
+    ? getViewBindingCpp(context, function_, returnType, policies)
+    : "";
+
+  // Same binding taking handles of ImGuiImplWeb.Intern instead of strings, the interned strings
+  // are passed as is without any UTF-8 conversion or allocation. Functions with a view binding
+  // take heap addresses here as well.
+  const internedBinding = (() => {
+    if (!hasInternedBinding(function_) || config?.override?.ts) {
+      return "";
+    }
+
+    if (hasViewBinding(function_)) {
+      return getViewBindingCpp(context, function_, returnType, policies, true);
+    }
+
+    return (
+      `bind_fn("${name}_Interned", [](${getParameters(function_, true)}) -> ${returnType} {\n` +
+      getInstrumentation(context, `${name}_Interned`) +
+      preProcess +
+      getCall(getArguments(function_, true)) +
+      postProcess +
+      ret +
+      `}${policies});\n` +
+      "\n"
+    );
+  })();
+
   return (
     `bind_fn("${name}", [](${parameters}) -> ${returnType} {\n` +
+    getInstrumentation(context, name) +
     preProcess +
-    call +
+    getCall(getArguments(function_)) +
     postProcess +
     ret +
     `}${policies});\n` +
-    "\n"
+    "\n" +
+    viewBinding +
+    internedBinding
   );
 }
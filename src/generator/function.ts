@@ -1,7 +1,7 @@
 import type { CommentBinding } from "./comment.ts";
 import { getJsDocComment } from "./comment.ts";
 import type { GeneratorContext } from "./config.ts";
-import { getTsType, isReferenceStruct, isStructType } from "./util.ts";
+import { getTsType, getTypedArrayType, isReferenceStruct, isStructType } from "./util.ts";
 
 type FunctionArgument = {
   name: string;
@@ -17,6 +17,23 @@ export type FunctionBinding = {
   comments?: CommentBinding;
 };
 
+// Functions where every primitive pointer parameter can be passed as a typed array also get a
+// "_View" binding which takes WASM heap addresses instead, see HeapView in imgui.ts.
+export function hasViewBinding(function_: FunctionBinding): boolean {
+  const pointers = function_.arguments.filter((arg) => getTsType(arg.type).startsWith("["));
+
+  return (
+    function_.arguments.some((arg) => getTypedArrayType(arg.type)) &&
+    pointers.every((arg) => getTypedArrayType(arg.type))
+  );
+}
+
+// Functions taking strings also get an "_Interned" binding which takes string handles from
+// ImGuiImplWeb.Intern instead, see function-cpp.ts.
+export function hasInternedBinding(function_: FunctionBinding): boolean {
+  return function_.arguments.some((arg) => arg.type === "const char*");
+}
+
 function getDefaultValue(param: FunctionArgument): string {
   let defaultValue = param.defaultValue;
 
@@ -64,6 +81,15 @@ function getParameters(function_: FunctionBinding, isMethod: boolean): string {
       let type = getTsType(arg.type ?? "any");
       const defaultValue = getDefaultValue(arg);
 
+      const typedArray = !isMethod && hasViewBinding(function_) && getTypedArrayType(arg.type);
+      if (typedArray) {
+        type = `${type} | ${typedArray}`;
+      }
+
+      if (!isMethod && arg.type === "const char*") {
+        type = `${type} | ImStrHandle`;
+      }
+
       // "in" is a reserved keyword
       let name = arg.name;
       if (arg.name === "in") {
@@ -83,23 +109,146 @@ function getParameters(function_: FunctionBinding, isMethod: boolean): string {
     .join(", ");
 }
 
+function getArgument(arg: FunctionArgument): string {
+  // "in" is a reserved keyword
+  let name = arg.name;
+  if (arg.name === "in") {
+    name = "in_";
+  }
+
+  if (isReferenceStruct(arg.type)) {
+    return `${name}?.ptr ?? null`;
+  }
+
+  return name;
+}
+
+// Functions taking several strings may be called with handles mixed with strings, which take the
+// string binding with the handles resolved to their strings.
+function getStringArgument(function_: FunctionBinding, arg: FunctionArgument): string {
+  const strings = function_.arguments.filter((a) => a.type === "const char*");
+  if (arg.type !== "const char*" || strings.length < 2) {
+    return getArgument(arg);
+  }
+
+  return `getString(${arg.name})`;
+}
+
 export function getArguments(function_: FunctionBinding, isMethod: boolean): string {
   return function_.arguments
     .filter((arg) => !(isMethod && arg.name === "self"))
+    .map((arg) => (isMethod ? getArgument(arg) : getStringArgument(function_, arg)))
+    .join(", ");
+}
+
+// Passes a typed array argument through HeapView, which throws if it is shorter than the native
+// function reads (and writes), e.g. 3 for float[3] and 1 for float*.
+function getViewArgument(arg: FunctionArgument, typedArray: string): string {
+  const readOnly = arg.type.startsWith("const ");
+
+  // Read-only pointers without bounds are arrays of arbitrary length (e.g. plot values).
+  const length = readOnly && !arg.arrayBounds ? 0 : (arg.arrayBounds ?? 1);
+
+  // Const pointers are read-only, no need to copy pooled values back.
+  return `HeapView.In(${arg.name}, ${typedArray}, ${!readOnly}, ${length})`;
+}
+
+function getViewCall(function_: FunctionBinding): string {
+  const arrays = function_.arguments.filter((arg) => getTypedArrayType(arg.type));
+  if (arrays.length === 0) return "";
+
+  // Any typed array takes the view binding, plain arrays are copied through HeapView as well.
+  const condition = arrays.map((arg) => `ArrayBuffer.isView(${arg.name})`).join(" || ");
+
+  const args = function_.arguments
     .map((arg) => {
-      // "in" is a reserved keyword
-      let name = arg.name;
-      if (arg.name === "in") {
-        name = "in_";
+      const typedArray = getTypedArrayType(arg.type);
+      return typedArray ? getViewArgument(arg, typedArray) : getStringArgument(function_, arg);
+    })
+    .join(", ");
+
+  const returnType = getTsType(function_.returnType);
+  const call = isStructType(function_.returnType)
+    ? `${returnType}.From(Mod.export.${function_.name}_View(${args}))`
+    : `Mod.export.${function_.name}_View(${args})`;
+
+  if (returnType === "void") {
+    return (
+      `    if (${condition}) {\n` +
+      `        ${call};\n` +
+      `        HeapView.Flush();\n` +
+      `        return;\n` +
+      `    }\n`
+    );
+  }
+
+  return (
+    `    if (${condition}) {\n` +
+    `        const ret = ${call};\n` +
+    `        HeapView.Flush();\n` +
+    `        return ret;\n` +
+    `    }\n`
+  );
+}
+
+// Takes the "_Interned" binding if the first string is a handle. The other strings have to be
+// handles as well, or still be their constant default value which is interned on the fly. Other
+// calls take the string binding, see getStringArgument.
+// Functions with a view binding pass their arrays through HeapView here as well.
+function getInternedCall(function_: FunctionBinding): string {
+  const strings = function_.arguments.filter((arg) => arg.type === "const char*");
+  const first = strings[0];
+  if (!first) return "";
+
+  const condition = strings
+    .map((arg) => {
+      const defaultValue = getDefaultValue(arg);
+      if (arg === first || !defaultValue) {
+        return `typeof ${arg.name} === "number"`;
       }
 
-      if (isReferenceStruct(arg.type)) {
-        return `${name}?.ptr ?? null`;
+      return `(typeof ${arg.name} === "number" || ${arg.name} === ${defaultValue})`;
+    })
+    .join(" && ");
+
+  const view = hasViewBinding(function_);
+
+  const args = function_.arguments
+    .map((arg) => {
+      const typedArray = view && getTypedArrayType(arg.type);
+      if (typedArray) {
+        return getViewArgument(arg, typedArray);
       }
 
-      return name;
+      if (arg.type !== "const char*" || arg === first || !getDefaultValue(arg)) {
+        return getArgument(arg);
+      }
+
+      return `typeof ${arg.name} === "number" ? ${arg.name} : ImGuiImplWeb.Intern(${arg.name})`;
     })
     .join(", ");
+
+  const returnType = getTsType(function_.returnType);
+  const call = isStructType(function_.returnType)
+    ? `${returnType}.From(Mod.export.${function_.name}_Interned(${args}))`
+    : `Mod.export.${function_.name}_Interned(${args})`;
+  const flush = view ? `        HeapView.Flush();\n` : "";
+
+  if (returnType === "void") {
+    return `    if (${condition}) {\n` + `        ${call};\n` + flush + `        return;\n` + `    }\n`;
+  }
+
+  if (view) {
+    return (
+      `    if (${condition}) {\n` +
+      `        const ret = ${call};\n` +
+      flush +
+      `        return ret;\n` +
+      `    }\n`
+    );
+  }
+
+  return `    if (${condition}) {\n` + `        return ${call};\n` + `    }\n`;
 }
 
 function getCall(function_: FunctionBinding, isMethod: boolean): string {
@@ -134,7 +283,10 @@ export function getFunctionCodeTs(
   const returnType = getTsType(function_.returnType);
 
   const params = getParameters(function_, isMethod);
-  const call = getCall(function_, isMethod);
+  const internedCall =
+    !isMethod && hasInternedBinding(function_) ? getInternedCall(function_) : "";
+  const viewCall = !isMethod && hasViewBinding(function_) ? getViewCall(function_) : "";
+  const call = internedCall + viewCall + getCall(function_, isMethod);
 
   if (isMethod) {
     return `${comment}${name}(${params}): ${returnType} {\n${call}\n}\n`;
@@ -28,6 +28,23 @@ const TYPE_MAP = new Map<string, string>([
   ["double[4]", "[number, number, number, number]"],
 ]);
 
+const TYPED_ARRAY_MAP = new Map<string, string>([
+  ["float*", "Float32Array"],
+  ["const float*", "Float32Array"],
+  ["float[2]", "Float32Array"],
+  ["float[3]", "Float32Array"],
+  ["float[4]", "Float32Array"],
+  ["double*", "Float64Array"],
+  ["double[2]", "Float64Array"],
+  ["double[3]", "Float64Array"],
+  ["double[4]", "Float64Array"],
+  ["int*", "Int32Array"],
+  ["int[2]", "Int32Array"],
+  ["int[3]", "Int32Array"],
+  ["int[4]", "Int32Array"],
+  ["unsigned int*", "Uint32Array"],
+]);
+
 const TYPEDEFS: string[] = [
   "ImDrawIdx",
   "ImGuiID",
@@ -124,3 +141,7 @@ export function getTsType(declaration: string): string {
 
   return declaration;
 }
+
+export function getTypedArrayType(declaration: string): string | undefined {
+  return TYPED_ARRAY_MAP.get(declaration);
+}
@@ -4,6 +4,7 @@
 #include <dcimgui_impl_wgpu.h>
 
 #include <emscripten/bind.h>
+#include <emscripten/emscripten.h>
 #include <emscripten/val.h>
 #include <emscripten/wire.h>
 #include <emscripten/heap.h>
@@ -12,112 +13,2448 @@
 #include <webgpu/webgpu.h>
 #include <webgpu/webgpu_cpp.h>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <optional>
 #include <ranges>
+#include <span>
+#include <string_view>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include <string>
 
 #include <malloc.h>
 
+#ifdef __wasm_simd128__
+#include <wasm_simd128.h>
+#endif
+
+#ifdef __EMSCRIPTEN_PTHREADS__
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
 using js_val = emscripten::val;
 using allow_raw_ptrs = emscripten::allow_raw_pointers;
 using rvp_ref = emscripten::return_value_policy::reference;
 
-template <typename... Ts>
-consteval auto unused(Ts&&...) -> void {};
+template <typename... Ts>
+consteval auto unused(Ts&&...) -> void {};
+
+template <typename Fn>
+constexpr auto override(Fn&& fn) {
+    return emscripten::optional_override(std::forward<Fn>(fn));
+}
+
+template <typename Fn, typename... Policies>
+constexpr auto bind_fn(const char* name, Fn&& fn, Policies&&... policies) -> void {
+    return emscripten::function(
+        name,
+        emscripten::optional_override(std::forward<Fn>(fn)),
+        std::forward<Policies>(policies)...
+    );
+}
+
+template <typename T>
+constexpr auto bind_struct(const char* name) -> emscripten::class_<T> {
+    return emscripten::class_<T>(name);
+}
+
+/**
+ * Bump allocator for the temporaries of the bindings (array params, InputText buffers). All
+ * allocations of a call are released before it returns, so the block is rewound as soon as no
+ * allocation is alive and steady-state frames never reach malloc. Allocations not fitting into the
+ * block are served by malloc and merged into a bigger block at the next reset() in ImGui_NewFrame.
+ * `peak` is the most a single call had alive, which is what the block has to hold.
+ */
+struct frame_arena {
+    struct overflow_chunk {
+        overflow_chunk* next;
+    };
+
+    static constexpr auto header_size = alignof(std::max_align_t);
+
+    std::byte* block = nullptr;
+    size_t capacity = 0;
+    size_t used = 0;
+    size_t live = 0;
+    size_t peak = 0;
+    size_t call_overflow = 0;
+    size_t overflow_size = 0;
+    overflow_chunk* overflow = nullptr;
+    size_t mallocs = 0;
+
+    auto allocate(size_t size, size_t align) -> void* {
+        ++live;
+
+        auto const offset = (used + align - 1) & ~(align - 1);
+        if (block && offset + size <= capacity) {
+            used = offset + size;
+            peak = std::max(peak, used + call_overflow);
+            return block + offset;
+        }
+
+        ++mallocs;
+        auto* chunk = static_cast<overflow_chunk*>(std::malloc(header_size + size));
+        if (!chunk)
+            std::abort();
+
+        chunk->next = overflow;
+        overflow = chunk;
+
+        // Sized with the worst-case alignment padding it would need in the block.
+        call_overflow += size + align - 1;
+        overflow_size += header_size + size;
+        peak = std::max(peak, used + call_overflow);
+        return reinterpret_cast<std::byte*>(chunk) + header_size;
+    }
+
+    auto deallocate(void*) -> void {
+        if (live > 0 && --live == 0) {
+            used = 0;
+            call_overflow = 0;
+        }
+    }
+
+    auto reset() -> void {
+        if (live > 0 || !overflow)
+            return;
+
+        while (overflow) {
+            auto* next = overflow->next;
+            std::free(overflow);
+            overflow = next;
+        }
+
+        std::free(block);
+        ++mallocs;
+        capacity = std::max(capacity * 2, peak);
+        block = static_cast<std::byte*>(std::malloc(capacity));
+
+        // Without a block every allocation overflows to malloc, which still works.
+        if (!block)
+            capacity = 0;
+
+        used = 0;
+        overflow_size = 0;
+    }
+};
+
+static auto binding_arena = frame_arena();
+
+/**
+ * Standard allocator handing out memory from the binding arena.
+ */
+template <typename T>
+struct arena_allocator {
+    using value_type = T;
+
+    arena_allocator() = default;
+
+    template <typename U>
+    constexpr arena_allocator(arena_allocator<U> const&) noexcept {}
+
+    auto allocate(size_t n) -> T* {
+        return static_cast<T*>(binding_arena.allocate(n * sizeof(T), alignof(T)));
+    }
+
+    auto deallocate(T* ptr, size_t) -> void {
+        binding_arena.deallocate(ptr);
+    }
+
+    friend auto operator==(arena_allocator const&, arena_allocator const&) -> bool {
+        return true;
+    }
+};
+
+template <typename T>
+using arena_vector = std::vector<T, arena_allocator<T>>;
+
+/**
+ * Standard allocator default-initializing the elements added by resize(), which leaves bytes
+ * uninitialized for buffers filled right after growing.
+ */
+template <typename T>
+struct default_init_allocator : std::allocator<T> {
+    template <typename U>
+    struct rebind {
+        using other = default_init_allocator<U>;
+    };
+
+    default_init_allocator() = default;
+
+    template <typename U>
+    constexpr default_init_allocator(default_init_allocator<U> const&) noexcept {}
+
+    template <typename U, typename... Args>
+    auto construct(U* ptr, Args&&... args) -> void {
+        if constexpr (sizeof...(Args) == 0)
+            ::new (static_cast<void*>(ptr)) U;
+        else
+            ::new (static_cast<void*>(ptr)) U(std::forward<Args>(args)...);
+    }
+};
+
+template <typename T, size_t N>
+struct array_param {
+    std::array<T, N> arr = {};
+    T* ptr = nullptr;
+};
+
+template <typename T, size_t N>
+inline auto get_array_param(js_val const& v) -> array_param<T, N> {
+    array_param<T, N> out{};
+
+    if (v.isNull() || v.isUndefined() || !v.isArray())
+        return out;
+
+    auto const len = v["length"].as<size_t>();
+    if (len <= 0 || len > N)
+        return out;
+
+    for (auto const i : std::views::iota(0uz, len)) {
+        out.arr[i] = v[i].as<T>();
+    }
+
+    out.ptr = out.arr.data();
+    return out;
+}
+
+template <typename T, size_t N>
+inline auto write_back_array_param(array_param<T, N> const& out, js_val& v) -> void {
+    if (!out.ptr)
+        return;
+
+    for (auto const i : std::views::iota(0uz, N)) {
+        v.set(i, out.arr[i]);
+    }
+}
+
+template <typename T>
+inline auto heap_view_param(uintptr_t addr) -> T* {
+    return reinterpret_cast<T*>(addr);
+}
+
+template <typename T>
+struct vector_param {
+    arena_vector<T> vec = {};
+    T* ptr = nullptr;
+};
+
+template <typename T>
+inline auto get_vector_param(js_val const& v) -> vector_param<T> {
+    vector_param<T> out{};
+
+    if (v.isNull() || v.isUndefined() || !v.isArray())
+        return out;
+
+    auto const len = v["length"].as<size_t>();
+    if (len <= 0)
+        return out;
+
+    out.vec.reserve(len);
+    for (auto const i : std::views::iota(0uz, len)) {
+        out.vec.emplace_back(v[i].as<T>());
+    }
+
+    out.ptr = out.vec.data();
+    return out;
+}
+
+template <typename T>
+inline auto write_back_vector_param(vector_param<T> const& out, js_val& v) -> void {
+    if (!out.ptr)
+        return;
+
+    for (auto const i : std::views::iota(0uz, out.vec.size())) {
+        v.set(i, out.vec[i]);
+    }
+}
+
+EM_JS_DEPS(jsimgui_text_buffer, "$stringToUTF8,$Emval");
+
+// Encodes the JS string straight into WASM memory, truncated to `size` bytes with the terminator.
+EM_JS(void, copy_js_string, (emscripten::EM_VAL str, char* out, size_t size), {
+    stringToUTF8(Emval.toValue(str), out, size);
+});
+
+/**
+ * Arena buffer of the InputText functions, released when the binding returns.
+ */
+struct text_buffer {
+    char* ptr;
+
+    explicit text_buffer(char* ptr) : ptr(ptr) {}
+    text_buffer(text_buffer const&) = delete;
+    auto operator=(text_buffer const&) -> text_buffer& = delete;
+    ~text_buffer() {
+        binding_arena.deallocate(ptr);
+    }
+
+    auto data() const -> char* {
+        return ptr;
+    }
+};
+
+/**
+ * Copies the string `buf[0]` into an arena buffer of `buf_size` bytes for the InputText functions,
+ * without a temporary std::string.
+ */
+inline auto get_text_buffer(js_val const& buf, size_t buf_size) -> text_buffer {
+    auto const size = std::max(buf_size, 1uz);
+    auto* const ptr = static_cast<char*>(binding_arena.allocate(size, alignof(char)));
+
+    copy_js_string(buf[0].as_handle(), ptr, size);
+    return text_buffer{ptr};
+}
+
+/**
+ * Text buffer for the InputText functions that persists across frames and grows through
+ * ImGuiInputTextFlags_CallbackResize, same as misc/cpp/imgui_stdlib. Unlike the `[string]` buffers
+ * the text isn't copied in and out every frame, JS reads it only when `version` changed.
+ */
+struct TextBuffer {
+    std::string text;
+    uint32_t version = 0;
+
+    auto set(std::string value) -> void {
+        text = std::move(value);
+        version++;
+    }
+
+    /**
+     * Calls `input` with the buffer, its size, the flags and the resize callback, bumping
+     * `version` if the text was edited.
+     */
+    template <typename F>
+    auto edit(ImGuiInputTextFlags flags, F&& input) -> bool {
+        flags |= ImGuiInputTextFlags_CallbackResize;
+        auto const changed = input(text.data(), text.capacity() + 1, flags, resize, this);
+        if (changed)
+            version++;
+
+        return changed;
+    }
+
+  private:
+    static auto resize(ImGuiInputTextCallbackData* data) -> int {
+        if (data->EventFlag == ImGuiInputTextFlags_CallbackResize) {
+            auto* const self = static_cast<TextBuffer*>(data->UserData);
+            self->text.resize(static_cast<size_t>(data->BufTextLen));
+            data->Buf = self->text.data();
+        }
+
+        return 0;
+    }
+};
+
+/**
+ * Fixed capacity ring buffer of plot samples living in the WASM heap. JS only pushes new samples,
+ * the plot functions read the history in place instead of re-marshalling it every frame.
+ */
+struct PlotRingBuffer {
+    std::vector<float> values;
+    int head = 0;
+    int size = 0;
+
+    explicit PlotRingBuffer(int capacity) : values(static_cast<size_t>(std::max(capacity, 1))) {}
+
+    [[nodiscard]] auto capacity() const -> int {
+        return static_cast<int>(values.size());
+    }
+
+    auto push(float const* data, int count) -> void {
+        if (!data || count <= 0)
+            return;
+
+        // Only the newest `capacity` samples survive, skip the rest.
+        if (count > capacity()) {
+            data += count - capacity();
+            count = capacity();
+        }
+
+        auto const first = std::min(count, capacity() - head);
+        std::copy_n(data, first, values.begin() + head);
+        std::copy_n(data + first, count - first, values.begin());
+
+        head = (head + count) % capacity();
+        size = std::min(size + count, capacity());
+    }
+
+    auto clear() -> void {
+        head = 0;
+        size = 0;
+    }
+
+    /**
+     * Returns the sample `idx` positions after the oldest one.
+     */
+    [[nodiscard]] auto at(int idx) const -> float {
+        auto const oldest = size < capacity() ? 0 : head;
+        return values[static_cast<size_t>((oldest + idx) % capacity())];
+    }
+};
+
+/**
+ * Window into a PlotRingBuffer passed as user data to the ImGui plot callbacks.
+ */
+struct plot_window {
+    PlotRingBuffer const* buffer;
+    int start;
+    int count;
+};
+
+static auto plot_window_getter(void* data, int idx) -> float {
+    auto const* window = static_cast<plot_window const*>(data);
+    return window->buffer->at(window->start + idx);
+}
+
+/**
+ * Selects the newest `count` samples of the buffer, moved back into the history by `offset`.
+ */
+static auto get_plot_window(PlotRingBuffer const* buffer, int count, int offset) -> plot_window {
+    auto const end = std::clamp(buffer->size - offset, 0, buffer->size);
+    auto const len = std::clamp(count, 0, end);
+    return plot_window{.buffer = buffer, .start = end - len, .count = len};
+}
+
+/**
+ * Whether `format` holds exactly one printf conversion out of `conversions` and no `*` width or
+ * length modifier, so formatting a table cell never reads arguments which weren't passed.
+ */
+static auto is_cell_format(std::string_view format, std::string_view conversions) -> bool {
+    auto count = 0;
+
+    for (auto i = 0uz; i < format.size(); i++) {
+        if (format[i] != '%')
+            continue;
+        if (i + 1 < format.size() && format[i + 1] == '%') {
+            i++;
+            continue;
+        }
+
+        i = format.find_first_not_of("-+ #0123456789.", i + 1);
+        if (i == std::string_view::npos || conversions.find(format[i]) == std::string_view::npos)
+            return false;
+        count++;
+    }
+
+    return count == 1;
+}
+
+enum class column_type : int32_t {
+    float64,
+    int32,
+    string,
+};
+
+/**
+ * Values of a table column in the WASM heap, owned by JS (HeapArray in imgui.ts). String columns
+ * hold indices into `strings`, which is copied in once together with the sort rank of each string.
+ */
+struct column_source {
+    column_type type = column_type::float64;
+    void const* data = nullptr;
+    int length = 0;
+    std::vector<std::string> strings;
+    std::vector<int32_t> ranks;
+};
+
+/**
+ * One key of a row sort. `data` points at the JS owned column, or at `snapshot` for sorts on
+ * another thread, which then don't race with JS writing or dropping the column. Rows past the
+ * end of the column and NaN values sort last in both directions.
+ */
+struct sort_key {
+    column_type type;
+    void const* data;
+    uint32_t length;
+    bool descending;
+    std::vector<int32_t> ranks;
+    std::vector<std::byte> snapshot;
+
+    [[nodiscard]] auto compare(uint32_t a, uint32_t b) const -> int {
+        if (a >= length || b >= length)
+            return static_cast<int>(a >= length) - static_cast<int>(b >= length);
+
+        auto const order = [](auto x, auto y) -> int { return (x > y) - (x < y); };
+        auto result = 0;
+
+        switch (type) {
+        case column_type::float64: {
+            auto const* values = static_cast<double const*>(data);
+            auto const nan_a = std::isnan(values[a]);
+            auto const nan_b = std::isnan(values[b]);
+            if (nan_a || nan_b)
+                return static_cast<int>(nan_a) - static_cast<int>(nan_b);
+
+            result = order(values[a], values[b]);
+            break;
+        }
+        case column_type::int32: {
+            auto const* values = static_cast<int32_t const*>(data);
+            result = order(values[a], values[b]);
+            break;
+        }
+        case column_type::string: {
+            auto const* values = static_cast<int32_t const*>(data);
+            result = order(rank(values[a]), rank(values[b]));
+            break;
+        }
+        }
+
+        return descending ? -result : result;
+    }
+
+    /**
+     * The position of a string table entry in sorted order, equal strings share their rank.
+     */
+    [[nodiscard]] auto rank(int32_t idx) const -> int32_t {
+        return idx >= 0 && idx < std::ssize(ranks) ? ranks[static_cast<size_t>(idx)]
+                                                    : std::numeric_limits<int32_t>::max();
+    }
+};
+
+static auto get_string_ranks(std::vector<std::string> const& strings) -> std::vector<int32_t> {
+    auto sorted = std::vector<int32_t>(strings.size());
+    std::iota(sorted.begin(), sorted.end(), 0);
+    std::ranges::sort(sorted, [&strings](int32_t a, int32_t b) {
+        return strings[static_cast<size_t>(a)] < strings[static_cast<size_t>(b)];
+    });
+
+    auto ranks = std::vector<int32_t>(strings.size());
+    auto rank = 0;
+    for (auto i = 0uz; i < sorted.size(); i++) {
+        auto const& str = strings[static_cast<size_t>(sorted[i])];
+        if (i > 0 && str != strings[static_cast<size_t>(sorted[i - 1])])
+            rank = static_cast<int32_t>(i);
+        ranks[static_cast<size_t>(sorted[i])] = rank;
+    }
+
+    return ranks;
+}
+
+/**
+ * Stable merge sort (std::stable_sort) of the row indices by the keys in order, ties keep the
+ * original row order.
+ */
+static auto sort_rows(std::vector<sort_key> const& keys, uint32_t rows) -> std::vector<uint32_t> {
+    auto order = std::vector<uint32_t>(rows);
+    std::iota(order.begin(), order.end(), 0u);
+
+    if (keys.empty())
+        return order;
+
+    std::ranges::stable_sort(order, [&keys](uint32_t a, uint32_t b) {
+        for (auto const& key : keys) {
+            auto const result = key.compare(a, b);
+            if (result != 0)
+                return result < 0;
+        }
+        return false;
+    });
+
+    return order;
+}
+
+#ifdef __EMSCRIPTEN_PTHREADS__
+/**
+ * An async sort handed to the sort thread. The sorter polls `done`, a dropped sorter sets
+ * `cancelled` instead of waiting for the result.
+ */
+struct sort_job {
+    std::vector<sort_key> keys;
+    uint32_t rows = 0;
+    std::vector<uint32_t> result;
+    std::atomic<bool> done = false;
+    std::atomic<bool> cancelled = false;
+};
+
+/**
+ * The one long-lived thread running the async sorts of all TableSorters, in the order they were
+ * started. It is started with the first job and takes the pooled pthread (`-sPTHREAD_POOL_SIZE=1`),
+ * so no job waits for a new worker, and it is never joined.
+ */
+struct sort_thread {
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<std::shared_ptr<sort_job>> jobs;
+    bool started = false;
+
+    auto submit(std::shared_ptr<sort_job> job) -> void {
+        {
+            auto const lock = std::lock_guard(mutex);
+            jobs.push_back(std::move(job));
+            if (!started) {
+                started = true;
+                std::thread([this] { run(); }).detach();
+            }
+        }
+        wake.notify_one();
+    }
+
+  private:
+    [[noreturn]] auto run() -> void {
+        while (true) {
+            auto lock = std::unique_lock(mutex);
+            wake.wait(lock, [this] { return !jobs.empty(); });
+            auto const job = std::move(jobs.front());
+            jobs.pop_front();
+            lock.unlock();
+
+            if (job->cancelled.load(std::memory_order_relaxed))
+                continue;
+
+            job->result = sort_rows(job->keys, job->rows);
+            job->keys.clear();
+            job->done.store(true, std::memory_order_release);
+        }
+    }
+};
+
+static auto* const sort_worker = new sort_thread();
+#endif
+
+/**
+ * Row permutation of a table sorted by its ImGuiTableSortSpecs. The permutation is cached and
+ * only sorted again when the specs change or are marked dirty, the row count changes or the data
+ * is invalidated. With `async` in pthreads builds (`build.ts --pthread`), the sort runs on the
+ * sort thread and the previous permutation stays in use until it is done.
+ */
+struct TableSorter {
+    std::vector<column_source> columns;
+    int rows = 0;
+    bool async = false;
+
+    std::vector<uint32_t> order;
+    std::vector<std::pair<int, bool>> sort_columns;
+    bool valid = false;
+
+#ifdef __EMSCRIPTEN_PTHREADS__
+    std::shared_ptr<sort_job> pending;
+    bool pending_stale = false;
+
+    TableSorter() = default;
+    TableSorter(TableSorter const&) = delete;
+    auto operator=(TableSorter const&) -> TableSorter& = delete;
+
+    ~TableSorter() {
+        if (pending)
+            pending->cancelled.store(true, std::memory_order_relaxed);
+    }
+#endif
+
+    auto set_data(int index, column_type type, void const* data, int length) -> bool {
+        if (index < 0)
+            return false;
+        if (index >= std::ssize(columns))
+            columns.resize(static_cast<size_t>(index) + 1);
+
+        auto& source = columns[static_cast<size_t>(index)];
+        source.type = type;
+        source.data = data;
+        source.length = std::max(length, 0);
+        valid = false;
+        return true;
+    }
+
+    auto set_strings(int index, std::vector<std::string> strings) -> bool {
+        if (index < 0 || index >= std::ssize(columns))
+            return false;
+
+        auto& source = columns[static_cast<size_t>(index)];
+        if (source.type != column_type::string)
+            return false;
+
+        source.strings = std::move(strings);
+        source.ranks = get_string_ranks(source.strings);
+        valid = false;
+        return true;
+    }
+
+    [[nodiscard]] auto busy() const -> bool {
+#ifdef __EMSCRIPTEN_PTHREADS__
+        return pending != nullptr;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * Returns the permutation for the specs, an identity without specs. Clears `SpecsDirty`.
+     */
+    auto sort(ImGuiTableSortSpecs* specs) -> std::span<uint32_t const> {
+        poll();
+
+        auto const row_count = static_cast<uint32_t>(std::max(rows, 0));
+        if (order.size() != row_count) {
+            order.resize(row_count);
+            std::iota(order.begin(), order.end(), 0u);
+            valid = false;
+        }
+
+        if (update_sort_columns(specs) || (specs && specs->SpecsDirty))
+            valid = false;
+        if (specs)
+            specs->SpecsDirty = false;
+
+        if (valid)
+            return order;
+        valid = true;
+
+#ifdef __EMSCRIPTEN_PTHREADS__
+        if (async) {
+            if (pending) {
+                pending_stale = true;
+            } else {
+                pending = std::make_shared<sort_job>();
+                pending->keys = get_sort_keys(true);
+                pending->rows = row_count;
+                sort_worker->submit(pending);
+            }
+            return order;
+        }
+#endif
+
+        order = sort_rows(get_sort_keys(false), row_count);
+        return order;
+    }
+
+  private:
+    auto poll() -> void {
+#ifdef __EMSCRIPTEN_PTHREADS__
+        if (!pending || !pending->done.load(std::memory_order_acquire))
+            return;
+
+        auto result = std::move(pending->result);
+        pending.reset();
+        if (result.size() == order.size())
+            order = std::move(result);
+
+        // The specs or the data changed while sorting, sort again with the current ones.
+        if (pending_stale) {
+            pending_stale = false;
+            valid = false;
+        }
+#endif
+    }
+
+    auto update_sort_columns(ImGuiTableSortSpecs const* specs) -> bool {
+        auto const count = specs ? specs->SpecsCount : 0;
+        auto const column_spec = [specs](int i) -> std::pair<int, bool> {
+            auto const& spec = specs->Specs[i];
+            return {spec.ColumnIndex, spec.SortDirection == ImGuiSortDirection_Descending};
+        };
+
+        auto changed = count != std::ssize(sort_columns);
+        for (auto i = 0; i < count && !changed; i++)
+            changed = column_spec(i) != sort_columns[static_cast<size_t>(i)];
+
+        if (changed) {
+            sort_columns.clear();
+            for (auto i = 0; i < count; i++)
+                sort_columns.push_back(column_spec(i));
+        }
+
+        return changed;
+    }
+
+    /**
+     * The keys of the sort columns, copying the column values into the keys with `snapshot`.
+     */
+    [[nodiscard]] auto get_sort_keys(bool snapshot) const -> std::vector<sort_key> {
+        auto keys = std::vector<sort_key>();
+
+        for (auto const& [column, descending] : sort_columns) {
+            if (column < 0 || column >= std::ssize(columns))
+                continue;
+
+            auto const& source = columns[static_cast<size_t>(column)];
+            if (!source.data)
+                continue;
+
+            auto& key = keys.emplace_back(
+                sort_key{
+                    .type = source.type,
+                    .data = source.data,
+                    .length = static_cast<uint32_t>(source.length),
+                    .descending = descending,
+                    .ranks = source.ranks,
+                    .snapshot = {},
+                }
+            );
+
+            if (snapshot) {
+                auto const size = source.type == column_type::float64 ? sizeof(double)
+                                                                      : sizeof(int32_t);
+                auto const* bytes = static_cast<std::byte const*>(source.data);
+                key.snapshot.assign(bytes, bytes + size * key.length);
+                key.data = key.snapshot.data();
+            }
+        }
+
+        return keys;
+    }
+};
+
+/**
+ * Table whose visible cells are formatted and drawn natively from columns in the WASM heap, so a
+ * frame costs one call instead of several per visible cell. Numeric columns point at typed arrays
+ * JS keeps filled (HeapArray in imgui.ts), string columns index into a string table copied in once.
+ * The table doesn't own the column data. Sortable tables (ImGuiTableFlags_Sortable) show the rows
+ * in the order of their TableSorter.
+ */
+struct ColumnTable {
+    struct column {
+        std::string label;
+        std::string format;
+        column_type type;
+        ImGuiTableColumnFlags flags;
+        float width;
+    };
+
+    std::vector<column> columns;
+    TableSorter sorter;
+
+    auto add_column(
+        std::string label,
+        column_type type,
+        std::string format,
+        ImGuiTableColumnFlags flags,
+        float width
+    ) -> bool {
+        if (type == column_type::float64 && !is_cell_format(format, "fFeEgGaA"))
+            return false;
+        if (type == column_type::int32 && !is_cell_format(format, "diuoxXc"))
+            return false;
+
+        auto const index = static_cast<int>(columns.size());
+        columns.push_back(
+            column{
+                .label = std::move(label),
+                .format = std::move(format),
+                .type = type,
+                .flags = flags,
+                .width = width,
+            }
+        );
+        sorter.set_data(index, type, nullptr, 0);
+        return true;
+    }
+
+    auto set_data(int index, column_type type, void const* data, int length) -> bool {
+        if (index < 0 || index >= std::ssize(columns))
+            return false;
+        if (columns[static_cast<size_t>(index)].type != type)
+            return false;
+
+        return sorter.set_data(index, type, data, length);
+    }
+
+    auto render(const char* id, ImGuiTableFlags flags, ImVec2 outer_size) -> bool {
+        auto const count = static_cast<int>(columns.size());
+        if (count == 0 || !ImGui_BeginTable(id, count, flags, outer_size, 0.0f))
+            return false;
+
+        ImGui_TableSetupScrollFreeze(0, 1);
+        for (auto const& col : columns)
+            ImGui_TableSetupColumn(col.label.c_str(), col.flags, col.width, 0);
+        ImGui_TableHeadersRow();
+
+        auto const order = sorter.sort(ImGui_TableGetSortSpecs());
+
+        auto clipper = ImGuiListClipper{};
+        ImGuiListClipper_Begin(&clipper, static_cast<int>(order.size()), -1.0f);
+
+        while (ImGuiListClipper_Step(&clipper)) {
+            for (auto i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                auto const row = static_cast<int>(order[static_cast<size_t>(i)]);
+                ImGui_TableNextRow(0, 0.0f);
+
+                for (auto c = 0; c < count; c++) {
+                    if (ImGui_TableSetColumnIndex(c)) {
+                        auto const index = static_cast<size_t>(c);
+                        draw_cell(columns[index], sorter.columns[index], row);
+                    }
+                }
+            }
+        }
+
+        ImGui_EndTable();
+        return true;
+    }
+
+    static auto draw_cell(column const& col, column_source const& source, int row) -> void {
+        if (!source.data || row >= source.length)
+            return;
+
+        static auto buffer = std::array<char, 128>();
+        auto len = 0;
+
+        switch (col.type) {
+        case column_type::float64:
+            len = std::snprintf(
+                buffer.data(),
+                buffer.size(),
+                col.format.c_str(),
+                static_cast<double const*>(source.data)[row]
+            );
+            break;
+        case column_type::int32:
+            len = std::snprintf(
+                buffer.data(),
+                buffer.size(),
+                col.format.c_str(),
+                static_cast<int32_t const*>(source.data)[row]
+            );
+            break;
+        case column_type::string: {
+            auto const idx = static_cast<int32_t const*>(source.data)[row];
+            if (idx < 0 || idx >= std::ssize(source.strings))
+                return;
+
+            auto const& str = source.strings[static_cast<size_t>(idx)];
+            ImGui_TextUnformatted(str.data(), str.data() + str.size());
+            return;
+        }
+        }
+
+        len = std::clamp(len, 0, static_cast<int>(buffer.size()) - 1);
+        ImGui_TextUnformatted(buffer.data(), buffer.data() + len);
+    }
+};
+
+/**
+ * Position of the first `needle` in `text` at or after `from`, both lowercase, or npos. The SIMD
+ * variant compares the first and last byte of the needle against 16 candidate positions at once
+ * and only runs memcmp on positions where both match.
+ */
+static auto find_lower(std::string_view text, std::string_view needle, size_t from) -> size_t {
+    if (needle.empty() || needle.size() > text.size())
+        return std::string_view::npos;
+
+    auto const starts = text.size() - needle.size() + 1;
+    auto i = from;
+
+#ifdef __wasm_simd128__
+    auto const first = wasm_i8x16_splat(static_cast<int8_t>(needle.front()));
+    auto const last = wasm_i8x16_splat(static_cast<int8_t>(needle.back()));
+
+    for (; i + 16 <= starts; i += 16) {
+        auto const* const ptr = text.data() + i;
+        auto const block_first = wasm_v128_load(ptr);
+        auto const block_last = wasm_v128_load(ptr + needle.size() - 1);
+        auto const eq = wasm_v128_and(
+            wasm_i8x16_eq(block_first, first),
+            wasm_i8x16_eq(block_last, last)
+        );
+
+        for (uint32_t mask = wasm_i8x16_bitmask(eq); mask != 0; mask &= mask - 1) {
+            auto const pos = static_cast<size_t>(std::countr_zero(mask));
+            if (std::memcmp(ptr + pos, needle.data(), needle.size()) == 0)
+                return i + pos;
+        }
+    }
+#endif
+
+    for (; i < starts; i++) {
+        auto const* const ptr = text.data() + i;
+        if (*ptr == needle.front() && std::memcmp(ptr, needle.data(), needle.size()) == 0)
+            return i;
+    }
+
+    return std::string_view::npos;
+}
+
+static auto to_lower_ascii(char c) -> char {
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+/**
+ * Filters a list of strings with the ImGuiTextFilter syntax ("aaa,-bbb": comma separated terms,
+ * a leading '-' excludes, case-insensitive for ASCII) natively. The strings are copied once into
+ * a lowercase UTF-8 pool, every filter change scans the pool and writes the indices of the
+ * passing strings, which JS feeds to an ImGuiListClipper.
+ */
+struct TextFilterIndex {
+    struct term {
+        std::string text;
+        bool exclude;
+    };
+
+    enum class decision : uint8_t { none, pass, fail };
+
+    std::vector<char> pool;
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> matches;
+    std::vector<decision> decisions;
+    std::vector<term> terms;
+    std::string filter;
+    bool valid = false;
+
+    [[nodiscard]] auto count() const -> int {
+        return offsets.empty() ? 0 : static_cast<int>(offsets.size()) - 1;
+    }
+
+    /**
+     * Copies `count` strings packed into `data` with their `count + 1` start offsets (the last one
+     * being the end of the pool).
+     */
+    auto load(char const* data, uint32_t const* starts, int count) -> bool {
+        if (count < 0 || (count > 0 && (!data || !starts)))
+            return false;
+
+        auto const ends = std::span(starts, static_cast<size_t>(count) + 1);
+        if (ends.front() != 0 || !std::ranges::is_sorted(ends))
+            return false;
+
+        pool.assign(data, data + ends.back());
+        std::ranges::transform(pool, pool.begin(), to_lower_ascii);
+        offsets.assign(ends.begin(), ends.end());
+        valid = false;
+        return true;
+    }
+
+    /**
+     * Returns the indices of the strings passing `text`, scanning only if it changed.
+     */
+    auto apply(std::string_view text) -> std::span<uint32_t const> {
+        if (valid && text == filter)
+            return matches;
+
+        filter = text;
+        valid = true;
+        parse();
+
+        decide();
+
+        matches.clear();
+        auto const includes = std::ranges::any_of(terms, [](term const& t) { return !t.exclude; });
+        for (auto i = 0; i < count(); i++) {
+            auto const d = decisions[static_cast<size_t>(i)];
+            if (d == decision::pass || (d == decision::none && !includes))
+                matches.push_back(static_cast<uint32_t>(i));
+        }
+
+        return matches;
+    }
+
+  private:
+    auto parse() -> void {
+        terms.clear();
+
+        for (auto const part : std::views::split(std::string_view(filter), ',')) {
+            auto str = std::string_view(part.begin(), part.end());
+            auto const first = str.find_first_not_of(" \t");
+            if (first == std::string_view::npos)
+                continue;
+            str = str.substr(first, str.find_last_not_of(" \t") - first + 1);
+
+            auto const exclude = str.front() == '-';
+            if (exclude)
+                str.remove_prefix(1);
+            if (str.empty())
+                continue;
+
+            auto& t = terms.emplace_back(term{.text = std::string(str), .exclude = exclude});
+            std::ranges::transform(t.text, t.text.begin(), to_lower_ascii);
+        }
+    }
+
+    /**
+     * Same rules as ImGuiTextFilter::PassFilter: the first matching term decides, strings
+     * matching no term only pass if there are no include terms. Each term scans the whole pool
+     * once, a hit is mapped to its string through the offsets and the scan continues at the start
+     * of the next string.
+     */
+    auto decide() -> void {
+        decisions.assign(static_cast<size_t>(count()), decision::none);
+        auto const text = std::string_view(pool.data(), pool.size());
+
+        for (auto const& t : terms) {
+            auto const verdict = t.exclude ? decision::fail : decision::pass;
+            auto from = 0uz;
+
+            while ((from = find_lower(text, t.text, from)) != std::string_view::npos) {
+                auto const next = std::ranges::upper_bound(offsets, static_cast<uint32_t>(from));
+                auto const end = static_cast<size_t>(*next);
+
+                // Matches spanning two strings don't count.
+                if (from + t.text.size() > end) {
+                    from++;
+                    continue;
+                }
+
+                auto& d = decisions[static_cast<size_t>(next - offsets.begin()) - 1];
+                if (d == decision::none)
+                    d = verdict;
+                from = end;
+            }
+        }
+    }
+};
+
+/**
+ * Owns an ImGuiTextFilter, which Dear ImGui marks as internal so it isn't generated. Its ranges
+ * are allocated by Dear ImGui and freed here, since the C struct has no destructor.
+ */
+struct text_filter {
+    ImGuiTextFilter filter = {};
+
+    explicit text_filter(std::string const& text) {
+        set(text);
+    }
+
+    text_filter(text_filter const&) = delete;
+    auto operator=(text_filter const&) -> text_filter& = delete;
+
+    ~text_filter() {
+        ImGui_MemFree(filter.Filters.Data);
+    }
+
+    /**
+     * Replaces the filter text, truncated to the size of the input buffer, and parses it.
+     */
+    auto set(std::string const& text) -> void {
+        auto const size = std::min(text.size(), sizeof(filter.InputBuf) - 1);
+        std::memcpy(filter.InputBuf, text.data(), size);
+        filter.InputBuf[size] = '\0';
+        ImGuiTextFilter_Build(&filter);
+    }
+};
+
+/**
+ * Append-only log whose visible lines are drawn natively through an ImGuiListClipper. JS encodes
+ * UTF-8 text straight into the buffer (`reserve`, then `commit` the written bytes) and only the
+ * new bytes are scanned to extend the index of line starts. Beyond `max_lines` lines or
+ * `max_bytes` bytes the oldest lines are evicted, their bytes are reclaimed by moving the live
+ * text to the front once they make up half of the buffer.
+ */
+struct LogBuffer {
+    std::vector<char, default_init_allocator<char>> text;
+    std::vector<uint32_t> starts = {0};
+    size_t first = 0;
+    size_t pending = 0;
+    size_t max_lines;
+    size_t max_bytes;
+
+    LogBuffer(int max_lines, int max_bytes)
+        : max_lines(static_cast<size_t>(std::max(max_lines, 1))),
+          max_bytes(static_cast<size_t>(std::max(max_bytes, 1))) {}
+
+    /**
+     * The number of lines, not counting an empty last line after a trailing newline.
+     */
+    [[nodiscard]] auto line_count() const -> size_t {
+        auto const open_empty = starts.back() == text.size();
+        return starts.size() - first - (open_empty ? 1 : 0);
+    }
+
+    [[nodiscard]] auto byte_count() const -> size_t {
+        return text.size() - starts[first];
+    }
+
+    /**
+     * The text of a kept line without its line ending, `index` counting from the oldest one.
+     */
+    [[nodiscard]] auto line(size_t index) const -> std::string_view {
+        return index < line_count() ? get_line(first + index) : std::string_view();
+    }
+
+    /**
+     * Returns uninitialized space for `size` bytes at the end of the log, valid until `commit`.
+     */
+    auto reserve(size_t size) -> char* {
+        pending = text.size();
+        text.resize(pending + size);
+        return text.data() + pending;
+    }
+
+    /**
+     * Keeps the first `written` reserved bytes, indexes the lines they end and evicts the oldest
+     * lines over the limits. A line without a trailing newline is continued by the next commit,
+     * unless it grows past `max_bytes` and is split so it can be evicted as well.
+     */
+    auto commit(size_t written) -> void {
+        auto const from = pending;
+        text.resize(from + std::min(written, text.size() - from));
+        pending = text.size();
+
+        auto const* const data = text.data();
+        for (auto pos = from; pos < text.size();) {
+            auto const* const newline = static_cast<char const*>(
+                std::memchr(data + pos, '\n', text.size() - pos)
+            );
+            if (!newline)
+                break;
+
+            pos = static_cast<size_t>(newline - data) + 1;
+            starts.push_back(static_cast<uint32_t>(pos));
+        }
+
+        split_open_line();
+        evict();
+    }
+
+    auto clear() -> void {
+        text.clear();
+        starts.assign(1, 0);
+        first = 0;
+        pending = 0;
+    }
+
+    /**
+     * Draws the lines in a child window, keeping it scrolled to the bottom while it is there if
+     * `auto_scroll` is set.
+     */
+    auto render(const char* id, ImVec2 size, bool auto_scroll) -> void {
+        if (ImGui_BeginChild(id, size, 0, ImGuiWindowFlags_HorizontalScrollbar)) {
+            ImGui_PushStyleVarImVec2(ImGuiStyleVar_ItemSpacing, ImVec2{0.0f, 0.0f});
+
+            auto clipper = ImGuiListClipper{};
+            ImGuiListClipper_Begin(&clipper, static_cast<int>(line_count()), -1.0f);
+
+            while (ImGuiListClipper_Step(&clipper)) {
+                for (auto i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                    auto const line = get_line(first + static_cast<size_t>(i));
+                    ImGui_TextUnformatted(line.data(), line.data() + line.size());
+                }
+            }
+
+            ImGui_PopStyleVar(1);
+
+            if (auto_scroll && ImGui_GetScrollY() >= ImGui_GetScrollMaxY())
+                ImGui_SetScrollHereY(1.0f);
+        }
+        ImGui_EndChild();
+    }
+
+  private:
+    [[nodiscard]] auto get_line(size_t index) const -> std::string_view {
+        auto const begin = static_cast<size_t>(starts[index]);
+        auto end = index + 1 < starts.size() ? static_cast<size_t>(starts[index + 1]) : text.size();
+        if (end > begin && text[end - 1] == '\n')
+            end--;
+        if (end > begin && text[end - 1] == '\r')
+            end--;
+
+        return {text.data() + begin, end - begin};
+    }
+
+    /**
+     * Breaks the unterminated last line into lines of at most `max_bytes`, at UTF-8 character
+     * boundaries, so a stream without newlines doesn't grow the log past its limit.
+     */
+    auto split_open_line() -> void {
+        while (text.size() - starts.back() > max_bytes) {
+            auto const start = static_cast<size_t>(starts.back());
+            auto split = start + max_bytes;
+            while (split > start + 1 && (static_cast<unsigned char>(text[split]) & 0xC0) == 0x80)
+                split--;
+
+            starts.push_back(static_cast<uint32_t>(split));
+        }
+    }
+
+    auto evict() -> void {
+        while (starts.size() - first > 1 &&
+               (line_count() > max_lines || byte_count() > max_bytes))
+            first++;
+
+        auto const head = static_cast<size_t>(starts[first]);
+        if (head == 0 || (head < text.size() - head && first < starts.size() - first))
+            return;
+
+        text.erase(text.begin(), text.begin() + static_cast<ptrdiff_t>(head));
+        starts.erase(starts.begin(), starts.begin() + static_cast<ptrdiff_t>(first));
+        for (auto& start : starts)
+            start -= static_cast<uint32_t>(head);
+
+        first = 0;
+        pending = text.size();
+    }
+};
+
+/**
+ * Call count and cumulative time in milliseconds of a binding. Only recorded when the bindings are
+ * generated with instrumentation (`node build.ts --instrument`).
+ */
+struct binding_counter {
+    const char* name;
+    uint32_t calls = 0;
+    double time = 0.0;
+};
+
+static auto binding_counters = std::deque<binding_counter>();
+static auto binding_timing = false;
+
+static auto register_binding(const char* name) -> binding_counter& {
+    return binding_counters.emplace_back(binding_counter{.name = name});
+}
+
+/**
+ * Counts a call of an instrumented binding for the duration of its body, and measures it with
+ * emscripten_get_now() while timing is enabled.
+ */
+struct binding_scope {
+    binding_counter& counter;
+    bool timed;
+    double start;
+
+    explicit binding_scope(binding_counter& counter)
+        : counter(counter), timed(binding_timing), start(timed ? emscripten_get_now() : 0.0) {
+        ++counter.calls;
+    }
+
+    binding_scope(binding_scope const&) = delete;
+    auto operator=(binding_scope const&) -> binding_scope& = delete;
+
+    ~binding_scope() {
+        if (timed)
+            counter.time += emscripten_get_now() - start;
+    }
+};
+
+/**
+ * Interned strings, referenced by id from JS. A deque keeps the strings (and their c_str()) at a
+ * stable address for the lifetime of the module.
+ */
+static auto interned_strings = std::deque<std::string>();
+static auto interned_ids = std::unordered_map<std::string_view, int>();
+
+static auto intern_string(std::string str) -> int {
+    if (auto const it = interned_ids.find(str); it != interned_ids.end())
+        return it->second;
+
+    auto const id = static_cast<int>(interned_strings.size());
+    auto const& stored = interned_strings.emplace_back(std::move(str));
+    interned_ids.emplace(stored, id);
+    return id;
+}
+
+static auto get_interned_string(int id) -> const char* {
+    if (id < 0 || static_cast<size_t>(id) >= interned_strings.size())
+        return "";
+
+    return interned_strings[static_cast<size_t>(id)].c_str();
+}
+
+/**
+ * Opcodes of the command buffer executed by ExecuteCommandBuffer. Keep in sync with `CommandOp`
+ * in imgui.ts.
+ */
+enum class command_op : int32_t {
+    Begin = 1,
+    End,
+    BeginChild,
+    EndChild,
+    Text,
+    TextColored,
+    TextDisabled,
+    TextWrapped,
+    LabelText,
+    BulletText,
+    SeparatorText,
+    Button,
+    SmallButton,
+    Checkbox,
+    RadioButton,
+    SliderFloat,
+    SliderInt,
+    DragFloat,
+    DragInt,
+    Selectable,
+    TreeNode,
+    TreePop,
+    CollapsingHeader,
+    Separator,
+    SameLine,
+    NewLine,
+    Spacing,
+    Dummy,
+    Indent,
+    Unindent,
+    PushID,
+    PopID,
+    SetNextItemWidth,
+    PushStyleColor,
+    PopStyleColor,
+    IsItemHovered,
+    IsItemClicked,
+    BeginTable,
+    EndTable,
+    TableNextRow,
+    TableNextColumn,
+    TableSetColumnIndex,
+    TableSetupColumn,
+    TableHeadersRow,
+    ProgressBar,
+    BeginMenuBar,
+    EndMenuBar,
+    BeginMenu,
+    EndMenu,
+    MenuItem,
+};
+
+/**
+ * Reads the 32-bit words of a command buffer. Strings are either an interned string id (>= 0) or
+ * a negative byte length (including the NUL terminator) followed by the inline UTF-8 bytes,
+ * padded to a multiple of 4. Reads past the end or of a malformed inline string return 0 or ""
+ * and clear `valid`, ExecuteCommandBuffer uses that to check a buffer before running it.
+ */
+struct command_reader {
+    int32_t const* pos;
+    int32_t const* end;
+    bool valid = true;
+
+    auto read_int() -> int32_t {
+        if (pos < end)
+            return *pos++;
+
+        valid = false;
+        return 0;
+    }
+
+    auto read_float() -> float {
+        return std::bit_cast<float>(read_int());
+    }
+
+    auto read_bool() -> bool {
+        return read_int() != 0;
+    }
+
+    auto read_vec2() -> ImVec2 {
+        return ImVec2{read_float(), read_float()};
+    }
+
+    auto read_vec4() -> ImVec4 {
+        return ImVec4{read_float(), read_float(), read_float(), read_float()};
+    }
+
+    auto read_str() -> const char* {
+        auto const id = read_int();
+        if (id >= 0)
+            return get_interned_string(id);
+
+        auto const size = -static_cast<int64_t>(id);
+        auto const words = (size + 3) / 4;
+        auto const* str = reinterpret_cast<const char*>(pos);
+        if (words > end - pos || str[size - 1] != '\0') {
+            valid = false;
+            pos = end;
+            return "";
+        }
+
+        pos += words;
+        return str;
+    }
+};
+
+/**
+ * Writes the return values of the executed commands, one 32-bit word each.
+ */
+struct result_writer {
+    int32_t* pos;
+    int count = 0;
+
+    auto write_int(int32_t value) -> void {
+        *pos++ = value;
+        ++count;
+    }
+
+    auto write_float(float value) -> void {
+        write_int(std::bit_cast<int32_t>(value));
+    }
+
+    auto write_bool(bool value) -> void {
+        write_int(value ? 1 : 0);
+    }
+};
+
+/**
+ * The arguments of each command, in the order execute_command reads them: 's' a string, 'w' a
+ * 32-bit word (int, float, bool or one component of a vector). Keep in sync with execute_command.
+ * Returns nothing for unknown opcodes.
+ */
+static auto command_args(command_op op) -> std::optional<std::string_view> {
+    switch (op) {
+    case command_op::Begin:
+        return "sw";
+    case command_op::End:
+        return "";
+    case command_op::BeginChild:
+        return "swwww";
+    case command_op::EndChild:
+        return "";
+    case command_op::Text:
+        return "s";
+    case command_op::TextColored:
+        return "wwwws";
+    case command_op::TextDisabled:
+        return "s";
+    case command_op::TextWrapped:
+        return "s";
+    case command_op::LabelText:
+        return "ss";
+    case command_op::BulletText:
+        return "s";
+    case command_op::SeparatorText:
+        return "s";
+    case command_op::Button:
+        return "sww";
+    case command_op::SmallButton:
+        return "s";
+    case command_op::Checkbox:
+        return "sw";
+    case command_op::RadioButton:
+        return "sw";
+    case command_op::SliderFloat:
+        return "swwwsw";
+    case command_op::SliderInt:
+        return "swwwsw";
+    case command_op::DragFloat:
+        return "swwwwsw";
+    case command_op::DragInt:
+        return "swwwwsw";
+    case command_op::Selectable:
+        return "swwww";
+    case command_op::TreeNode:
+        return "s";
+    case command_op::TreePop:
+        return "";
+    case command_op::CollapsingHeader:
+        return "sw";
+    case command_op::Separator:
+        return "";
+    case command_op::SameLine:
+        return "ww";
+    case command_op::NewLine:
+        return "";
+    case command_op::Spacing:
+        return "";
+    case command_op::Dummy:
+        return "ww";
+    case command_op::Indent:
+        return "w";
+    case command_op::Unindent:
+        return "w";
+    case command_op::PushID:
+        return "s";
+    case command_op::PopID:
+        return "";
+    case command_op::SetNextItemWidth:
+        return "w";
+    case command_op::PushStyleColor:
+        return "ww";
+    case command_op::PopStyleColor:
+        return "w";
+    case command_op::IsItemHovered:
+        return "w";
+    case command_op::IsItemClicked:
+        return "w";
+    case command_op::BeginTable:
+        return "swwwww";
+    case command_op::EndTable:
+        return "";
+    case command_op::TableNextRow:
+        return "ww";
+    case command_op::TableNextColumn:
+        return "";
+    case command_op::TableSetColumnIndex:
+        return "w";
+    case command_op::TableSetupColumn:
+        return "swww";
+    case command_op::TableHeadersRow:
+        return "";
+    case command_op::ProgressBar:
+        return "wwws";
+    case command_op::BeginMenuBar:
+        return "";
+    case command_op::EndMenuBar:
+        return "";
+    case command_op::BeginMenu:
+        return "sw";
+    case command_op::EndMenu:
+        return "";
+    case command_op::MenuItem:
+        return "ssww";
+    }
+
+    return std::nullopt;
+}
+
+/**
+ * Skips over the arguments of a command, returns whether they are all in the buffer and well
+ * formed.
+ */
+static auto skip_command(command_op op, command_reader& in) -> bool {
+    auto const args = command_args(op);
+    if (!args)
+        return false;
+
+    for (auto const arg : *args) {
+        if (arg == 's')
+            in.read_str();
+        else
+            in.read_int();
+    }
+
+    return in.valid;
+}
+
+// NOTE: Arguments are read into locals first, since the evaluation order of function arguments
+// is unspecified.
+static auto execute_command(command_op op, command_reader& in, result_writer& out) -> bool {
+    switch (op) {
+    case command_op::Begin: {
+        auto const name = in.read_str();
+        auto const flags = in.read_int();
+        out.write_bool(ImGui_Begin(name, nullptr, flags));
+        return true;
+    }
+    case command_op::End:
+        ImGui_End();
+        return true;
+    case command_op::BeginChild: {
+        auto const str_id = in.read_str();
+        auto const size = in.read_vec2();
+        auto const child_flags = in.read_int();
+        auto const window_flags = in.read_int();
+        out.write_bool(ImGui_BeginChild(str_id, size, child_flags, window_flags));
+        return true;
+    }
+    case command_op::EndChild:
+        ImGui_EndChild();
+        return true;
+    case command_op::Text:
+        ImGui_TextUnformatted(in.read_str(), nullptr);
+        return true;
+    case command_op::TextColored: {
+        auto const col = in.read_vec4();
+        auto const text = in.read_str();
+        ImGui_TextColored(col, "%s", text);
+        return true;
+    }
+    case command_op::TextDisabled:
+        ImGui_TextDisabled("%s", in.read_str());
+        return true;
+    case command_op::TextWrapped:
+        ImGui_TextWrapped("%s", in.read_str());
+        return true;
+    case command_op::LabelText: {
+        auto const label = in.read_str();
+        auto const text = in.read_str();
+        ImGui_LabelText(label, "%s", text);
+        return true;
+    }
+    case command_op::BulletText:
+        ImGui_BulletText("%s", in.read_str());
+        return true;
+    case command_op::SeparatorText:
+        ImGui_SeparatorText(in.read_str());
+        return true;
+    case command_op::Button: {
+        auto const label = in.read_str();
+        auto const size = in.read_vec2();
+        out.write_bool(ImGui_Button(label, size));
+        return true;
+    }
+    case command_op::SmallButton:
+        out.write_bool(ImGui_SmallButton(in.read_str()));
+        return true;
+    case command_op::Checkbox: {
+        auto const label = in.read_str();
+        auto value = in.read_bool();
+        out.write_bool(ImGui_Checkbox(label, &value));
+        out.write_bool(value);
+        return true;
+    }
+    case command_op::RadioButton: {
+        auto const label = in.read_str();
+        auto const active = in.read_bool();
+        out.write_bool(ImGui_RadioButton(label, active));
+        return true;
+    }
+    case command_op::SliderFloat: {
+        auto const label = in.read_str();
+        auto value = in.read_float();
+        auto const v_min = in.read_float();
+        auto const v_max = in.read_float();
+        auto const format = in.read_str();
+        auto const flags = in.read_int();
+        out.write_bool(ImGui_SliderFloat(label, &value, v_min, v_max, format, flags));
+        out.write_float(value);
+        return true;
+    }
+    case command_op::SliderInt: {
+        auto const label = in.read_str();
+        auto value = in.read_int();
+        auto const v_min = in.read_int();
+        auto const v_max = in.read_int();
+        auto const format = in.read_str();
+        auto const flags = in.read_int();
+        out.write_bool(ImGui_SliderInt(label, &value, v_min, v_max, format, flags));
+        out.write_int(value);
+        return true;
+    }
+    case command_op::DragFloat: {
+        auto const label = in.read_str();
+        auto value = in.read_float();
+        auto const v_speed = in.read_float();
+        auto const v_min = in.read_float();
+        auto const v_max = in.read_float();
+        auto const format = in.read_str();
+        auto const flags = in.read_int();
+        out.write_bool(ImGui_DragFloat(label, &value, v_speed, v_min, v_max, format, flags));
+        out.write_float(value);
+        return true;
+    }
+    case command_op::DragInt: {
+        auto const label = in.read_str();
+        auto value = in.read_int();
+        auto const v_speed = in.read_float();
+        auto const v_min = in.read_int();
+        auto const v_max = in.read_int();
+        auto const format = in.read_str();
+        auto const flags = in.read_int();
+        out.write_bool(ImGui_DragInt(label, &value, v_speed, v_min, v_max, format, flags));
+        out.write_int(value);
+        return true;
+    }
+    case command_op::Selectable: {
+        auto const label = in.read_str();
+        auto const selected = in.read_bool();
+        auto const flags = in.read_int();
+        auto const size = in.read_vec2();
+        out.write_bool(ImGui_Selectable(label, selected, flags, size));
+        return true;
+    }
+    case command_op::TreeNode:
+        out.write_bool(ImGui_TreeNode(in.read_str()));
+        return true;
+    case command_op::TreePop:
+        ImGui_TreePop();
+        return true;
+    case command_op::CollapsingHeader: {
+        auto const label = in.read_str();
+        auto const flags = in.read_int();
+        out.write_bool(ImGui_CollapsingHeader(label, flags));
+        return true;
+    }
+    case command_op::Separator:
+        ImGui_Separator();
+        return true;
+    case command_op::SameLine: {
+        auto const offset_from_start_x = in.read_float();
+        auto const spacing = in.read_float();
+        ImGui_SameLine(offset_from_start_x, spacing);
+        return true;
+    }
+    case command_op::NewLine:
+        ImGui_NewLine();
+        return true;
+    case command_op::Spacing:
+        ImGui_Spacing();
+        return true;
+    case command_op::Dummy:
+        ImGui_Dummy(in.read_vec2());
+        return true;
+    case command_op::Indent:
+        ImGui_Indent(in.read_float());
+        return true;
+    case command_op::Unindent:
+        ImGui_Unindent(in.read_float());
+        return true;
+    case command_op::PushID:
+        ImGui_PushID(in.read_str());
+        return true;
+    case command_op::PopID:
+        ImGui_PopID();
+        return true;
+    case command_op::SetNextItemWidth:
+        ImGui_SetNextItemWidth(in.read_float());
+        return true;
+    case command_op::PushStyleColor: {
+        auto const idx = in.read_int();
+        auto const col = static_cast<ImU32>(in.read_int());
+        ImGui_PushStyleColor(idx, col);
+        return true;
+    }
+    case command_op::PopStyleColor:
+        ImGui_PopStyleColor(in.read_int());
+        return true;
+    case command_op::IsItemHovered:
+        out.write_bool(ImGui_IsItemHovered(in.read_int()));
+        return true;
+    case command_op::IsItemClicked:
+        out.write_bool(ImGui_IsItemClicked(in.read_int()));
+        return true;
+    case command_op::BeginTable: {
+        auto const str_id = in.read_str();
+        auto const columns = in.read_int();
+        auto const flags = in.read_int();
+        auto const outer_size = in.read_vec2();
+        auto const inner_width = in.read_float();
+        out.write_bool(ImGui_BeginTable(str_id, columns, flags, outer_size, inner_width));
+        return true;
+    }
+    case command_op::EndTable:
+        ImGui_EndTable();
+        return true;
+    case command_op::TableNextRow: {
+        auto const row_flags = in.read_int();
+        auto const min_row_height = in.read_float();
+        ImGui_TableNextRow(row_flags, min_row_height);
+        return true;
+    }
+    case command_op::TableNextColumn:
+        out.write_bool(ImGui_TableNextColumn());
+        return true;
+    case command_op::TableSetColumnIndex:
+        out.write_bool(ImGui_TableSetColumnIndex(in.read_int()));
+        return true;
+    case command_op::TableSetupColumn: {
+        auto const label = in.read_str();
+        auto const flags = in.read_int();
+        auto const init_width_or_weight = in.read_float();
+        auto const user_id = static_cast<ImGuiID>(in.read_int());
+        ImGui_TableSetupColumn(label, flags, init_width_or_weight, user_id);
+        return true;
+    }
+    case command_op::TableHeadersRow:
+        ImGui_TableHeadersRow();
+        return true;
+    case command_op::ProgressBar: {
+        auto const fraction = in.read_float();
+        auto const size = in.read_vec2();
+        auto const overlay = in.read_str();
+        ImGui_ProgressBar(fraction, size, *overlay ? overlay : nullptr);
+        return true;
+    }
+    case command_op::BeginMenuBar:
+        out.write_bool(ImGui_BeginMenuBar());
+        return true;
+    case command_op::EndMenuBar:
+        ImGui_EndMenuBar();
+        return true;
+    case command_op::BeginMenu: {
+        auto const label = in.read_str();
+        auto const enabled = in.read_bool();
+        out.write_bool(ImGui_BeginMenu(label, enabled));
+        return true;
+    }
+    case command_op::EndMenu:
+        ImGui_EndMenu();
+        return true;
+    case command_op::MenuItem: {
+        auto const label = in.read_str();
+        auto const shortcut = in.read_str();
+        auto const selected = in.read_bool();
+        auto const enabled = in.read_bool();
+        out.write_bool(ImGui_MenuItem(label, *shortcut ? shortcut : nullptr, selected, enabled));
+        return true;
+    }
+    }
+
+    return false;
+}
+
+/**
+ * Ring buffer of input events which JS writes straight into the WASM heap, so browser events don't
+ * cross into WASM one by one. Keep in sync with `InputRingBuffer` in imgui.ts. The header words are
+ * head (only written here), tail (only written by JS) and the capacity, followed by records of one
+ * type word and three float payload words.
+ */
+enum class input_event_type : int32_t {
+    mouse_pos,
+    mouse_button,
+    mouse_wheel,
+    key,
+    character,
+    focus,
+};
+
+struct input_event {
+    input_event_type type;
+    float a;
+    float b;
+    float c;
+};
+
+struct input_ring {
+    static constexpr auto capacity = 1024u;
+
+    uint32_t head = 0;
+    uint32_t tail = 0;
+    uint32_t const size = capacity;
+    uint32_t padding = 0;
+    std::array<input_event, capacity> events{};
+
+    [[nodiscard]] auto pending() -> bool {
+        return std::atomic_ref(tail).load(std::memory_order_acquire) != head;
+    }
+
+    /**
+     * Replays the queued events into the ImGuiIO. Runs of mouse moves are coalesced into their
+     * last position, since Dear ImGui only looks at the position once per frame anyway, while
+     * button and key events still see the position they happened at. Returns the number of events
+     * consumed.
+     */
+    auto drain(ImGuiIO* io) -> int {
+        auto const end = std::atomic_ref(tail).load(std::memory_order_acquire);
+        auto const count = static_cast<int>(end - head);
+        auto mouse_pos = std::optional<ImVec2>();
+
+        for (; head != end; head++) {
+            auto const& event = events[head & (capacity - 1)];
+
+            if (event.type == input_event_type::mouse_pos) {
+                mouse_pos = ImVec2{event.a, event.b};
+                continue;
+            }
+
+            if (mouse_pos) {
+                ImGuiIO_AddMousePosEvent(io, mouse_pos->x, mouse_pos->y);
+                mouse_pos.reset();
+            }
+
+            switch (event.type) {
+            case input_event_type::mouse_button:
+                ImGuiIO_AddMouseButtonEvent(io, static_cast<int>(event.a), event.b != 0.0f);
+                break;
+            case input_event_type::mouse_wheel:
+                ImGuiIO_AddMouseWheelEvent(io, event.a, event.b);
+                break;
+            case input_event_type::key:
+                ImGuiIO_AddKeyEvent(io, static_cast<ImGuiKey>(event.a), event.b != 0.0f);
+                break;
+            case input_event_type::character:
+                ImGuiIO_AddInputCharacter(io, static_cast<unsigned int>(event.a));
+                break;
+            case input_event_type::focus:
+                ImGuiIO_AddFocusEvent(io, event.a != 0.0f);
+                break;
+            default:
+                break;
+            }
+        }
+
+        if (mouse_pos)
+            ImGuiIO_AddMousePosEvent(io, mouse_pos->x, mouse_pos->y);
+
+        // Releases the records to JS.
+        std::atomic_ref(head).store(end, std::memory_order_release);
+        return count;
+    }
+};
+
+static auto input_events = input_ring();
+
+/**
+ * Packed layout of an ImDrawData for renderers reading the vertex and index buffers directly out
+ * of the WASM heap. Keep in sync with `GetDrawDataView` in imgui.ts. All values are 32-bit words:
+ *
+ * - Header: CmdListsCount, TotalVtxCount, TotalIdxCount, DisplayPos, DisplaySize, FramebufferScale
+ * - Per draw list: VtxBuffer address, vertex count, IdxBuffer address, index count, word offset of
+ *   the first command, command count, whether the list changed since the last frame (always 1
+ *   without draw data diffing)
+ * - Per draw command: ClipRect, texture id, ElemCount, IdxOffset, VtxOffset
+ *
+ * Floats are stored as their bits. The vector is reused, so steady-state frames don't allocate.
+ */
+constexpr auto draw_data_header_size = 9uz;
+constexpr auto draw_list_stride = 7uz;
+constexpr auto draw_cmd_stride = 8uz;
+
+static auto draw_data_layout = std::vector<int32_t>();
+
+/**
+ * Hashes the content of each draw list to find the lists which changed since the last hashed
+ * frame. Renderers can keep the GPU buffers of unchanged lists and skip re-uploading the frame if
+ * nothing changed at all. Pending texture work (any texture not ImTextureStatus_OK) counts as a
+ * change. A frame is only hashed once something asks for its changes, see resolve().
+ */
+struct draw_data_diff {
+    bool enabled = false;
+    bool changed = true;
+    int hashed_frame = -1;
+    uint64_t header_hash = 0;
+    std::vector<uint64_t> list_hashes;
+    std::vector<uint8_t> list_changed;
+
+    static auto hash_bytes(void const* data, size_t size, uint64_t hash) -> uint64_t {
+        constexpr auto multiplier = 0x9e3779b97f4a7c15ull;
+
+        auto const* bytes = static_cast<unsigned char const*>(data);
+        auto i = 0uz;
+
+        for (; i + 8 <= size; i += 8) {
+            auto word = uint64_t{};
+            std::memcpy(&word, bytes + i, sizeof(word));
+            hash = (hash ^ word) * multiplier;
+            hash ^= hash >> 29;
+        }
+
+        for (; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * multiplier;
+        }
+
+        return hash;
+    }
+
+    template <typename T>
+    static auto hash_vector(T const* data, int size, uint64_t hash) -> uint64_t {
+        hash = hash_bytes(&size, sizeof(size), hash);
+        return hash_bytes(data, static_cast<size_t>(size) * sizeof(T), hash);
+    }
+
+    static auto hash_list(ImDrawList const* list) -> uint64_t {
+        auto hash = hash_vector(list->VtxBuffer.Data, list->VtxBuffer.Size, 0);
+        hash = hash_vector(list->IdxBuffer.Data, list->IdxBuffer.Size, hash);
+
+        // The command struct contains padding, so only hash its fields.
+        for (auto const& cmd : std::span(list->CmdBuffer.Data, list->CmdBuffer.Size)) {
+            auto const* tex_data = cmd.TexRef._TexData;
+            auto const fields = std::array<uint64_t, 7>{
+                std::bit_cast<uint64_t>(std::array{cmd.ClipRect.x, cmd.ClipRect.y}),
+                std::bit_cast<uint64_t>(std::array{cmd.ClipRect.z, cmd.ClipRect.w}),
+                tex_data ? tex_data->TexID : cmd.TexRef._TexID,
+                cmd.ElemCount,
+                cmd.IdxOffset,
+                cmd.VtxOffset,
+                reinterpret_cast<uintptr_t>(cmd.UserCallback),
+            };
+            hash = hash_bytes(fields.data(), sizeof(fields), hash);
+        }
+
+        return hash;
+    }
+
+    static auto has_texture_updates(ImDrawData const* draw_data) -> bool {
+        if (!draw_data->Textures)
+            return false;
+
+        auto const textures = std::span(draw_data->Textures->Data, draw_data->Textures->Size);
+        return std::ranges::any_of(textures, [](ImTextureData const* tex) {
+            return tex->Status != ImTextureStatus_OK;
+        });
+    }
+
+    /**
+     * Compares the draw data with the last frame, returns whether anything changed.
+     */
+    auto update(ImDrawData const* draw_data) -> bool {
+        auto const lists = std::span(draw_data->CmdLists.Data, draw_data->CmdListsCount);
+        auto const header = std::array{
+            draw_data->DisplayPos.x,
+            draw_data->DisplayPos.y,
+            draw_data->DisplaySize.x,
+            draw_data->DisplaySize.y,
+            draw_data->FramebufferScale.x,
+            draw_data->FramebufferScale.y,
+        };
+
+        auto const new_header_hash = hash_vector(header.data(), static_cast<int>(header.size()), 0);
+        changed = new_header_hash != header_hash || lists.size() != list_hashes.size() ||
+                  has_texture_updates(draw_data);
+        header_hash = new_header_hash;
+
+        list_hashes.resize(lists.size());
+        list_changed.resize(lists.size());
+
+        for (auto const idx : std::views::iota(0uz, lists.size())) {
+            auto const hash = hash_list(lists[idx]);
+
+            list_changed[idx] = hash != list_hashes[idx];
+            list_hashes[idx] = hash;
+            changed = changed || list_changed[idx];
+        }
+
+        return changed;
+    }
+
+    /**
+     * Hashes the draw data of the last rendered frame, unless that already happened, and returns
+     * whether it changed. Frames nobody asks about aren't hashed, the next one is then compared
+     * with the last hashed frame.
+     */
+    auto resolve() -> bool {
+        auto const* ctx = ImGui_GetCurrentContext();
+        auto const* draw_data = ImGui_GetDrawData();
+        if (!enabled || !ctx || !draw_data || ctx->FrameCountRendered == hashed_frame)
+            return changed;
+
+        hashed_frame = ctx->FrameCountRendered;
+        return update(draw_data);
+    }
+
+    [[nodiscard]] auto is_list_changed(size_t idx) const -> bool {
+        return !enabled || idx >= list_changed.size() || list_changed[idx];
+    }
+};
 
-template <typename Fn>
-constexpr auto override(Fn&& fn) {
-    return emscripten::optional_override(std::forward<Fn>(fn));
+static auto draw_data_changes = draw_data_diff();
+
+/**
+ * Whether another frame has to be rendered: input events are pending, the last frame changed
+ * or something animates without input (text cursor blink, hover delays, modal dimming, ...).
+ * Lazy render loops sleep while this is false.
+ */
+static auto needs_redraw() -> bool {
+    auto const* ctx = ImGui_GetCurrentContext();
+    if (!ctx)
+        return false;
+
+    auto const& g = *ctx;
+    auto const mouse_down = std::ranges::any_of(g.IO.MouseDown, [](bool down) { return down; });
+    auto const hover_delay = g.Style.HoverDelayNormal + g.Style.HoverStationaryDelay;
+
+    return g.InputEventsQueue.Size > 0 || input_events.pending() || draw_data_changes.resolve() ||
+           g.ActiveId != 0 || mouse_down || (g.HoveredId != 0 && g.HoveredIdTimer < hover_delay) ||
+           (g.DimBgRatio > 0.0f && g.DimBgRatio < 1.0f) || g.NavWindowingTarget != nullptr;
 }
 
-template <typename Fn, typename... Policies>
-constexpr auto bind_fn(const char* name, Fn&& fn, Policies&&... policies) -> void {
-    return emscripten::function(
-        name,
-        emscripten::optional_override(std::forward<Fn>(fn)),
-        std::forward<Policies>(policies)...
-    );
+template <typename T>
+constexpr auto layout_word(T value) -> int32_t {
+    if constexpr (std::is_same_v<T, float>)
+        return std::bit_cast<int32_t>(value);
+    else
+        return static_cast<int32_t>(value);
 }
 
-template <typename T>
-constexpr auto bind_struct(const char* name) -> emscripten::class_<T> {
-    return emscripten::class_<T>(name);
+static auto write_draw_data_header(std::vector<int32_t>& out, ImDrawData const* draw_data) -> void {
+    out.insert(out.end(), {
+        layout_word(draw_data->CmdListsCount),
+        layout_word(draw_data->TotalVtxCount),
+        layout_word(draw_data->TotalIdxCount),
+        layout_word(draw_data->DisplayPos.x),
+        layout_word(draw_data->DisplayPos.y),
+        layout_word(draw_data->DisplaySize.x),
+        layout_word(draw_data->DisplaySize.y),
+        layout_word(draw_data->FramebufferScale.x),
+        layout_word(draw_data->FramebufferScale.y),
+    });
 }
 
-template <typename T, size_t N>
-struct array_param {
-    std::array<T, N> arr = {};
-    T* ptr = nullptr;
-};
+static auto write_draw_cmd(
+    std::vector<int32_t>& out,
+    ImDrawCmd const& cmd,
+    unsigned int idx_offset,
+    unsigned int vtx_offset
+) -> void {
+    // Commands with a user callback can't be drawn by JS, they are left without elements.
+    auto const* tex_data = cmd.TexRef._TexData;
+    auto const tex_id = tex_data ? tex_data->TexID : cmd.TexRef._TexID;
+
+    out.insert(out.end(), {
+        layout_word(cmd.ClipRect.x),
+        layout_word(cmd.ClipRect.y),
+        layout_word(cmd.ClipRect.z),
+        layout_word(cmd.ClipRect.w),
+        layout_word(tex_id),
+        layout_word(cmd.UserCallback ? 0u : cmd.ElemCount),
+        layout_word(idx_offset),
+        layout_word(vtx_offset),
+    });
+}
 
-template <typename T, size_t N>
-inline auto get_array_param(js_val const& v) -> array_param<T, N> {
-    array_param<T, N> out{};
+static auto write_draw_data_layout(ImDrawData const* draw_data) -> int32_t const* {
+    auto& out = draw_data_layout;
+    out.clear();
+    draw_data_changes.resolve();
+
+    auto const lists = std::span(draw_data->CmdLists.Data, draw_data->CmdListsCount);
+    write_draw_data_header(out, draw_data);
+
+    auto cmd_offset = draw_data_header_size + lists.size() * draw_list_stride;
+    for (auto const idx : std::views::iota(0uz, lists.size())) {
+        auto const* list = lists[idx];
+        out.insert(out.end(), {
+            layout_word(reinterpret_cast<uintptr_t>(list->VtxBuffer.Data)),
+            layout_word(list->VtxBuffer.Size),
+            layout_word(reinterpret_cast<uintptr_t>(list->IdxBuffer.Data)),
+            layout_word(list->IdxBuffer.Size),
+            layout_word(cmd_offset),
+            layout_word(list->CmdBuffer.Size),
+            layout_word(draw_data_changes.is_list_changed(idx)),
+        });
+        cmd_offset += static_cast<size_t>(list->CmdBuffer.Size) * draw_cmd_stride;
+    }
 
-    if (v.isNull() || v.isUndefined() || !v.isArray())
-        return out;
+    for (auto const* list : lists) {
+        for (auto const& cmd : std::span(list->CmdBuffer.Data, list->CmdBuffer.Size)) {
+            write_draw_cmd(out, cmd, cmd.IdxOffset, cmd.VtxOffset);
+        }
+    }
 
-    auto const len = v["length"].as<size_t>();
-    if (len <= 0 || len > N)
-        return out;
+    return out.data();
+}
 
-    for (auto const i : std::views::iota(0uz, len)) {
-        out.arr[i] = v[i].as<T>();
+/**
+ * All draw lists of an ImDrawData packed into one vertex and one index buffer, so a frame can be
+ * uploaded with a single call each. Keep in sync with `GetMergedDrawDataView` in imgui.ts. Layout:
+ *
+ * - Header: same as the draw data layout, followed by the vertex buffer address, the index buffer
+ *   address and the command count
+ * - Per draw command: same as the draw data layout, with IdxOffset and VtxOffset rebased onto the
+ *   merged buffers
+ *
+ * If all vertices are addressable by 16-bit indices, the indices themselves are rebased and all
+ * VtxOffsets are 0, so WebGL2 without base vertex support can draw them as is.
+ */
+constexpr auto merged_draw_data_header_size = draw_data_header_size + 3uz;
+
+static auto merged_vertices = std::vector<ImDrawVert>();
+static auto merged_indices = std::vector<ImDrawIdx>();
+static auto merged_draw_data_layout = std::vector<int32_t>();
+
+static auto write_merged_draw_data(ImDrawData const* draw_data) -> int32_t const* {
+    auto& out = merged_draw_data_layout;
+    out.clear();
+    merged_vertices.clear();
+    merged_indices.clear();
+
+    auto const lists = std::span(draw_data->CmdLists.Data, draw_data->CmdListsCount);
+    auto const rebase_indices =
+        static_cast<size_t>(draw_data->TotalVtxCount) <= std::numeric_limits<ImDrawIdx>::max() + 1uz;
+
+    auto cmd_count = 0uz;
+    for (auto const* list : lists) {
+        cmd_count += static_cast<size_t>(list->CmdBuffer.Size);
     }
 
-    out.ptr = out.arr.data();
-    return out;
+    merged_vertices.reserve(static_cast<size_t>(draw_data->TotalVtxCount));
+    merged_indices.reserve(static_cast<size_t>(draw_data->TotalIdxCount));
+    out.reserve(merged_draw_data_header_size + cmd_count * draw_cmd_stride);
+
+    write_draw_data_header(out, draw_data);
+    out.insert(out.end(), {0, 0, layout_word(cmd_count)});
+
+    for (auto const* list : lists) {
+        auto const vtx_base = static_cast<unsigned int>(merged_vertices.size());
+        auto const idx_base = static_cast<unsigned int>(merged_indices.size());
+
+        merged_vertices.insert(
+            merged_vertices.end(),
+            list->VtxBuffer.Data,
+            list->VtxBuffer.Data + list->VtxBuffer.Size
+        );
+        merged_indices.insert(
+            merged_indices.end(),
+            list->IdxBuffer.Data,
+            list->IdxBuffer.Data + list->IdxBuffer.Size
+        );
+
+        for (auto const& cmd : std::span(list->CmdBuffer.Data, list->CmdBuffer.Size)) {
+            auto const vtx_offset = vtx_base + cmd.VtxOffset;
+            auto const idx_offset = idx_base + cmd.IdxOffset;
+
+            if (!rebase_indices) {
+                write_draw_cmd(out, cmd, idx_offset, vtx_offset);
+                continue;
+            }
+
+            auto const indices = std::span(merged_indices).subspan(idx_offset, cmd.ElemCount);
+            for (auto& idx : indices) {
+                idx = static_cast<ImDrawIdx>(idx + vtx_offset);
+            }
+            write_draw_cmd(out, cmd, idx_offset, 0);
+        }
+    }
+
+    // The buffers are only final now, inserting may have moved them.
+    out[draw_data_header_size] = layout_word(reinterpret_cast<uintptr_t>(merged_vertices.data()));
+    out[draw_data_header_size + 1] = layout_word(reinterpret_cast<uintptr_t>(merged_indices.data()));
+
+    return out.data();
 }
 
-template <typename T, size_t N>
-inline auto write_back_array_param(array_param<T, N> const& out, js_val& v) -> void {
-    if (!out.ptr)
-        return;
+/**
+ * Renderer backend which doesn't draw anything. It takes care of the texture requests, validates
+ * the draw data and counts what a GPU backend would have drawn, for benchmarks and tests on
+ * machines without a GPU.
+ */
+struct null_renderer {
+    struct stats {
+        int frames = 0;
+        int vertices = 0;
+        int indices = 0;
+        int draw_calls = 0;
+        int errors = 0;
+    };
 
-    for (auto const i : std::views::iota(0uz, N)) {
-        v.set(i, out.arr[i]);
+    stats totals;
+    ImTextureID next_tex_id = 1;
+
+    auto update_texture(ImTextureData* tex) -> void {
+        switch (tex->Status) {
+        case ImTextureStatus_WantCreate:
+            ImTextureData_SetTexID(tex, next_tex_id++);
+            ImTextureData_SetStatus(tex, ImTextureStatus_OK);
+            break;
+        case ImTextureStatus_WantUpdates:
+            ImTextureData_SetStatus(tex, ImTextureStatus_OK);
+            break;
+        case ImTextureStatus_WantDestroy:
+            if (tex->UnusedFrames > 0) {
+                ImTextureData_SetTexID(tex, ImTextureID_Invalid);
+                ImTextureData_SetStatus(tex, ImTextureStatus_Destroyed);
+            }
+            break;
+        default:
+            break;
+        }
     }
-}
 
-template <typename T>
-struct vector_param {
-    std::vector<T> vec = {};
-    T* ptr = nullptr;
-};
+    auto render(ImDrawData const* draw_data) -> void {
+        ++totals.frames;
 
-template <typename T>
-inline auto get_vector_param(js_val const& v) -> vector_param<T> {
-    vector_param<T> out{};
+        if (draw_data->Textures) {
+            for (auto* tex : std::span(draw_data->Textures->Data, draw_data->Textures->Size)) {
+                update_texture(tex);
+            }
+        }
 
-    if (v.isNull() || v.isUndefined() || !v.isArray())
-        return out;
+        for (auto const* list : std::span(draw_data->CmdLists.Data, draw_data->CmdListsCount)) {
+            totals.vertices += list->VtxBuffer.Size;
+            totals.indices += list->IdxBuffer.Size;
 
-    auto const len = v["length"].as<size_t>();
-    if (len <= 0)
-        return out;
+            for (auto const& cmd : std::span(list->CmdBuffer.Data, list->CmdBuffer.Size)) {
+                if (cmd.UserCallback)
+                    continue;
 
-    out.vec.reserve(len);
-    for (auto const i : std::views::iota(0uz, len)) {
-        out.vec.emplace_back(v[i].as<T>());
+                if (!is_valid(list, cmd))
+                    ++totals.errors;
+
+                ++totals.draw_calls;
+            }
+        }
     }
 
-    out.ptr = out.vec.data();
-    return out;
-}
+    /**
+     * Checks that the command stays within the buffers and references a created texture.
+     */
+    static auto is_valid(ImDrawList const* list, ImDrawCmd const& cmd) -> bool {
+        auto const idx_end = static_cast<size_t>(cmd.IdxOffset) + cmd.ElemCount;
+        if (idx_end > static_cast<size_t>(list->IdxBuffer.Size))
+            return false;
+
+        auto const* tex_data = cmd.TexRef._TexData;
+        auto const tex_id = tex_data ? tex_data->TexID : cmd.TexRef._TexID;
+        if (tex_id == ImTextureID_Invalid)
+            return false;
+
+        auto const indices = std::span(list->IdxBuffer.Data + cmd.IdxOffset, cmd.ElemCount);
+        return std::ranges::all_of(indices, [&](ImDrawIdx idx) {
+            return cmd.VtxOffset + idx < static_cast<unsigned int>(list->VtxBuffer.Size);
+        });
+    }
+};
 
-template <typename T>
-inline auto write_back_vector_param(vector_param<T> const& out, js_val& v) -> void {
-    if (!out.ptr)
-        return;
+static auto null_backend = null_renderer();
+
+/**
+ * Counts the heap allocations of Dear ImGui (through its allocator functions) and of the bindings
+ * (through the global operator new), with the bytes alive and their high-water mark. Allocations
+ * made before the counter was installed are not tracked, so freeing them never underflows. Only
+ * installed in instrumented builds (`node build.ts --instrument`), the others keep the plain
+ * allocator and report zero.
+ */
+struct alloc_counter {
+    size_t allocs = 0;
+    size_t frees = 0;
+    size_t live = 0;
+    size_t peak = 0;
+
+    auto allocate(size_t size) -> void* {
+        auto* ptr = std::malloc(size);
+        if (!ptr)
+            return nullptr;
+
+        ++allocs;
+        live += malloc_usable_size(ptr);
+        peak = std::max(peak, live);
+        return ptr;
+    }
 
-    for (auto const i : std::views::iota(0uz, out.vec.size())) {
-        v.set(i, out.vec[i]);
+    auto deallocate(void* ptr) -> void {
+        if (!ptr)
+            return;
+
+        ++frees;
+        live -= std::min(live, malloc_usable_size(ptr));
+        std::free(ptr);
     }
+};
+
+constinit static auto heap_allocs = alloc_counter();
+
+#ifdef JSIMGUI_INSTRUMENT
+static auto imgui_alloc(size_t size, void* user_data) -> void* {
+    return static_cast<alloc_counter*>(user_data)->allocate(size);
+}
+
+static auto imgui_free(void* ptr, void* user_data) -> void {
+    static_cast<alloc_counter*>(user_data)->deallocate(ptr);
+}
+
+auto operator new(size_t size) -> void* {
+    if (auto* ptr = heap_allocs.allocate(size == 0 ? 1 : size))
+        return ptr;
+
+    std::abort();
+}
+
+auto operator delete(void* ptr) noexcept -> void {
+    heap_allocs.deallocate(ptr);
+}
+
+auto operator delete(void* ptr, size_t) noexcept -> void {
+    heap_allocs.deallocate(ptr);
+}
+#endif
+
+/**
+ * Byte addresses of the ImGuiIO fields used every frame, for the typed array views of
+ * `ImGuiIOFields` in imgui.ts. Keep the order in sync with `IOField`.
+ */
+static auto io_field_layout = std::array<int32_t, 11>();
+
+static auto write_io_field_layout(ImGuiIO const* io) -> int32_t const* {
+    auto const address = [](auto const& field) -> int32_t {
+        return static_cast<int32_t>(reinterpret_cast<uintptr_t>(&field));
+    };
+
+    io_field_layout = {
+        address(io->DisplaySize.x),
+        address(io->DisplaySize.y),
+        address(io->DeltaTime),
+        address(io->MousePos.x),
+        address(io->MousePos.y),
+        address(io->Framerate),
+        address(io->WantCaptureMouse),
+        address(io->WantCaptureKeyboard),
+        address(io->WantTextInput),
+        address(io->WantSetMousePos),
+        address(io->WantSaveIniSettings),
+    };
+
+    return io_field_layout.data();
 }
 
 static auto get_clipboard_fn = js_val::null();
@@ -138,6 +2475,10 @@ static auto set_clipboard_text(ImGuiContext* ctx, const char* text) -> void {
 };
 
 EMSCRIPTEN_BINDINGS(web) {
+#ifdef JSIMGUI_INSTRUMENT
+    ImGui_SetAllocatorFunctions(imgui_alloc, imgui_free, &heap_allocs);
+#endif
+
     bind_fn("SetupIniSettings", []() -> void {
         auto const& io = ImGui_GetIO();
         io->IniFilename = nullptr;
@@ -153,6 +2494,30 @@ EMSCRIPTEN_BINDINGS(web) {
         platform_io->Platform_SetClipboardTextFn = set_clipboard_text;
     });
 
+    bind_fn("heap_alloc", [](size_t size) -> uintptr_t {
+        return reinterpret_cast<uintptr_t>(std::malloc(size));
+    });
+
+    bind_fn("heap_free", [](uintptr_t ptr) -> void {
+        std::free(reinterpret_cast<void*>(ptr));
+    });
+
+    bind_fn("get_current_context_address", []() -> uintptr_t {
+        return reinterpret_cast<uintptr_t>(ImGui_GetCurrentContext());
+    });
+
+    bind_fn("get_io_field_layout", []() -> uintptr_t {
+        return reinterpret_cast<uintptr_t>(write_io_field_layout(ImGui_GetIO()));
+    });
+
+    bind_fn("get_input_ring", []() -> uintptr_t {
+        return reinterpret_cast<uintptr_t>(&input_events);
+    });
+
+    bind_fn("drain_input_events", []() -> int {
+        return input_events.drain(ImGui_GetIO());
+    });
+
     bind_fn("get_wasm_heap_info", []() -> js_val {
         auto obj = js_val::object();
 
@@ -174,6 +2539,74 @@ EMSCRIPTEN_BINDINGS(web) {
         return obj;
     });
 
+    bind_fn("get_wasm_arena_info", []() -> js_val {
+        auto obj = js_val::object();
+
+        obj.set("capacity", js_val(binding_arena.capacity));
+        obj.set("used", js_val(binding_arena.used + binding_arena.overflow_size));
+        obj.set("peak", js_val(binding_arena.peak));
+        obj.set("mallocs", js_val(binding_arena.mallocs));
+
+        return obj;
+    });
+
+    bind_fn("get_wasm_alloc_info", []() -> js_val {
+        auto obj = js_val::object();
+
+#ifdef JSIMGUI_INSTRUMENT
+        obj.set("counted", js_val(true));
+#else
+        obj.set("counted", js_val(false));
+#endif
+        obj.set("allocs", js_val(heap_allocs.allocs));
+        obj.set("frees", js_val(heap_allocs.frees));
+        obj.set("live", js_val(heap_allocs.live));
+        obj.set("peak", js_val(heap_allocs.peak));
+
+        return obj;
+    });
+
+    bind_fn("reset_wasm_alloc_peak", []() -> void {
+        heap_allocs.peak = heap_allocs.live;
+    });
+
+    bind_fn("get_binding_stats", [](int count) -> js_val {
+        auto counters = std::vector<binding_counter const*>();
+        for (auto const& counter : binding_counters) {
+            if (counter.calls > 0)
+                counters.push_back(&counter);
+        }
+
+        auto const top = std::min(static_cast<size_t>(std::max(count, 0)), counters.size());
+        std::ranges::partial_sort(counters, counters.begin() + top, [](auto* a, auto* b) {
+            return a->time != b->time ? a->time > b->time : a->calls > b->calls;
+        });
+
+        auto arr = js_val::array();
+        for (auto const* counter : counters | std::views::take(top)) {
+            auto obj = js_val::object();
+
+            obj.set("name", js_val(counter->name));
+            obj.set("calls", js_val(counter->calls));
+            obj.set("time", js_val(counter->time));
+
+            arr.call<void>("push", obj);
+        }
+
+        return arr;
+    });
+
+    bind_fn("reset_binding_stats", []() -> void {
+        for (auto& counter : binding_counters) {
+            counter.calls = 0;
+            counter.time = 0.0;
+        }
+    });
+
+    bind_fn("set_binding_timing", [](bool enabled) -> void {
+        binding_timing = enabled;
+    });
+
     bind_fn("get_wasm_mall_info", []() -> js_val {
         auto const& info = mallinfo();
         auto obj = js_val::object();
@@ -193,6 +2626,553 @@ EMSCRIPTEN_BINDINGS(web) {
     });
 }
 
+EMSCRIPTEN_BINDINGS(command_buffer) {
+    bind_fn("InternString", [](std::string str) -> int {
+        return intern_string(std::move(str));
+    });
+
+    bind_fn(
+        "ExecuteCommandBuffer",
+        [](uintptr_t commands, int length, uintptr_t results) -> int {
+            auto const* begin = reinterpret_cast<int32_t const*>(commands);
+
+            // Checks the whole buffer before running any of it, so a broken command neither runs
+            // with made up arguments nor leaves the Begin/End and Push/Pop calls unbalanced.
+            auto check = command_reader{.pos = begin, .end = begin + length};
+            while (check.pos < check.end) {
+                if (!skip_command(static_cast<command_op>(check.read_int()), check))
+                    return -1;
+            }
+
+            auto in = command_reader{.pos = begin, .end = begin + length};
+            auto out = result_writer{.pos = reinterpret_cast<int32_t*>(results)};
+
+            while (in.pos < in.end) {
+                auto const op = static_cast<command_op>(in.read_int());
+                if (!execute_command(op, in, out))
+                    return -1;
+            }
+
+            return out.count;
+        }
+    );
+}
+
+EMSCRIPTEN_BINDINGS(draw_data) {
+    bind_fn(
+        "get_draw_data_layout",
+        [](ImDrawData* draw_data) -> uintptr_t {
+            return reinterpret_cast<uintptr_t>(write_draw_data_layout(draw_data));
+        },
+        allow_raw_ptrs{}
+    );
+
+    bind_fn("set_draw_data_diffing", [](bool enabled) -> void {
+        draw_data_changes = draw_data_diff{.enabled = enabled};
+    });
+
+    bind_fn("draw_data_changed", []() -> bool {
+        return draw_data_changes.resolve();
+    });
+
+    bind_fn("needs_redraw", []() -> bool {
+        return needs_redraw();
+    });
+
+    bind_fn(
+        "get_merged_draw_data",
+        [](ImDrawData* draw_data) -> uintptr_t {
+            return reinterpret_cast<uintptr_t>(write_merged_draw_data(draw_data));
+        },
+        allow_raw_ptrs{}
+    );
+}
+
+EMSCRIPTEN_BINDINGS(text_buffer) {
+    bind_struct<TextBuffer>("TextBuffer")
+        .constructor<>()
+        .function(
+            "Set",
+            override([](TextBuffer* self, std::string value) -> void {
+                self->set(std::move(value));
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "get_Data",
+            override([](TextBuffer const* self) -> uintptr_t {
+                return reinterpret_cast<uintptr_t>(self->text.data());
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "get_Length",
+            override([](TextBuffer const* self) -> int {
+                return static_cast<int>(self->text.size());
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "get_Version",
+            override([](TextBuffer const* self) -> uint32_t {
+                return self->version;
+            }),
+            allow_raw_ptrs{}
+        );
+
+    bind_fn(
+        "TextBuffer_InputText",
+        [](TextBuffer* buffer, std::string label, ImGuiInputTextFlags flags) -> bool {
+            return buffer->edit(flags, [&](auto... args) {
+                return ImGui_InputText(label.c_str(), args...);
+            });
+        },
+        allow_raw_ptrs{}
+    );
+
+    bind_fn(
+        "TextBuffer_InputTextMultiline",
+        [](TextBuffer* buffer, std::string label, ImVec2 size, ImGuiInputTextFlags flags) -> bool {
+            return buffer->edit(flags, [&](char* buf, size_t buf_size, auto... args) {
+                return ImGui_InputTextMultiline(label.c_str(), buf, buf_size, size, args...);
+            });
+        },
+        allow_raw_ptrs{}
+    );
+
+    bind_fn(
+        "TextBuffer_InputTextWithHint",
+        [](TextBuffer* buffer,
+           std::string label,
+           std::string hint,
+           ImGuiInputTextFlags flags) -> bool {
+            return buffer->edit(flags, [&](auto... args) {
+                return ImGui_InputTextWithHint(label.c_str(), hint.c_str(), args...);
+            });
+        },
+        allow_raw_ptrs{}
+    );
+}
+
+EMSCRIPTEN_BINDINGS(plot) {
+    bind_struct<PlotRingBuffer>("PlotRingBuffer")
+        .constructor<int>()
+        .function(
+            "Push",
+            override([](PlotRingBuffer* self, uintptr_t values, int count) -> void {
+                self->push(heap_view_param<float>(values), count);
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "Clear",
+            override([](PlotRingBuffer* self) -> void {
+                self->clear();
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "get_Size",
+            override([](PlotRingBuffer const* self) -> int {
+                return self->size;
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "get_Capacity",
+            override([](PlotRingBuffer const* self) -> int {
+                return self->capacity();
+            }),
+            allow_raw_ptrs{}
+        );
+
+    bind_fn(
+        "PlotRingBuffer_PlotLines",
+        [](PlotRingBuffer const* buffer,
+           std::string label,
+           int values_count,
+           int values_offset,
+           std::string overlay_text,
+           float scale_min,
+           float scale_max,
+           ImVec2 graph_size) -> void {
+            auto window = get_plot_window(buffer, values_count, values_offset);
+
+            ImGui_PlotLinesCallback(
+                label.c_str(),
+                plot_window_getter,
+                &window,
+                window.count,
+                0,
+                overlay_text.c_str(),
+                scale_min,
+                scale_max,
+                graph_size
+            );
+        },
+        allow_raw_ptrs{}
+    );
+
+    bind_fn(
+        "PlotRingBuffer_PlotHistogram",
+        [](PlotRingBuffer const* buffer,
+           std::string label,
+           int values_count,
+           int values_offset,
+           std::string overlay_text,
+           float scale_min,
+           float scale_max,
+           ImVec2 graph_size) -> void {
+            auto window = get_plot_window(buffer, values_count, values_offset);
+
+            ImGui_PlotHistogramCallback(
+                label.c_str(),
+                plot_window_getter,
+                &window,
+                window.count,
+                0,
+                overlay_text.c_str(),
+                scale_min,
+                scale_max,
+                graph_size
+            );
+        },
+        allow_raw_ptrs{}
+    );
+}
+
+EMSCRIPTEN_BINDINGS(column_table) {
+    bind_struct<TableSorter>("TableSorter")
+        .constructor<>()
+        .function(
+            "SetColumnData",
+            override([](TableSorter* self,
+                        int column,
+                        int type,
+                        uintptr_t data,
+                        int length) -> bool {
+                auto const* values = heap_view_param<void>(data);
+                return self->set_data(column, static_cast<column_type>(type), values, length);
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "SetStringTable",
+            override([](TableSorter* self, int column, js_val table) -> bool {
+                return self->set_strings(column, emscripten::vecFromJSArray<std::string>(table));
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "get_Rows",
+            override([](TableSorter const* self) -> int {
+                return self->rows;
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "set_Rows",
+            override([](TableSorter* self, int rows) -> void {
+                self->rows = std::max(rows, 0);
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "get_Async",
+            override([](TableSorter const* self) -> bool {
+                return self->async;
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "set_Async",
+            override([](TableSorter* self, bool async) -> void {
+                self->async = async;
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "get_Busy",
+            override([](TableSorter const* self) -> bool {
+                return self->busy();
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "Invalidate",
+            override([](TableSorter* self) -> void {
+                self->valid = false;
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "Sort",
+            override([](TableSorter* self, ImGuiTableSortSpecs* specs) -> uintptr_t {
+                return reinterpret_cast<uintptr_t>(self->sort(specs).data());
+            }),
+            allow_raw_ptrs{}
+        );
+
+    bind_struct<ColumnTable>("ColumnTable")
+        .constructor<>()
+        .function(
+            "AddColumn",
+            override([](ColumnTable* self,
+                        std::string label,
+                        int type,
+                        std::string format,
+                        ImGuiTableColumnFlags flags,
+                        float width) -> bool {
+                return self->add_column(
+                    std::move(label),
+                    static_cast<column_type>(type),
+                    std::move(format),
+                    flags,
+                    width
+                );
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "SetColumnData",
+            override([](ColumnTable* self,
+                        int column,
+                        int type,
+                        uintptr_t data,
+                        int length) -> bool {
+                auto const* values = heap_view_param<void>(data);
+                return self->set_data(column, static_cast<column_type>(type), values, length);
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "SetStringTable",
+            override([](ColumnTable* self, int column, js_val table) -> bool {
+                auto strings = emscripten::vecFromJSArray<std::string>(table);
+                return self->sorter.set_strings(column, std::move(strings));
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "get_Rows",
+            override([](ColumnTable const* self) -> int {
+                return self->sorter.rows;
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "set_Rows",
+            override([](ColumnTable* self, int rows) -> void {
+                self->sorter.rows = std::max(rows, 0);
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "set_Async",
+            override([](ColumnTable* self, bool async) -> void {
+                self->sorter.async = async;
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "Invalidate",
+            override([](ColumnTable* self) -> void {
+                self->sorter.valid = false;
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "Render",
+            override([](ColumnTable* self,
+                        std::string id,
+                        ImGuiTableFlags flags,
+                        ImVec2 outer_size) -> bool {
+                return self->render(id.c_str(), flags, outer_size);
+            }),
+            allow_raw_ptrs{}
+        );
+}
+
+EMSCRIPTEN_BINDINGS(text_filter) {
+    bind_struct<TextFilterIndex>("TextFilterIndex")
+        .constructor<>()
+        .function(
+            "Load",
+            override([](TextFilterIndex* self,
+                        uintptr_t data,
+                        uintptr_t offsets,
+                        int count) -> bool {
+                return self->load(
+                    heap_view_param<char const>(data),
+                    heap_view_param<uint32_t const>(offsets),
+                    count
+                );
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "get_Count",
+            override([](TextFilterIndex const* self) -> int {
+                return self->count();
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "Apply",
+            override([](TextFilterIndex* self, std::string filter) -> uintptr_t {
+                return reinterpret_cast<uintptr_t>(self->apply(filter).data());
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "get_MatchCount",
+            override([](TextFilterIndex const* self) -> int {
+                return static_cast<int>(self->matches.size());
+            }),
+            allow_raw_ptrs{}
+        );
+
+    bind_struct<text_filter>("ImGuiTextFilter")
+        .constructor<std::string>()
+        .function(
+            "Set",
+            override([](text_filter* self, std::string text) -> void {
+                self->set(text);
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "get_InputBuf",
+            override([](text_filter const* self) -> std::string {
+                return self->filter.InputBuf;
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "Draw",
+            override([](text_filter* self, std::string label, float width) -> bool {
+                return ImGuiTextFilter_Draw(&self->filter, label.c_str(), width);
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "IsActive",
+            override([](text_filter const* self) -> bool {
+                return ImGuiTextFilter_IsActive(&self->filter);
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "PassFilter",
+            override([](text_filter const* self, std::string text) -> bool {
+                return ImGuiTextFilter_PassFilter(&self->filter, text.c_str(), nullptr);
+            }),
+            allow_raw_ptrs{}
+        );
+}
+
+EMSCRIPTEN_BINDINGS(log_buffer) {
+    bind_struct<LogBuffer>("LogBuffer")
+        .constructor<int, int>()
+        .function(
+            "Reserve",
+            override([](LogBuffer* self, int size) -> uintptr_t {
+                return reinterpret_cast<uintptr_t>(
+                    self->reserve(static_cast<size_t>(std::max(size, 0)))
+                );
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "Commit",
+            override([](LogBuffer* self, int written) -> void {
+                self->commit(static_cast<size_t>(std::max(written, 0)));
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "Clear",
+            override([](LogBuffer* self) -> void {
+                self->clear();
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "get_LineCount",
+            override([](LogBuffer const* self) -> int {
+                return static_cast<int>(self->line_count());
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "get_ByteCount",
+            override([](LogBuffer const* self) -> int {
+                return static_cast<int>(self->byte_count());
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "GetLine",
+            override([](LogBuffer const* self, int index) -> std::string {
+                return std::string(self->line(static_cast<size_t>(index)));
+            }),
+            allow_raw_ptrs{}
+        )
+        .function(
+            "Render",
+            override([](LogBuffer* self, std::string id, ImVec2 size, bool auto_scroll) -> void {
+                self->render(id.c_str(), size, auto_scroll);
+            }),
+            allow_raw_ptrs{}
+        );
+}
+
+EMSCRIPTEN_BINDINGS(null_backend) {
+    bind_fn("cImGui_ImplNull_Init", []() -> bool {
+        auto* io = ImGui_GetIO();
+        io->BackendRendererName = "imgui_impl_null";
+        io->BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+        io->BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+
+        null_backend = null_renderer();
+        return true;
+    });
+
+    bind_fn("cImGui_ImplNull_Shutdown", []() -> void {
+        auto* io = ImGui_GetIO();
+        io->BackendRendererName = nullptr;
+        io->BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+        io->BackendFlags &= ~ImGuiBackendFlags_RendererHasTextures;
+    });
+
+    bind_fn("cImGui_ImplNull_NewFrame", []() -> void {});
+
+    bind_fn(
+        "cImGui_ImplNull_RenderDrawData",
+        [](ImDrawData* draw_data) -> void {
+            null_backend.render(draw_data);
+        },
+        allow_raw_ptrs{}
+    );
+
+    bind_fn("cImGui_ImplNull_GetStats", []() -> js_val {
+        auto const& totals = null_backend.totals;
+        auto obj = js_val::object();
+
+        obj.set("frames", js_val(totals.frames));
+        obj.set("vertices", js_val(totals.vertices));
+        obj.set("indices", js_val(totals.indices));
+        obj.set("drawCalls", js_val(totals.draw_calls));
+        obj.set("errors", js_val(totals.errors));
+
+        return obj;
+    });
+
+    bind_fn("cImGui_ImplNull_ResetStats", []() -> void {
+        null_backend.totals = {};
+    });
+}
+
 EMSCRIPTEN_BINDINGS(webgl) {
     bind_fn("cImGui_ImplOpenGL3_Init", []() -> bool {
         return cImGui_ImplOpenGL3_Init();
@@ -2818,10 +5798,10 @@ bind_fn("ImGui_GetStyle", []() -> ImGuiStyle* {
     return ImGui_GetStyle();
 }, rvp_ref{}, allow_raw_ptrs{});
 
-bind_fn("ImGui_NewFrame", []() -> void {
+bind_fn("ImGui_NewFrame", [](){
+    binding_arena.reset();
     ImGui_NewFrame();
 });
-
 bind_fn("ImGui_EndFrame", []() -> void {
     ImGui_EndFrame();
 });
@@ -2872,10 +5852,18 @@ bind_fn("ImGui_ShowStyleSelector", [](std::string label) -> bool {
     return ImGui_ShowStyleSelector(label.c_str());
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_ShowStyleSelector_Interned", [](int label) -> bool {
+    return ImGui_ShowStyleSelector(get_interned_string(label));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_ShowFontSelector", [](std::string label) -> void {
     ImGui_ShowFontSelector(label.c_str());
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_ShowFontSelector_Interned", [](int label) -> void {
+    ImGui_ShowFontSelector(get_interned_string(label));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_ShowUserGuide", []() -> void {
     ImGui_ShowUserGuide();
 });
@@ -2903,6 +5891,13 @@ bind_fn("ImGui_Begin", [](std::string name, js_val p_open, ImGuiWindowFlags flag
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_Begin_Interned", [](int name, js_val p_open, ImGuiWindowFlags flags) -> bool {
+    auto param_p_open = get_array_param<bool, 1>(p_open);
+    auto const ret = ImGui_Begin(get_interned_string(name), param_p_open.ptr, flags);
+    write_back_array_param(param_p_open, p_open);
+    return ret;
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_End", []() -> void {
     ImGui_End();
 });
@@ -2911,6 +5906,10 @@ bind_fn("ImGui_BeginChild", [](std::string str_id, ImVec2 size, ImGuiChildFlags
     return ImGui_BeginChild(str_id.c_str(), size, child_flags, window_flags);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_BeginChild_Interned", [](int str_id, ImVec2 size, ImGuiChildFlags child_flags, ImGuiWindowFlags window_flags) -> bool {
+    return ImGui_BeginChild(get_interned_string(str_id), size, child_flags, window_flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_BeginChildID", [](ImGuiID id, ImVec2 size, ImGuiChildFlags child_flags, ImGuiWindowFlags window_flags) -> bool {
     return ImGui_BeginChildID(id, size, child_flags, window_flags);
 });
@@ -3018,18 +6017,34 @@ bind_fn("ImGui_SetWindowPosStr", [](std::string name, ImVec2 pos, ImGuiCond cond
     ImGui_SetWindowPosStr(name.c_str(), pos, cond);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_SetWindowPosStr_Interned", [](int name, ImVec2 pos, ImGuiCond cond) -> void {
+    ImGui_SetWindowPosStr(get_interned_string(name), pos, cond);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_SetWindowSizeStr", [](std::string name, ImVec2 size, ImGuiCond cond) -> void {
     ImGui_SetWindowSizeStr(name.c_str(), size, cond);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_SetWindowSizeStr_Interned", [](int name, ImVec2 size, ImGuiCond cond) -> void {
+    ImGui_SetWindowSizeStr(get_interned_string(name), size, cond);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_SetWindowCollapsedStr", [](std::string name, bool collapsed, ImGuiCond cond) -> void {
     ImGui_SetWindowCollapsedStr(name.c_str(), collapsed, cond);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_SetWindowCollapsedStr_Interned", [](int name, bool collapsed, ImGuiCond cond) -> void {
+    ImGui_SetWindowCollapsedStr(get_interned_string(name), collapsed, cond);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_SetWindowFocusStr", [](std::string name) -> void {
     ImGui_SetWindowFocusStr(name.c_str());
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_SetWindowFocusStr_Interned", [](int name) -> void {
+    ImGui_SetWindowFocusStr(get_interned_string(name));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_GetScrollX", []() -> float {
     return ImGui_GetScrollX();
 });
@@ -3274,6 +6289,10 @@ bind_fn("ImGui_PushID", [](std::string str_id) -> void {
     ImGui_PushID(str_id.c_str());
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_PushID_Interned", [](int str_id) -> void {
+    ImGui_PushID(get_interned_string(str_id));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_PushIDInt", [](int int_id) -> void {
     ImGui_PushIDInt(int_id);
 });
@@ -3286,6 +6305,10 @@ bind_fn("ImGui_GetID", [](std::string str_id) -> ImGuiID {
     return ImGui_GetID(str_id.c_str());
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_GetID_Interned", [](int str_id) -> ImGuiID {
+    return ImGui_GetID(get_interned_string(str_id));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_GetIDInt", [](int int_id) -> ImGuiID {
     return ImGui_GetIDInt(int_id);
 });
@@ -3293,41 +6316,79 @@ bind_fn("ImGui_GetIDInt", [](int int_id) -> ImGuiID {
 bind_fn("ImGui_Text", [](std::string fmt){
     ImGui_TextUnformatted(fmt.c_str(), nullptr);
 });
+bind_fn("ImGui_Text_Interned", [](int fmt){
+    ImGui_TextUnformatted(get_interned_string(fmt), nullptr);
+});
 bind_fn("ImGui_TextColored", [](ImVec4 col, std::string fmt){
     ImGui_TextColored(col, "%s", fmt.c_str());
 });
+bind_fn("ImGui_TextColored_Interned", [](ImVec4 col, int fmt){
+    ImGui_TextColored(col, "%s", get_interned_string(fmt));
+});
 bind_fn("ImGui_TextDisabled", [](std::string fmt){
     ImGui_TextDisabled("%s", fmt.c_str());
 });
+bind_fn("ImGui_TextDisabled_Interned", [](int fmt){
+    ImGui_TextDisabled("%s", get_interned_string(fmt));
+});
 bind_fn("ImGui_TextWrapped", [](std::string fmt){
     ImGui_TextWrapped("%s", fmt.c_str());
 });
+bind_fn("ImGui_TextWrapped_Interned", [](int fmt){
+    ImGui_TextWrapped("%s", get_interned_string(fmt));
+});
 bind_fn("ImGui_LabelText", [](std::string label, std::string fmt){
     ImGui_LabelText(label.c_str(), "%s", fmt.c_str());
 });
+bind_fn("ImGui_LabelText_Interned", [](int label, int fmt){
+    ImGui_LabelText(get_interned_string(label), "%s", get_interned_string(fmt));
+});
 bind_fn("ImGui_BulletText", [](std::string fmt){
     ImGui_BulletText("%s", fmt.c_str());
 });
+bind_fn("ImGui_BulletText_Interned", [](int fmt){
+    ImGui_BulletText("%s", get_interned_string(fmt));
+});
 bind_fn("ImGui_SeparatorText", [](std::string label) -> void {
     ImGui_SeparatorText(label.c_str());
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_SeparatorText_Interned", [](int label) -> void {
+    ImGui_SeparatorText(get_interned_string(label));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_Button", [](std::string label, ImVec2 size) -> bool {
     return ImGui_Button(label.c_str(), size);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_Button_Interned", [](int label, ImVec2 size) -> bool {
+    return ImGui_Button(get_interned_string(label), size);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_SmallButton", [](std::string label) -> bool {
     return ImGui_SmallButton(label.c_str());
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_SmallButton_Interned", [](int label) -> bool {
+    return ImGui_SmallButton(get_interned_string(label));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_InvisibleButton", [](std::string str_id, ImVec2 size, ImGuiButtonFlags flags) -> bool {
     return ImGui_InvisibleButton(str_id.c_str(), size, flags);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_InvisibleButton_Interned", [](int str_id, ImVec2 size, ImGuiButtonFlags flags) -> bool {
+    return ImGui_InvisibleButton(get_interned_string(str_id), size, flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_ArrowButton", [](std::string str_id, ImGuiDir dir) -> bool {
     return ImGui_ArrowButton(str_id.c_str(), dir);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_ArrowButton_Interned", [](int str_id, ImGuiDir dir) -> bool {
+    return ImGui_ArrowButton(get_interned_string(str_id), dir);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_Checkbox", [](std::string label, js_val v) -> bool {
     auto param_v = get_array_param<bool, 1>(v);
     auto const ret = ImGui_Checkbox(label.c_str(), param_v.ptr);
@@ -3335,6 +6396,13 @@ bind_fn("ImGui_Checkbox", [](std::string label, js_val v) -> bool {
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_Checkbox_Interned", [](int label, js_val v) -> bool {
+    auto param_v = get_array_param<bool, 1>(v);
+    auto const ret = ImGui_Checkbox(get_interned_string(label), param_v.ptr);
+    write_back_array_param(param_v, v);
+    return ret;
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_CheckboxFlagsIntPtr", [](std::string label, js_val flags, int flags_value) -> bool {
     auto param_flags = get_array_param<int, 1>(flags);
     auto const ret = ImGui_CheckboxFlagsIntPtr(label.c_str(), param_flags.ptr, flags_value);
@@ -3342,6 +6410,14 @@ bind_fn("ImGui_CheckboxFlagsIntPtr", [](std::string label, js_val flags, int fla
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_CheckboxFlagsIntPtr_View", [](std::string label, uintptr_t flags, int flags_value) -> bool {
+    return ImGui_CheckboxFlagsIntPtr(label.c_str(), heap_view_param<int>(flags), flags_value);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_CheckboxFlagsIntPtr_Interned", [](int label, uintptr_t flags, int flags_value) -> bool {
+    return ImGui_CheckboxFlagsIntPtr(get_interned_string(label), heap_view_param<int>(flags), flags_value);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_CheckboxFlagsUintPtr", [](std::string label, js_val flags, unsigned int flags_value) -> bool {
     auto param_flags = get_array_param<unsigned int, 1>(flags);
     auto const ret = ImGui_CheckboxFlagsUintPtr(label.c_str(), param_flags.ptr, flags_value);
@@ -3349,10 +6425,22 @@ bind_fn("ImGui_CheckboxFlagsUintPtr", [](std::string label, js_val flags, unsign
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_CheckboxFlagsUintPtr_View", [](std::string label, uintptr_t flags, unsigned int flags_value) -> bool {
+    return ImGui_CheckboxFlagsUintPtr(label.c_str(), heap_view_param<unsigned int>(flags), flags_value);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_CheckboxFlagsUintPtr_Interned", [](int label, uintptr_t flags, unsigned int flags_value) -> bool {
+    return ImGui_CheckboxFlagsUintPtr(get_interned_string(label), heap_view_param<unsigned int>(flags), flags_value);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_RadioButton", [](std::string label, bool active) -> bool {
     return ImGui_RadioButton(label.c_str(), active);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_RadioButton_Interned", [](int label, bool active) -> bool {
+    return ImGui_RadioButton(get_interned_string(label), active);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_RadioButtonIntPtr", [](std::string label, js_val v, int v_button) -> bool {
     auto param_v = get_array_param<int, 1>(v);
     auto const ret = ImGui_RadioButtonIntPtr(label.c_str(), param_v.ptr, v_button);
@@ -3360,10 +6448,22 @@ bind_fn("ImGui_RadioButtonIntPtr", [](std::string label, js_val v, int v_button)
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_RadioButtonIntPtr_View", [](std::string label, uintptr_t v, int v_button) -> bool {
+    return ImGui_RadioButtonIntPtr(label.c_str(), heap_view_param<int>(v), v_button);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_RadioButtonIntPtr_Interned", [](int label, uintptr_t v, int v_button) -> bool {
+    return ImGui_RadioButtonIntPtr(get_interned_string(label), heap_view_param<int>(v), v_button);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_ProgressBar", [](float fraction, ImVec2 size_arg, std::string overlay) -> void {
     ImGui_ProgressBar(fraction, size_arg, overlay.c_str());
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_ProgressBar_Interned", [](float fraction, ImVec2 size_arg, int overlay) -> void {
+    ImGui_ProgressBar(fraction, size_arg, get_interned_string(overlay));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_Bullet", []() -> void {
     ImGui_Bullet();
 });
@@ -3372,10 +6472,18 @@ bind_fn("ImGui_TextLink", [](std::string label) -> bool {
     return ImGui_TextLink(label.c_str());
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_TextLink_Interned", [](int label) -> bool {
+    return ImGui_TextLink(get_interned_string(label));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_TextLinkOpenURL", [](std::string label, std::string url) -> bool {
     return ImGui_TextLinkOpenURL(label.c_str(), url.c_str());
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_TextLinkOpenURL_Interned", [](int label, int url) -> bool {
+    return ImGui_TextLinkOpenURL(get_interned_string(label), get_interned_string(url));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_Image", [](ImTextureRef tex_ref, ImVec2 image_size, ImVec2 uv0, ImVec2 uv1) -> void {
     ImGui_Image(tex_ref, image_size, uv0, uv1);
 });
@@ -3388,10 +6496,18 @@ bind_fn("ImGui_ImageButton", [](std::string str_id, ImTextureRef tex_ref, ImVec2
     return ImGui_ImageButton(str_id.c_str(), tex_ref, image_size, uv0, uv1, bg_col, tint_col);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_ImageButton_Interned", [](int str_id, ImTextureRef tex_ref, ImVec2 image_size, ImVec2 uv0, ImVec2 uv1, ImVec4 bg_col, ImVec4 tint_col) -> bool {
+    return ImGui_ImageButton(get_interned_string(str_id), tex_ref, image_size, uv0, uv1, bg_col, tint_col);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_BeginCombo", [](std::string label, std::string preview_value, ImGuiComboFlags flags) -> bool {
     return ImGui_BeginCombo(label.c_str(), preview_value.c_str(), flags);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_BeginCombo_Interned", [](int label, int preview_value, ImGuiComboFlags flags) -> bool {
+    return ImGui_BeginCombo(get_interned_string(label), get_interned_string(preview_value), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_EndCombo", []() -> void {
     ImGui_EndCombo();
 });
@@ -3403,6 +6519,14 @@ bind_fn("ImGui_Combo", [](std::string label, js_val current_item, std::string it
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_Combo_View", [](std::string label, uintptr_t current_item, std::string items_separated_by_zeros, int popup_max_height_in_items) -> bool {
+    return ImGui_Combo(label.c_str(), heap_view_param<int>(current_item), items_separated_by_zeros.c_str(), popup_max_height_in_items);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_Combo_Interned", [](int label, uintptr_t current_item, int items_separated_by_zeros, int popup_max_height_in_items) -> bool {
+    return ImGui_Combo(get_interned_string(label), heap_view_param<int>(current_item), get_interned_string(items_separated_by_zeros), popup_max_height_in_items);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_DragFloat", [](std::string label, js_val v, float v_speed, float v_min, float v_max, std::string format, ImGuiSliderFlags flags) -> bool {
     auto param_v = get_array_param<float, 1>(v);
     auto const ret = ImGui_DragFloat(label.c_str(), param_v.ptr, v_speed, v_min, v_max, format.c_str(), flags);
@@ -3410,6 +6534,14 @@ bind_fn("ImGui_DragFloat", [](std::string label, js_val v, float v_speed, float
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_DragFloat_View", [](std::string label, uintptr_t v, float v_speed, float v_min, float v_max, std::string format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragFloat(label.c_str(), heap_view_param<float>(v), v_speed, v_min, v_max, format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_DragFloat_Interned", [](int label, uintptr_t v, float v_speed, float v_min, float v_max, int format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragFloat(get_interned_string(label), heap_view_param<float>(v), v_speed, v_min, v_max, get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_DragFloat2", [](std::string label, js_val v, float v_speed, float v_min, float v_max, std::string format, ImGuiSliderFlags flags) -> bool {
     auto param_v = get_array_param<float, 2>(v);
     auto const ret = ImGui_DragFloat2(label.c_str(), param_v.ptr, v_speed, v_min, v_max, format.c_str(), flags);
@@ -3417,6 +6549,14 @@ bind_fn("ImGui_DragFloat2", [](std::string label, js_val v, float v_speed, float
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_DragFloat2_View", [](std::string label, uintptr_t v, float v_speed, float v_min, float v_max, std::string format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragFloat2(label.c_str(), heap_view_param<float>(v), v_speed, v_min, v_max, format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_DragFloat2_Interned", [](int label, uintptr_t v, float v_speed, float v_min, float v_max, int format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragFloat2(get_interned_string(label), heap_view_param<float>(v), v_speed, v_min, v_max, get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_DragFloat3", [](std::string label, js_val v, float v_speed, float v_min, float v_max, std::string format, ImGuiSliderFlags flags) -> bool {
     auto param_v = get_array_param<float, 3>(v);
     auto const ret = ImGui_DragFloat3(label.c_str(), param_v.ptr, v_speed, v_min, v_max, format.c_str(), flags);
@@ -3424,6 +6564,14 @@ bind_fn("ImGui_DragFloat3", [](std::string label, js_val v, float v_speed, float
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_DragFloat3_View", [](std::string label, uintptr_t v, float v_speed, float v_min, float v_max, std::string format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragFloat3(label.c_str(), heap_view_param<float>(v), v_speed, v_min, v_max, format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_DragFloat3_Interned", [](int label, uintptr_t v, float v_speed, float v_min, float v_max, int format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragFloat3(get_interned_string(label), heap_view_param<float>(v), v_speed, v_min, v_max, get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_DragFloat4", [](std::string label, js_val v, float v_speed, float v_min, float v_max, std::string format, ImGuiSliderFlags flags) -> bool {
     auto param_v = get_array_param<float, 4>(v);
     auto const ret = ImGui_DragFloat4(label.c_str(), param_v.ptr, v_speed, v_min, v_max, format.c_str(), flags);
@@ -3431,6 +6579,14 @@ bind_fn("ImGui_DragFloat4", [](std::string label, js_val v, float v_speed, float
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_DragFloat4_View", [](std::string label, uintptr_t v, float v_speed, float v_min, float v_max, std::string format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragFloat4(label.c_str(), heap_view_param<float>(v), v_speed, v_min, v_max, format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_DragFloat4_Interned", [](int label, uintptr_t v, float v_speed, float v_min, float v_max, int format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragFloat4(get_interned_string(label), heap_view_param<float>(v), v_speed, v_min, v_max, get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_DragFloatRange2", [](std::string label, js_val v_current_min, js_val v_current_max, float v_speed, float v_min, float v_max, std::string format, std::string format_max, ImGuiSliderFlags flags) -> bool {
     auto param_v_current_min = get_array_param<float, 1>(v_current_min);
     auto param_v_current_max = get_array_param<float, 1>(v_current_max);
@@ -3440,6 +6596,14 @@ bind_fn("ImGui_DragFloatRange2", [](std::string label, js_val v_current_min, js_
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_DragFloatRange2_View", [](std::string label, uintptr_t v_current_min, uintptr_t v_current_max, float v_speed, float v_min, float v_max, std::string format, std::string format_max, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragFloatRange2(label.c_str(), heap_view_param<float>(v_current_min), heap_view_param<float>(v_current_max), v_speed, v_min, v_max, format.c_str(), format_max.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_DragFloatRange2_Interned", [](int label, uintptr_t v_current_min, uintptr_t v_current_max, float v_speed, float v_min, float v_max, int format, int format_max, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragFloatRange2(get_interned_string(label), heap_view_param<float>(v_current_min), heap_view_param<float>(v_current_max), v_speed, v_min, v_max, get_interned_string(format), get_interned_string(format_max), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_DragInt", [](std::string label, js_val v, float v_speed, int v_min, int v_max, std::string format, ImGuiSliderFlags flags) -> bool {
     auto param_v = get_array_param<int, 1>(v);
     auto const ret = ImGui_DragInt(label.c_str(), param_v.ptr, v_speed, v_min, v_max, format.c_str(), flags);
@@ -3447,6 +6611,14 @@ bind_fn("ImGui_DragInt", [](std::string label, js_val v, float v_speed, int v_mi
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_DragInt_View", [](std::string label, uintptr_t v, float v_speed, int v_min, int v_max, std::string format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragInt(label.c_str(), heap_view_param<int>(v), v_speed, v_min, v_max, format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_DragInt_Interned", [](int label, uintptr_t v, float v_speed, int v_min, int v_max, int format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragInt(get_interned_string(label), heap_view_param<int>(v), v_speed, v_min, v_max, get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_DragInt2", [](std::string label, js_val v, float v_speed, int v_min, int v_max, std::string format, ImGuiSliderFlags flags) -> bool {
     auto param_v = get_array_param<int, 2>(v);
     auto const ret = ImGui_DragInt2(label.c_str(), param_v.ptr, v_speed, v_min, v_max, format.c_str(), flags);
@@ -3454,6 +6626,14 @@ bind_fn("ImGui_DragInt2", [](std::string label, js_val v, float v_speed, int v_m
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_DragInt2_View", [](std::string label, uintptr_t v, float v_speed, int v_min, int v_max, std::string format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragInt2(label.c_str(), heap_view_param<int>(v), v_speed, v_min, v_max, format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_DragInt2_Interned", [](int label, uintptr_t v, float v_speed, int v_min, int v_max, int format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragInt2(get_interned_string(label), heap_view_param<int>(v), v_speed, v_min, v_max, get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_DragInt3", [](std::string label, js_val v, float v_speed, int v_min, int v_max, std::string format, ImGuiSliderFlags flags) -> bool {
     auto param_v = get_array_param<int, 3>(v);
     auto const ret = ImGui_DragInt3(label.c_str(), param_v.ptr, v_speed, v_min, v_max, format.c_str(), flags);
@@ -3461,6 +6641,14 @@ bind_fn("ImGui_DragInt3", [](std::string label, js_val v, float v_speed, int v_m
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_DragInt3_View", [](std::string label, uintptr_t v, float v_speed, int v_min, int v_max, std::string format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragInt3(label.c_str(), heap_view_param<int>(v), v_speed, v_min, v_max, format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_DragInt3_Interned", [](int label, uintptr_t v, float v_speed, int v_min, int v_max, int format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragInt3(get_interned_string(label), heap_view_param<int>(v), v_speed, v_min, v_max, get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_DragInt4", [](std::string label, js_val v, float v_speed, int v_min, int v_max, std::string format, ImGuiSliderFlags flags) -> bool {
     auto param_v = get_array_param<int, 4>(v);
     auto const ret = ImGui_DragInt4(label.c_str(), param_v.ptr, v_speed, v_min, v_max, format.c_str(), flags);
@@ -3468,6 +6656,14 @@ bind_fn("ImGui_DragInt4", [](std::string label, js_val v, float v_speed, int v_m
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_DragInt4_View", [](std::string label, uintptr_t v, float v_speed, int v_min, int v_max, std::string format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragInt4(label.c_str(), heap_view_param<int>(v), v_speed, v_min, v_max, format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_DragInt4_Interned", [](int label, uintptr_t v, float v_speed, int v_min, int v_max, int format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragInt4(get_interned_string(label), heap_view_param<int>(v), v_speed, v_min, v_max, get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_DragIntRange2", [](std::string label, js_val v_current_min, js_val v_current_max, float v_speed, int v_min, int v_max, std::string format, std::string format_max, ImGuiSliderFlags flags) -> bool {
     auto param_v_current_min = get_array_param<int, 1>(v_current_min);
     auto param_v_current_max = get_array_param<int, 1>(v_current_max);
@@ -3477,6 +6673,14 @@ bind_fn("ImGui_DragIntRange2", [](std::string label, js_val v_current_min, js_va
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_DragIntRange2_View", [](std::string label, uintptr_t v_current_min, uintptr_t v_current_max, float v_speed, int v_min, int v_max, std::string format, std::string format_max, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragIntRange2(label.c_str(), heap_view_param<int>(v_current_min), heap_view_param<int>(v_current_max), v_speed, v_min, v_max, format.c_str(), format_max.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_DragIntRange2_Interned", [](int label, uintptr_t v_current_min, uintptr_t v_current_max, float v_speed, int v_min, int v_max, int format, int format_max, ImGuiSliderFlags flags) -> bool {
+    return ImGui_DragIntRange2(get_interned_string(label), heap_view_param<int>(v_current_min), heap_view_param<int>(v_current_max), v_speed, v_min, v_max, get_interned_string(format), get_interned_string(format_max), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_SliderFloat", [](std::string label, js_val v, float v_min, float v_max, std::string format, ImGuiSliderFlags flags) -> bool {
     auto param_v = get_array_param<float, 1>(v);
     auto const ret = ImGui_SliderFloat(label.c_str(), param_v.ptr, v_min, v_max, format.c_str(), flags);
@@ -3484,6 +6688,14 @@ bind_fn("ImGui_SliderFloat", [](std::string label, js_val v, float v_min, float
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_SliderFloat_View", [](std::string label, uintptr_t v, float v_min, float v_max, std::string format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_SliderFloat(label.c_str(), heap_view_param<float>(v), v_min, v_max, format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_SliderFloat_Interned", [](int label, uintptr_t v, float v_min, float v_max, int format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_SliderFloat(get_interned_string(label), heap_view_param<float>(v), v_min, v_max, get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_SliderFloat2", [](std::string label, js_val v, float v_min, float v_max, std::string format, ImGuiSliderFlags flags) -> bool {
     auto param_v = get_array_param<float, 2>(v);
     auto const ret = ImGui_SliderFloat2(label.c_str(), param_v.ptr, v_min, v_max, format.c_str(), flags);
@@ -3491,6 +6703,14 @@ bind_fn("ImGui_SliderFloat2", [](std::string label, js_val v, float v_min, float
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_SliderFloat2_View", [](std::string label, uintptr_t v, float v_min, float v_max, std::string format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_SliderFloat2(label.c_str(), heap_view_param<float>(v), v_min, v_max, format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_SliderFloat2_Interned", [](int label, uintptr_t v, float v_min, float v_max, int format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_SliderFloat2(get_interned_string(label), heap_view_param<float>(v), v_min, v_max, get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_SliderFloat3", [](std::string label, js_val v, float v_min, float v_max, std::string format, ImGuiSliderFlags flags) -> bool {
     auto param_v = get_array_param<float, 3>(v);
     auto const ret = ImGui_SliderFloat3(label.c_str(), param_v.ptr, v_min, v_max, format.c_str(), flags);
@@ -3498,6 +6718,14 @@ bind_fn("ImGui_SliderFloat3", [](std::string label, js_val v, float v_min, float
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_SliderFloat3_View", [](std::string label, uintptr_t v, float v_min, float v_max, std::string format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_SliderFloat3(label.c_str(), heap_view_param<float>(v), v_min, v_max, format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_SliderFloat3_Interned", [](int label, uintptr_t v, float v_min, float v_max, int format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_SliderFloat3(get_interned_string(label), heap_view_param<float>(v), v_min, v_max, get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_SliderFloat4", [](std::string label, js_val v, float v_min, float v_max, std::string format, ImGuiSliderFlags flags) -> bool {
     auto param_v = get_array_param<float, 4>(v);
     auto const ret = ImGui_SliderFloat4(label.c_str(), param_v.ptr, v_min, v_max, format.c_str(), flags);
@@ -3505,6 +6733,14 @@ bind_fn("ImGui_SliderFloat4", [](std::string label, js_val v, float v_min, float
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_SliderFloat4_View", [](std::string label, uintptr_t v, float v_min, float v_max, std::string format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_SliderFloat4(label.c_str(), heap_view_param<float>(v), v_min, v_max, format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_SliderFloat4_Interned", [](int label, uintptr_t v, float v_min, float v_max, int format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_SliderFloat4(get_interned_string(label), heap_view_param<float>(v), v_min, v_max, get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_SliderAngle", [](std::string label, js_val v_rad, float v_degrees_min, float v_degrees_max, std::string format, ImGuiSliderFlags flags) -> bool {
     auto param_v_rad = get_array_param<float, 1>(v_rad);
     auto const ret = ImGui_SliderAngle(label.c_str(), param_v_rad.ptr, v_degrees_min, v_degrees_max, format.c_str(), flags);
@@ -3512,6 +6748,14 @@ bind_fn("ImGui_SliderAngle", [](std::string label, js_val v_rad, float v_degrees
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_SliderAngle_View", [](std::string label, uintptr_t v_rad, float v_degrees_min, float v_degrees_max, std::string format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_SliderAngle(label.c_str(), heap_view_param<float>(v_rad), v_degrees_min, v_degrees_max, format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_SliderAngle_Interned", [](int label, uintptr_t v_rad, float v_degrees_min, float v_degrees_max, int format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_SliderAngle(get_interned_string(label), heap_view_param<float>(v_rad), v_degrees_min, v_degrees_max, get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_SliderInt", [](std::string label, js_val v, int v_min, int v_max, std::string format, ImGuiSliderFlags flags) -> bool {
     auto param_v = get_array_param<int, 1>(v);
     auto const ret = ImGui_SliderInt(label.c_str(), param_v.ptr, v_min, v_max, format.c_str(), flags);
@@ -3519,6 +6763,14 @@ bind_fn("ImGui_SliderInt", [](std::string label, js_val v, int v_min, int v_max,
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_SliderInt_View", [](std::string label, uintptr_t v, int v_min, int v_max, std::string format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_SliderInt(label.c_str(), heap_view_param<int>(v), v_min, v_max, format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_SliderInt_Interned", [](int label, uintptr_t v, int v_min, int v_max, int format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_SliderInt(get_interned_string(label), heap_view_param<int>(v), v_min, v_max, get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_SliderInt2", [](std::string label, js_val v, int v_min, int v_max, std::string format, ImGuiSliderFlags flags) -> bool {
     auto param_v = get_array_param<int, 2>(v);
     auto const ret = ImGui_SliderInt2(label.c_str(), param_v.ptr, v_min, v_max, format.c_str(), flags);
@@ -3526,6 +6778,14 @@ bind_fn("ImGui_SliderInt2", [](std::string label, js_val v, int v_min, int v_max
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_SliderInt2_View", [](std::string label, uintptr_t v, int v_min, int v_max, std::string format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_SliderInt2(label.c_str(), heap_view_param<int>(v), v_min, v_max, format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_SliderInt2_Interned", [](int label, uintptr_t v, int v_min, int v_max, int format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_SliderInt2(get_interned_string(label), heap_view_param<int>(v), v_min, v_max, get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_SliderInt3", [](std::string label, js_val v, int v_min, int v_max, std::string format, ImGuiSliderFlags flags) -> bool {
     auto param_v = get_array_param<int, 3>(v);
     auto const ret = ImGui_SliderInt3(label.c_str(), param_v.ptr, v_min, v_max, format.c_str(), flags);
@@ -3533,6 +6793,14 @@ bind_fn("ImGui_SliderInt3", [](std::string label, js_val v, int v_min, int v_max
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_SliderInt3_View", [](std::string label, uintptr_t v, int v_min, int v_max, std::string format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_SliderInt3(label.c_str(), heap_view_param<int>(v), v_min, v_max, format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_SliderInt3_Interned", [](int label, uintptr_t v, int v_min, int v_max, int format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_SliderInt3(get_interned_string(label), heap_view_param<int>(v), v_min, v_max, get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_SliderInt4", [](std::string label, js_val v, int v_min, int v_max, std::string format, ImGuiSliderFlags flags) -> bool {
     auto param_v = get_array_param<int, 4>(v);
     auto const ret = ImGui_SliderInt4(label.c_str(), param_v.ptr, v_min, v_max, format.c_str(), flags);
@@ -3540,25 +6808,30 @@ bind_fn("ImGui_SliderInt4", [](std::string label, js_val v, int v_min, int v_max
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_SliderInt4_View", [](std::string label, uintptr_t v, int v_min, int v_max, std::string format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_SliderInt4(label.c_str(), heap_view_param<int>(v), v_min, v_max, format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_SliderInt4_Interned", [](int label, uintptr_t v, int v_min, int v_max, int format, ImGuiSliderFlags flags) -> bool {
+    return ImGui_SliderInt4(get_interned_string(label), heap_view_param<int>(v), v_min, v_max, get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_InputText", [](std::string label, js_val buf, size_t buf_size, ImGuiInputTextFlags flags){
-    auto _bind_buf = buf[0].as<std::string>();
-    _bind_buf.reserve(buf_size);
+    auto _bind_buf = get_text_buffer(buf, buf_size);
     auto const ret = ImGui_InputText(label.c_str(), _bind_buf.data(), buf_size, flags, nullptr, nullptr);
-    buf.set(0, std::string(_bind_buf.data()));
+    buf.set(0, js_val::u8string(_bind_buf.data()));
     return ret;
 });
 bind_fn("ImGui_InputTextMultiline", [](std::string label, js_val buf, size_t buf_size, ImVec2 size, ImGuiInputTextFlags flags){
-    auto _bind_buf = buf[0].as<std::string>();
-    _bind_buf.reserve(buf_size);
+    auto _bind_buf = get_text_buffer(buf, buf_size);
     auto const ret = ImGui_InputTextMultiline(label.c_str(), _bind_buf.data(), buf_size, size, flags, nullptr, nullptr);
-    buf.set(0, std::string(_bind_buf.data()));
+    buf.set(0, js_val::u8string(_bind_buf.data()));
     return ret;
 });
 bind_fn("ImGui_InputTextWithHint", [](std::string label, std::string hint, js_val buf, size_t buf_size, ImGuiInputTextFlags flags){
-    auto _bind_buf = buf[0].as<std::string>();
-    _bind_buf.reserve(buf_size);
+    auto _bind_buf = get_text_buffer(buf, buf_size);
     auto const ret = ImGui_InputTextWithHint(label.c_str(), hint.c_str(), _bind_buf.data(), buf_size, flags, nullptr, nullptr);
-    buf.set(0, std::string(_bind_buf.data()));
+    buf.set(0, js_val::u8string(_bind_buf.data()));
     return ret;
 });
 bind_fn("ImGui_InputFloat", [](std::string label, js_val v, float step, float step_fast, std::string format, ImGuiInputTextFlags flags) -> bool {
@@ -3568,6 +6841,14 @@ bind_fn("ImGui_InputFloat", [](std::string label, js_val v, float step, float st
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_InputFloat_View", [](std::string label, uintptr_t v, float step, float step_fast, std::string format, ImGuiInputTextFlags flags) -> bool {
+    return ImGui_InputFloat(label.c_str(), heap_view_param<float>(v), step, step_fast, format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_InputFloat_Interned", [](int label, uintptr_t v, float step, float step_fast, int format, ImGuiInputTextFlags flags) -> bool {
+    return ImGui_InputFloat(get_interned_string(label), heap_view_param<float>(v), step, step_fast, get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_InputFloat2", [](std::string label, js_val v, std::string format, ImGuiInputTextFlags flags) -> bool {
     auto param_v = get_array_param<float, 2>(v);
     auto const ret = ImGui_InputFloat2(label.c_str(), param_v.ptr, format.c_str(), flags);
@@ -3575,6 +6856,14 @@ bind_fn("ImGui_InputFloat2", [](std::string label, js_val v, std::string format,
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_InputFloat2_View", [](std::string label, uintptr_t v, std::string format, ImGuiInputTextFlags flags) -> bool {
+    return ImGui_InputFloat2(label.c_str(), heap_view_param<float>(v), format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_InputFloat2_Interned", [](int label, uintptr_t v, int format, ImGuiInputTextFlags flags) -> bool {
+    return ImGui_InputFloat2(get_interned_string(label), heap_view_param<float>(v), get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_InputFloat3", [](std::string label, js_val v, std::string format, ImGuiInputTextFlags flags) -> bool {
     auto param_v = get_array_param<float, 3>(v);
     auto const ret = ImGui_InputFloat3(label.c_str(), param_v.ptr, format.c_str(), flags);
@@ -3582,6 +6871,14 @@ bind_fn("ImGui_InputFloat3", [](std::string label, js_val v, std::string format,
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_InputFloat3_View", [](std::string label, uintptr_t v, std::string format, ImGuiInputTextFlags flags) -> bool {
+    return ImGui_InputFloat3(label.c_str(), heap_view_param<float>(v), format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_InputFloat3_Interned", [](int label, uintptr_t v, int format, ImGuiInputTextFlags flags) -> bool {
+    return ImGui_InputFloat3(get_interned_string(label), heap_view_param<float>(v), get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_InputFloat4", [](std::string label, js_val v, std::string format, ImGuiInputTextFlags flags) -> bool {
     auto param_v = get_array_param<float, 4>(v);
     auto const ret = ImGui_InputFloat4(label.c_str(), param_v.ptr, format.c_str(), flags);
@@ -3589,6 +6886,14 @@ bind_fn("ImGui_InputFloat4", [](std::string label, js_val v, std::string format,
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_InputFloat4_View", [](std::string label, uintptr_t v, std::string format, ImGuiInputTextFlags flags) -> bool {
+    return ImGui_InputFloat4(label.c_str(), heap_view_param<float>(v), format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_InputFloat4_Interned", [](int label, uintptr_t v, int format, ImGuiInputTextFlags flags) -> bool {
+    return ImGui_InputFloat4(get_interned_string(label), heap_view_param<float>(v), get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_InputInt", [](std::string label, js_val v, int step, int step_fast, ImGuiInputTextFlags flags) -> bool {
     auto param_v = get_array_param<int, 1>(v);
     auto const ret = ImGui_InputInt(label.c_str(), param_v.ptr, step, step_fast, flags);
@@ -3596,6 +6901,14 @@ bind_fn("ImGui_InputInt", [](std::string label, js_val v, int step, int step_fas
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_InputInt_View", [](std::string label, uintptr_t v, int step, int step_fast, ImGuiInputTextFlags flags) -> bool {
+    return ImGui_InputInt(label.c_str(), heap_view_param<int>(v), step, step_fast, flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_InputInt_Interned", [](int label, uintptr_t v, int step, int step_fast, ImGuiInputTextFlags flags) -> bool {
+    return ImGui_InputInt(get_interned_string(label), heap_view_param<int>(v), step, step_fast, flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_InputInt2", [](std::string label, js_val v, ImGuiInputTextFlags flags) -> bool {
     auto param_v = get_array_param<int, 2>(v);
     auto const ret = ImGui_InputInt2(label.c_str(), param_v.ptr, flags);
@@ -3603,6 +6916,14 @@ bind_fn("ImGui_InputInt2", [](std::string label, js_val v, ImGuiInputTextFlags f
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_InputInt2_View", [](std::string label, uintptr_t v, ImGuiInputTextFlags flags) -> bool {
+    return ImGui_InputInt2(label.c_str(), heap_view_param<int>(v), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_InputInt2_Interned", [](int label, uintptr_t v, ImGuiInputTextFlags flags) -> bool {
+    return ImGui_InputInt2(get_interned_string(label), heap_view_param<int>(v), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_InputInt3", [](std::string label, js_val v, ImGuiInputTextFlags flags) -> bool {
     auto param_v = get_array_param<int, 3>(v);
     auto const ret = ImGui_InputInt3(label.c_str(), param_v.ptr, flags);
@@ -3610,6 +6931,14 @@ bind_fn("ImGui_InputInt3", [](std::string label, js_val v, ImGuiInputTextFlags f
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_InputInt3_View", [](std::string label, uintptr_t v, ImGuiInputTextFlags flags) -> bool {
+    return ImGui_InputInt3(label.c_str(), heap_view_param<int>(v), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_InputInt3_Interned", [](int label, uintptr_t v, ImGuiInputTextFlags flags) -> bool {
+    return ImGui_InputInt3(get_interned_string(label), heap_view_param<int>(v), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_InputInt4", [](std::string label, js_val v, ImGuiInputTextFlags flags) -> bool {
     auto param_v = get_array_param<int, 4>(v);
     auto const ret = ImGui_InputInt4(label.c_str(), param_v.ptr, flags);
@@ -3617,6 +6946,14 @@ bind_fn("ImGui_InputInt4", [](std::string label, js_val v, ImGuiInputTextFlags f
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_InputInt4_View", [](std::string label, uintptr_t v, ImGuiInputTextFlags flags) -> bool {
+    return ImGui_InputInt4(label.c_str(), heap_view_param<int>(v), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_InputInt4_Interned", [](int label, uintptr_t v, ImGuiInputTextFlags flags) -> bool {
+    return ImGui_InputInt4(get_interned_string(label), heap_view_param<int>(v), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_InputDouble", [](std::string label, js_val v, double step, double step_fast, std::string format, ImGuiInputTextFlags flags) -> bool {
     auto param_v = get_array_param<double, 1>(v);
     auto const ret = ImGui_InputDouble(label.c_str(), param_v.ptr, step, step_fast, format.c_str(), flags);
@@ -3624,6 +6961,14 @@ bind_fn("ImGui_InputDouble", [](std::string label, js_val v, double step, double
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_InputDouble_View", [](std::string label, uintptr_t v, double step, double step_fast, std::string format, ImGuiInputTextFlags flags) -> bool {
+    return ImGui_InputDouble(label.c_str(), heap_view_param<double>(v), step, step_fast, format.c_str(), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_InputDouble_Interned", [](int label, uintptr_t v, double step, double step_fast, int format, ImGuiInputTextFlags flags) -> bool {
+    return ImGui_InputDouble(get_interned_string(label), heap_view_param<double>(v), step, step_fast, get_interned_string(format), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_ColorEdit3", [](std::string label, js_val col, ImGuiColorEditFlags flags) -> bool {
     auto param_col = get_array_param<float, 3>(col);
     auto const ret = ImGui_ColorEdit3(label.c_str(), param_col.ptr, flags);
@@ -3631,6 +6976,14 @@ bind_fn("ImGui_ColorEdit3", [](std::string label, js_val col, ImGuiColorEditFlag
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_ColorEdit3_View", [](std::string label, uintptr_t col, ImGuiColorEditFlags flags) -> bool {
+    return ImGui_ColorEdit3(label.c_str(), heap_view_param<float>(col), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_ColorEdit3_Interned", [](int label, uintptr_t col, ImGuiColorEditFlags flags) -> bool {
+    return ImGui_ColorEdit3(get_interned_string(label), heap_view_param<float>(col), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_ColorEdit4", [](std::string label, js_val col, ImGuiColorEditFlags flags) -> bool {
     auto param_col = get_array_param<float, 4>(col);
     auto const ret = ImGui_ColorEdit4(label.c_str(), param_col.ptr, flags);
@@ -3638,6 +6991,14 @@ bind_fn("ImGui_ColorEdit4", [](std::string label, js_val col, ImGuiColorEditFlag
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_ColorEdit4_View", [](std::string label, uintptr_t col, ImGuiColorEditFlags flags) -> bool {
+    return ImGui_ColorEdit4(label.c_str(), heap_view_param<float>(col), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_ColorEdit4_Interned", [](int label, uintptr_t col, ImGuiColorEditFlags flags) -> bool {
+    return ImGui_ColorEdit4(get_interned_string(label), heap_view_param<float>(col), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_ColorPicker3", [](std::string label, js_val col, ImGuiColorEditFlags flags) -> bool {
     auto param_col = get_array_param<float, 3>(col);
     auto const ret = ImGui_ColorPicker3(label.c_str(), param_col.ptr, flags);
@@ -3645,19 +7006,38 @@ bind_fn("ImGui_ColorPicker3", [](std::string label, js_val col, ImGuiColorEditFl
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_ColorPicker3_View", [](std::string label, uintptr_t col, ImGuiColorEditFlags flags) -> bool {
+    return ImGui_ColorPicker3(label.c_str(), heap_view_param<float>(col), flags);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_ColorPicker3_Interned", [](int label, uintptr_t col, ImGuiColorEditFlags flags) -> bool {
+    return ImGui_ColorPicker3(get_interned_string(label), heap_view_param<float>(col), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_ColorPicker4", [](std::string label, js_val col, ImGuiColorEditFlags flags, js_val ref_col) -> bool {
     auto param_col = get_array_param<float, 4>(col);
-    auto param_ref_col = get_array_param<float, 1>(ref_col);
+    auto param_ref_col = get_vector_param<float>(ref_col);
     auto const ret = ImGui_ColorPicker4(label.c_str(), param_col.ptr, flags, param_ref_col.ptr);
     write_back_array_param(param_col, col);
-    write_back_array_param(param_ref_col, ref_col);
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_ColorPicker4_View", [](std::string label, uintptr_t col, ImGuiColorEditFlags flags, uintptr_t ref_col) -> bool {
+    return ImGui_ColorPicker4(label.c_str(), heap_view_param<float>(col), flags, heap_view_param<float>(ref_col));
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_ColorPicker4_Interned", [](int label, uintptr_t col, ImGuiColorEditFlags flags, uintptr_t ref_col) -> bool {
+    return ImGui_ColorPicker4(get_interned_string(label), heap_view_param<float>(col), flags, heap_view_param<float>(ref_col));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_ColorButton", [](std::string desc_id, ImVec4 col, ImGuiColorEditFlags flags, ImVec2 size) -> bool {
     return ImGui_ColorButton(desc_id.c_str(), col, flags, size);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_ColorButton_Interned", [](int desc_id, ImVec4 col, ImGuiColorEditFlags flags, ImVec2 size) -> bool {
+    return ImGui_ColorButton(get_interned_string(desc_id), col, flags, size);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_SetColorEditOptions", [](ImGuiColorEditFlags flags) -> void {
     ImGui_SetColorEditOptions(flags);
 });
@@ -3666,14 +7046,26 @@ bind_fn("ImGui_TreeNode", [](std::string label) -> bool {
     return ImGui_TreeNode(label.c_str());
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_TreeNode_Interned", [](int label) -> bool {
+    return ImGui_TreeNode(get_interned_string(label));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_TreeNodeEx", [](std::string label, ImGuiTreeNodeFlags flags) -> bool {
     return ImGui_TreeNodeEx(label.c_str(), flags);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_TreeNodeEx_Interned", [](int label, ImGuiTreeNodeFlags flags) -> bool {
+    return ImGui_TreeNodeEx(get_interned_string(label), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_TreePush", [](std::string str_id) -> void {
     ImGui_TreePush(str_id.c_str());
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_TreePush_Interned", [](int str_id) -> void {
+    ImGui_TreePush(get_interned_string(str_id));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_TreePop", []() -> void {
     ImGui_TreePop();
 });
@@ -3686,6 +7078,10 @@ bind_fn("ImGui_CollapsingHeader", [](std::string label, ImGuiTreeNodeFlags flags
     return ImGui_CollapsingHeader(label.c_str(), flags);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_CollapsingHeader_Interned", [](int label, ImGuiTreeNodeFlags flags) -> bool {
+    return ImGui_CollapsingHeader(get_interned_string(label), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_CollapsingHeaderBoolPtr", [](std::string label, js_val p_visible, ImGuiTreeNodeFlags flags) -> bool {
     auto param_p_visible = get_array_param<bool, 1>(p_visible);
     auto const ret = ImGui_CollapsingHeaderBoolPtr(label.c_str(), param_p_visible.ptr, flags);
@@ -3693,6 +7089,13 @@ bind_fn("ImGui_CollapsingHeaderBoolPtr", [](std::string label, js_val p_visible,
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_CollapsingHeaderBoolPtr_Interned", [](int label, js_val p_visible, ImGuiTreeNodeFlags flags) -> bool {
+    auto param_p_visible = get_array_param<bool, 1>(p_visible);
+    auto const ret = ImGui_CollapsingHeaderBoolPtr(get_interned_string(label), param_p_visible.ptr, flags);
+    write_back_array_param(param_p_visible, p_visible);
+    return ret;
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_SetNextItemOpen", [](bool is_open, ImGuiCond cond) -> void {
     ImGui_SetNextItemOpen(is_open, cond);
 });
@@ -3709,6 +7112,10 @@ bind_fn("ImGui_Selectable", [](std::string label, bool selected, ImGuiSelectable
     return ImGui_Selectable(label.c_str(), selected, flags, size);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_Selectable_Interned", [](int label, bool selected, ImGuiSelectableFlags flags, ImVec2 size) -> bool {
+    return ImGui_Selectable(get_interned_string(label), selected, flags, size);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_SelectableBoolPtr", [](std::string label, js_val p_selected, ImGuiSelectableFlags flags, ImVec2 size) -> bool {
     auto param_p_selected = get_array_param<bool, 1>(p_selected);
     auto const ret = ImGui_SelectableBoolPtr(label.c_str(), param_p_selected.ptr, flags, size);
@@ -3716,6 +7123,13 @@ bind_fn("ImGui_SelectableBoolPtr", [](std::string label, js_val p_selected, ImGu
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_SelectableBoolPtr_Interned", [](int label, js_val p_selected, ImGuiSelectableFlags flags, ImVec2 size) -> bool {
+    auto param_p_selected = get_array_param<bool, 1>(p_selected);
+    auto const ret = ImGui_SelectableBoolPtr(get_interned_string(label), param_p_selected.ptr, flags, size);
+    write_back_array_param(param_p_selected, p_selected);
+    return ret;
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_BeginMultiSelect", [](ImGuiMultiSelectFlags flags, int selection_size, int items_count) -> ImGuiMultiSelectIO* {
     return ImGui_BeginMultiSelect(flags, selection_size, items_count);
 }, rvp_ref{}, allow_raw_ptrs{});
@@ -3736,20 +7150,30 @@ bind_fn("ImGui_BeginListBox", [](std::string label, ImVec2 size) -> bool {
     return ImGui_BeginListBox(label.c_str(), size);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_BeginListBox_Interned", [](int label, ImVec2 size) -> bool {
+    return ImGui_BeginListBox(get_interned_string(label), size);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_EndListBox", []() -> void {
     ImGui_EndListBox();
 });
 
 bind_fn("ImGui_PlotLines", [](std::string label, js_val values, int values_count, int values_offset, std::string overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride) -> void {
-    auto param_values = get_array_param<float, 1>(values);
+    auto param_values = get_vector_param<float>(values);
     ImGui_PlotLines(label.c_str(), param_values.ptr, values_count, values_offset, overlay_text.c_str(), scale_min, scale_max, graph_size, stride);
-    write_back_array_param(param_values, values);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_PlotLines_View", [](std::string label, uintptr_t values, int values_count, int values_offset, std::string overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride) -> void {
+    ImGui_PlotLines(label.c_str(), heap_view_param<float>(values), values_count, values_offset, overlay_text.c_str(), scale_min, scale_max, graph_size, stride);
 }, allow_raw_ptrs{});
 
 bind_fn("ImGui_PlotHistogram", [](std::string label, js_val values, int values_count, int values_offset, std::string overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride) -> void {
-    auto param_values = get_array_param<float, 1>(values);
+    auto param_values = get_vector_param<float>(values);
     ImGui_PlotHistogram(label.c_str(), param_values.ptr, values_count, values_offset, overlay_text.c_str(), scale_min, scale_max, graph_size, stride);
-    write_back_array_param(param_values, values);
+}, allow_raw_ptrs{});
+
+bind_fn("ImGui_PlotHistogram_View", [](std::string label, uintptr_t values, int values_count, int values_offset, std::string overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride) -> void {
+    ImGui_PlotHistogram(label.c_str(), heap_view_param<float>(values), values_count, values_offset, overlay_text.c_str(), scale_min, scale_max, graph_size, stride);
 }, allow_raw_ptrs{});
 
 bind_fn("ImGui_BeginMenuBar", []() -> bool {
@@ -3772,6 +7196,10 @@ bind_fn("ImGui_BeginMenu", [](std::string label, bool enabled) -> bool {
     return ImGui_BeginMenu(label.c_str(), enabled);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_BeginMenu_Interned", [](int label, bool enabled) -> bool {
+    return ImGui_BeginMenu(get_interned_string(label), enabled);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_EndMenu", []() -> void {
     ImGui_EndMenu();
 });
@@ -3780,6 +7208,10 @@ bind_fn("ImGui_MenuItem", [](std::string label, std::string shortcut, bool selec
     return ImGui_MenuItem(label.c_str(), shortcut.c_str(), selected, enabled);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_MenuItem_Interned", [](int label, int shortcut, bool selected, bool enabled) -> bool {
+    return ImGui_MenuItem(get_interned_string(label), get_interned_string(shortcut), selected, enabled);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_MenuItemBoolPtr", [](std::string label, std::string shortcut, js_val p_selected, bool enabled) -> bool {
     auto param_p_selected = get_array_param<bool, 1>(p_selected);
     auto const ret = ImGui_MenuItemBoolPtr(label.c_str(), shortcut.c_str(), param_p_selected.ptr, enabled);
@@ -3787,6 +7219,13 @@ bind_fn("ImGui_MenuItemBoolPtr", [](std::string label, std::string shortcut, js_
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_MenuItemBoolPtr_Interned", [](int label, int shortcut, js_val p_selected, bool enabled) -> bool {
+    auto param_p_selected = get_array_param<bool, 1>(p_selected);
+    auto const ret = ImGui_MenuItemBoolPtr(get_interned_string(label), get_interned_string(shortcut), param_p_selected.ptr, enabled);
+    write_back_array_param(param_p_selected, p_selected);
+    return ret;
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_BeginTooltip", []() -> bool {
     return ImGui_BeginTooltip();
 });
@@ -3809,6 +7248,10 @@ bind_fn("ImGui_BeginPopup", [](std::string str_id, ImGuiWindowFlags flags) -> bo
     return ImGui_BeginPopup(str_id.c_str(), flags);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_BeginPopup_Interned", [](int str_id, ImGuiWindowFlags flags) -> bool {
+    return ImGui_BeginPopup(get_interned_string(str_id), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_BeginPopupModal", [](std::string name, js_val p_open, ImGuiWindowFlags flags) -> bool {
     auto param_p_open = get_array_param<bool, 1>(p_open);
     auto const ret = ImGui_BeginPopupModal(name.c_str(), param_p_open.ptr, flags);
@@ -3816,6 +7259,13 @@ bind_fn("ImGui_BeginPopupModal", [](std::string name, js_val p_open, ImGuiWindow
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_BeginPopupModal_Interned", [](int name, js_val p_open, ImGuiWindowFlags flags) -> bool {
+    auto param_p_open = get_array_param<bool, 1>(p_open);
+    auto const ret = ImGui_BeginPopupModal(get_interned_string(name), param_p_open.ptr, flags);
+    write_back_array_param(param_p_open, p_open);
+    return ret;
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_EndPopup", []() -> void {
     ImGui_EndPopup();
 });
@@ -3824,6 +7274,10 @@ bind_fn("ImGui_OpenPopup", [](std::string str_id, ImGuiPopupFlags popup_flags) -
     ImGui_OpenPopup(str_id.c_str(), popup_flags);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_OpenPopup_Interned", [](int str_id, ImGuiPopupFlags popup_flags) -> void {
+    ImGui_OpenPopup(get_interned_string(str_id), popup_flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_OpenPopupID", [](ImGuiID id, ImGuiPopupFlags popup_flags) -> void {
     ImGui_OpenPopupID(id, popup_flags);
 });
@@ -3832,6 +7286,10 @@ bind_fn("ImGui_OpenPopupOnItemClick", [](std::string str_id, ImGuiPopupFlags pop
     ImGui_OpenPopupOnItemClick(str_id.c_str(), popup_flags);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_OpenPopupOnItemClick_Interned", [](int str_id, ImGuiPopupFlags popup_flags) -> void {
+    ImGui_OpenPopupOnItemClick(get_interned_string(str_id), popup_flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_CloseCurrentPopup", []() -> void {
     ImGui_CloseCurrentPopup();
 });
@@ -3840,22 +7298,42 @@ bind_fn("ImGui_BeginPopupContextItem", [](std::string str_id, ImGuiPopupFlags po
     return ImGui_BeginPopupContextItem(str_id.c_str(), popup_flags);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_BeginPopupContextItem_Interned", [](int str_id, ImGuiPopupFlags popup_flags) -> bool {
+    return ImGui_BeginPopupContextItem(get_interned_string(str_id), popup_flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_BeginPopupContextWindow", [](std::string str_id, ImGuiPopupFlags popup_flags) -> bool {
     return ImGui_BeginPopupContextWindow(str_id.c_str(), popup_flags);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_BeginPopupContextWindow_Interned", [](int str_id, ImGuiPopupFlags popup_flags) -> bool {
+    return ImGui_BeginPopupContextWindow(get_interned_string(str_id), popup_flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_BeginPopupContextVoid", [](std::string str_id, ImGuiPopupFlags popup_flags) -> bool {
     return ImGui_BeginPopupContextVoid(str_id.c_str(), popup_flags);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_BeginPopupContextVoid_Interned", [](int str_id, ImGuiPopupFlags popup_flags) -> bool {
+    return ImGui_BeginPopupContextVoid(get_interned_string(str_id), popup_flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_IsPopupOpen", [](std::string str_id, ImGuiPopupFlags flags) -> bool {
     return ImGui_IsPopupOpen(str_id.c_str(), flags);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_IsPopupOpen_Interned", [](int str_id, ImGuiPopupFlags flags) -> bool {
+    return ImGui_IsPopupOpen(get_interned_string(str_id), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_BeginTable", [](std::string str_id, int columns, ImGuiTableFlags flags, ImVec2 outer_size, float inner_width) -> bool {
     return ImGui_BeginTable(str_id.c_str(), columns, flags, outer_size, inner_width);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_BeginTable_Interned", [](int str_id, int columns, ImGuiTableFlags flags, ImVec2 outer_size, float inner_width) -> bool {
+    return ImGui_BeginTable(get_interned_string(str_id), columns, flags, outer_size, inner_width);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_EndTable", []() -> void {
     ImGui_EndTable();
 });
@@ -3876,6 +7354,10 @@ bind_fn("ImGui_TableSetupColumn", [](std::string label, ImGuiTableColumnFlags fl
     ImGui_TableSetupColumn(label.c_str(), flags, init_width_or_weight, user_id);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_TableSetupColumn_Interned", [](int label, ImGuiTableColumnFlags flags, float init_width_or_weight, ImGuiID user_id) -> void {
+    ImGui_TableSetupColumn(get_interned_string(label), flags, init_width_or_weight, user_id);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_TableSetupScrollFreeze", [](int cols, int rows) -> void {
     ImGui_TableSetupScrollFreeze(cols, rows);
 });
@@ -3884,6 +7366,10 @@ bind_fn("ImGui_TableHeader", [](std::string label) -> void {
     ImGui_TableHeader(label.c_str());
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_TableHeader_Interned", [](int label) -> void {
+    ImGui_TableHeader(get_interned_string(label));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_TableHeadersRow", []() -> void {
     ImGui_TableHeadersRow();
 });
@@ -3932,6 +7418,10 @@ bind_fn("ImGui_Columns", [](int count, std::string id, bool borders) -> void {
     ImGui_Columns(count, id.c_str(), borders);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_Columns_Interned", [](int count, int id, bool borders) -> void {
+    ImGui_Columns(count, get_interned_string(id), borders);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_NextColumn", []() -> void {
     ImGui_NextColumn();
 });
@@ -3964,6 +7454,10 @@ bind_fn("ImGui_BeginTabBar", [](std::string str_id, ImGuiTabBarFlags flags) -> b
     return ImGui_BeginTabBar(str_id.c_str(), flags);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_BeginTabBar_Interned", [](int str_id, ImGuiTabBarFlags flags) -> bool {
+    return ImGui_BeginTabBar(get_interned_string(str_id), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_EndTabBar", []() -> void {
     ImGui_EndTabBar();
 });
@@ -3975,6 +7469,13 @@ bind_fn("ImGui_BeginTabItem", [](std::string label, js_val p_open, ImGuiTabItemF
     return ret;
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_BeginTabItem_Interned", [](int label, js_val p_open, ImGuiTabItemFlags flags) -> bool {
+    auto param_p_open = get_array_param<bool, 1>(p_open);
+    auto const ret = ImGui_BeginTabItem(get_interned_string(label), param_p_open.ptr, flags);
+    write_back_array_param(param_p_open, p_open);
+    return ret;
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_EndTabItem", []() -> void {
     ImGui_EndTabItem();
 });
@@ -3983,10 +7484,18 @@ bind_fn("ImGui_TabItemButton", [](std::string label, ImGuiTabItemFlags flags) ->
     return ImGui_TabItemButton(label.c_str(), flags);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_TabItemButton_Interned", [](int label, ImGuiTabItemFlags flags) -> bool {
+    return ImGui_TabItemButton(get_interned_string(label), flags);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_SetTabItemClosed", [](std::string tab_or_docked_window_label) -> void {
     ImGui_SetTabItemClosed(tab_or_docked_window_label.c_str());
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_SetTabItemClosed_Interned", [](int tab_or_docked_window_label) -> void {
+    ImGui_SetTabItemClosed(get_interned_string(tab_or_docked_window_label));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_DockSpace", [](ImGuiID dockspace_id, ImVec2 size, ImGuiDockNodeFlags flags, const ImGuiWindowClass* window_class) -> ImGuiID {
     return ImGui_DockSpace(dockspace_id, size, flags, window_class);
 }, allow_raw_ptrs{});
@@ -4019,6 +7528,10 @@ bind_fn("ImGui_LogToFile", [](int auto_open_depth, std::string filename) -> void
     ImGui_LogToFile(auto_open_depth, filename.c_str());
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_LogToFile_Interned", [](int auto_open_depth, int filename) -> void {
+    ImGui_LogToFile(auto_open_depth, get_interned_string(filename));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_LogToClipboard", [](int auto_open_depth) -> void {
     ImGui_LogToClipboard(auto_open_depth);
 });
@@ -4053,6 +7566,10 @@ bind_fn("ImGui_AcceptDragDropPayload", [](std::string type, ImGuiDragDropFlags f
     return ImGui_AcceptDragDropPayload(type.c_str(), flags);
 }, rvp_ref{}, allow_raw_ptrs{});
 
+bind_fn("ImGui_AcceptDragDropPayload_Interned", [](int type, ImGuiDragDropFlags flags) -> const ImGuiPayload* {
+    return ImGui_AcceptDragDropPayload(get_interned_string(type), flags);
+}, rvp_ref{}, allow_raw_ptrs{});
+
 bind_fn("ImGui_EndDragDropTarget", []() -> void {
     ImGui_EndDragDropTarget();
 });
@@ -4205,6 +7722,10 @@ bind_fn("ImGui_CalcTextSize", [](std::string text, std::string text_end, bool hi
     return ImGui_CalcTextSize(text.c_str(), text_end.c_str(), hide_text_after_double_hash, wrap_width);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_CalcTextSize_Interned", [](int text, int text_end, bool hide_text_after_double_hash, float wrap_width) -> ImVec2 {
+    return ImGui_CalcTextSize(get_interned_string(text), get_interned_string(text_end), hide_text_after_double_hash, wrap_width);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_ColorConvertU32ToFloat4", [](ImU32 in) -> ImVec4 {
     return ImGui_ColorConvertU32ToFloat4(in);
 });
@@ -4223,6 +7744,10 @@ bind_fn("ImGui_ColorConvertRGBtoHSV", [](float r, float g, float b, js_val out_h
     write_back_array_param(param_out_v, out_v);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_ColorConvertRGBtoHSV_View", [](float r, float g, float b, uintptr_t out_h, uintptr_t out_s, uintptr_t out_v) -> void {
+    ImGui_ColorConvertRGBtoHSV(r, g, b, heap_view_param<float>(out_h), heap_view_param<float>(out_s), heap_view_param<float>(out_v));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_ColorConvertHSVtoRGB", [](float h, float s, float v, js_val out_r, js_val out_g, js_val out_b) -> void {
     auto param_out_r = get_array_param<float, 1>(out_r);
     auto param_out_g = get_array_param<float, 1>(out_g);
@@ -4233,6 +7758,10 @@ bind_fn("ImGui_ColorConvertHSVtoRGB", [](float h, float s, float v, js_val out_r
     write_back_array_param(param_out_b, out_b);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_ColorConvertHSVtoRGB_View", [](float h, float s, float v, uintptr_t out_r, uintptr_t out_g, uintptr_t out_b) -> void {
+    ImGui_ColorConvertHSVtoRGB(h, s, v, heap_view_param<float>(out_r), heap_view_param<float>(out_g), heap_view_param<float>(out_b));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_IsKeyDown", [](ImGuiKey key) -> bool {
     return ImGui_IsKeyDown(key);
 });
@@ -4349,10 +7878,18 @@ bind_fn("ImGui_SetClipboardText", [](std::string text) -> void {
     ImGui_SetClipboardText(text.c_str());
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_SetClipboardText_Interned", [](int text) -> void {
+    ImGui_SetClipboardText(get_interned_string(text));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_LoadIniSettingsFromMemory", [](std::string ini_data, size_t ini_size) -> void {
     ImGui_LoadIniSettingsFromMemory(ini_data.c_str(), ini_size);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_LoadIniSettingsFromMemory_Interned", [](int ini_data, size_t ini_size) -> void {
+    ImGui_LoadIniSettingsFromMemory(get_interned_string(ini_data), ini_size);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_SaveIniSettingsToMemory", [](js_val out_ini_size) -> std::string {
     auto param_out_ini_size = get_array_param<size_t, 1>(out_ini_size);
     auto const ret = ImGui_SaveIniSettingsToMemory(param_out_ini_size.ptr);
@@ -4364,6 +7901,10 @@ bind_fn("ImGui_DebugTextEncoding", [](std::string text) -> void {
     ImGui_DebugTextEncoding(text.c_str());
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_DebugTextEncoding_Interned", [](int text) -> void {
+    ImGui_DebugTextEncoding(get_interned_string(text));
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_DebugFlashStyleColor", [](ImGuiCol idx) -> void {
     ImGui_DebugFlashStyleColor(idx);
 });
@@ -4376,6 +7917,10 @@ bind_fn("ImGui_DebugCheckVersionAndDataLayout", [](std::string version_str, size
     return ImGui_DebugCheckVersionAndDataLayout(version_str.c_str(), sz_io, sz_style, sz_vec2, sz_vec4, sz_drawvert, sz_drawidx);
 }, allow_raw_ptrs{});
 
+bind_fn("ImGui_DebugCheckVersionAndDataLayout_Interned", [](int version_str, size_t sz_io, size_t sz_style, size_t sz_vec2, size_t sz_vec4, size_t sz_drawvert, size_t sz_drawidx) -> bool {
+    return ImGui_DebugCheckVersionAndDataLayout(get_interned_string(version_str), sz_io, sz_style, sz_vec2, sz_vec4, sz_drawvert, sz_drawidx);
+}, allow_raw_ptrs{});
+
 bind_fn("ImGui_DebugLog", [](std::string fmt){
     ImGui_DebugLog("%s", fmt.c_str());
 });
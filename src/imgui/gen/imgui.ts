@@ -4,13 +4,26 @@ export const Mod = {
   // biome-ignore lint/suspicious/noExplicitAny: _
   export: null as any,
 
-  async init(enableFreeType: boolean, extensions: boolean, loaderPath?: string): Promise<void> {
+  async init(variant: LoaderVariant, loaderPath?: string, wasmCache?: string): Promise<void> {
     // biome-ignore lint/suspicious/noExplicitAny: _
     let MainExport: any;
 
+    const { freetype, extensions, node, split, wasm, pthread } = variant;
+    const simd = variant.simd && hasWasmSimd();
+    const name =
+      `loader${extensions && !split ? "-extensions" : ""}${freetype ? "-freetype" : ""}` +
+      `${split ? "-split" : ""}${simd ? "-simd" : ""}${pthread ? "-pthread" : ""}` +
+      `${wasm && !split && !node ? "-wasm" : ""}${node ? "-node" : ""}`;
+
+    Mod.split = split;
+    Mod.name = name;
+
     if (loaderPath) {
       MainExport = await import(loaderPath);
-    } else if (enableFreeType) {
+    } else if (node || split || wasm || simd || pthread) {
+      // Loaders with a separate .wasm file (`build.ts --node|--split|--wasm`), SIMD and pthreads.
+      MainExport = await import(`./${name}.js`);
+    } else if (freetype) {
       MainExport = extensions
         ? // @ts-expect-error
           await import("./loader-freetype-extensions.js")
@@ -24,10 +37,144 @@ export const Mod = {
           await import("./loader.js");
     }
 
-    Mod.export = await MainExport.default();
+    // biome-ignore lint/suspicious/noExplicitAny: _
+    const moduleArgs: any = {};
+
+    // Emscripten waits for `receiveInstance` forever, so a failed instantiation rejects this.
+    let rejectInit: (error: unknown) => void = () => {};
+    const initFailed = new Promise<never>((_, reject) => {
+      rejectInit = reject;
+    });
+
+    if (wasmCache && !node && "caches" in globalThis) {
+      const url = loaderPath
+        ? new URL(loaderPath.replace(/\.js$/, ".wasm"), location.href).href
+        : new URL(`./${name}.wasm`, import.meta.url).href;
+
+      // biome-ignore lint/suspicious/noExplicitAny: _
+      moduleArgs.instantiateWasm = (imports: any, receiveInstance: any) => {
+        instantiateCachedWasm(url, wasmCache, imports)
+          .then(({ instance, module }) => receiveInstance(instance, module))
+          .catch(rejectInit);
+        return {};
+      };
+    }
+
+    Mod.export = await Promise.race([MainExport.default(moduleArgs), initFailed]);
+    Mod.loadedModules.clear();
+
+    // The pool pointers and string handles belong to the previous module's heap.
+    HeapView.pool = { ptr: 0, size: 0, used: 0 };
+    HeapView.retired.length = 0;
+    HeapView.pending.length = 0;
+    State.internedStrings.clear();
+    State.internedHandles.length = 0;
+  },
+
+  /**
+   * Whether the loader is a split build (`build.ts --split`) with side modules.
+   */
+  split: false,
+
+  /**
+   * The file name of the loader without extension, e.g. `loader-split-simd`.
+   */
+  name: "",
+
+  loadedModules: new Set<SideModule>(),
+
+  /**
+   * Loads side modules of a split build which are not loaded yet. Does nothing for the other
+   * builds, which have everything linked in.
+   */
+  async loadModules(modules: SideModule[]): Promise<void> {
+    if (!Mod.split) return;
+
+    for (const module of modules) {
+      if (Mod.loadedModules.has(module)) continue;
+
+      // Side modules share the ABI flags of their main module, see `build.ts`.
+      const url = new URL(`./side/${Mod.name}/${module}.wasm`, import.meta.url).href;
+      await Mod.export.loadDynamicLibrary(url, { loadAsync: true, global: true, nodelete: true });
+      Mod.loadedModules.add(module);
+    }
   },
 };
 
+/**
+ * The build variant of the emscripten loader, see the `build.ts` options.
+ */
+export interface LoaderVariant {
+  freetype: boolean;
+  extensions: boolean;
+  node: boolean;
+  split: boolean;
+  wasm: boolean;
+  simd: boolean;
+  pthread: boolean;
+}
+
+/**
+ * Whether the engine supports WASM SIMD, by validating a module using a `v128` instruction.
+ */
+const hasWasmSimd = (): boolean => {
+  return WebAssembly.validate(
+    new Uint8Array([
+      0, 97, 115, 109, 1, 0, 0, 0, 1, 5, 1, 96, 0, 1, 123, 3, 2, 1, 0, 10, 10, 1, 8, 0, 65, 0,
+      253, 15, 253, 98, 11,
+    ]),
+  );
+};
+
+/**
+ * Fetches the WASM, throwing on an error status instead of handing the error page to the compiler.
+ */
+async function fetchWasm(url: string): Promise<Response> {
+  const response = await fetch(url);
+  if (!response.ok) {
+    throw new Error(`jsimgui: Failed to fetch ${url}: ${response.status} ${response.statusText}`);
+  }
+  return response;
+}
+
+/**
+ * Instantiates the WASM from the Cache Storage, fetching and storing it on the first load. The
+ * response is compiled with `instantiateStreaming`, which also lets the browser reuse its cached
+ * machine code for the same response on repeat startups.
+ *
+ * If that fails, e.g. because the server doesn't send `application/wasm` or the cached file is
+ * stale, the cache entry is dropped and the WASM is fetched again and compiled from an
+ * `ArrayBuffer`. Errors of that attempt are thrown.
+ */
+async function instantiateCachedWasm(
+  url: string,
+  cacheName: string,
+  // biome-ignore lint/suspicious/noExplicitAny: _
+  imports: any,
+): Promise<WebAssembly.WebAssemblyInstantiatedSource> {
+  const cache = await caches.open(cacheName);
+
+  try {
+    let response = await cache.match(url);
+    if (!response) {
+      response = await fetchWasm(url);
+      await cache.put(url, response.clone());
+    }
+
+    return await WebAssembly.instantiateStreaming(response, imports);
+  } catch {
+    await cache.delete(url);
+  }
+
+  const response = await fetchWasm(url);
+  return WebAssembly.instantiate(await response.arrayBuffer(), imports);
+}
+
+/**
+ * Side modules of the split build (`build.ts --split`).
+ */
+export type SideModule = "demo" | "opengl3" | "wgpu" | "imnodes";
+
 /**
  * Base class for value structs (passed by value, no native pointer).
  */
@@ -76,58 +223,920 @@ export class ReferenceStruct {
 }
 
 /**
- * Default: 16-bit (for maximum compatibility with renderer backends)
+ * Typed arrays which can be passed to primitive pointer parameters (e.g. `float[3]`).
  */
-export type ImDrawIdx = number;
-
-// Scalar data types
+export type HeapViewType = Float32Array | Float64Array | Int32Array | Uint32Array;
 
 /**
- * A unique ID used by widgets (typically the result of hashing a stack of string)
- */
-export type ImGuiID = number;
-/**
- * 8-bit signed integer
- */
-export type ImS8 = number;
-/**
- * 8-bit unsigned integer
+ * Constructors of {@linkcode HeapViewType}.
  */
-export type ImU8 = number;
+export type HeapViewConstructor =
+  | Float32ArrayConstructor
+  | Float64ArrayConstructor
+  | Int32ArrayConstructor
+  | Uint32ArrayConstructor;
+
 /**
- * 16-bit signed integer
+ * Typed array living in the WASM heap. Passing its {@linkcode HeapArray.view} to functions like
+ * `ImGui.SliderFloat3` or `ImGui.ColorEdit4` lets the native code read and write the values in
+ * place, without any copying.
  */
-export type ImS16 = number;
+export class HeapArray<T extends HeapViewType = HeapViewType> {
+  /**
+   * The address of the first element in the WASM heap.
+   */
+  ptr = 0;
+
+  /**
+   * The number of elements.
+   */
+  length = 0;
+
+  type: HeapViewConstructor = Float32Array;
+
+  #view: T | null = null;
+
+  /**
+   * Allocate a new typed array in the WASM heap.
+   *
+   * @param type The typed array constructor, e.g. `Float32Array`.
+   * @param length The number of elements.
+   */
+  static New<T extends HeapViewType>(type: HeapViewConstructor, length: number): HeapArray<T> {
+    const arr = new HeapArray<T>();
+    arr.type = type;
+    arr.length = length;
+    arr.ptr = Mod.export.heap_alloc(length * type.BYTES_PER_ELEMENT);
+    return arr;
+  }
+
+  /**
+   * The typed array view onto the WASM heap. Access the view through this getter instead of
+   * keeping it around, since the view is detached whenever the WASM memory grows.
+   */
+  get view(): T {
+    if (this.#view?.buffer !== Mod.export.HEAPU8.buffer) {
+      this.#view = new this.type(Mod.export.HEAPU8.buffer, this.ptr, this.length) as T;
+    }
+    return this.#view as T;
+  }
+
+  /**
+   * Free the array's native allocated memory.
+   */
+  Drop(): void {
+    Mod.export.heap_free(this.ptr);
+    this.ptr = 0;
+    this.#view = null;
+  }
+}
+
 /**
- * 16-bit unsigned integer
+ * Passes typed arrays to the `_View` variants of the generated bindings. Views onto the WASM heap
+ * (see {@linkcode HeapArray}) are passed in place. Everything else is copied into a pooled scratch
+ * buffer and copied back in {@linkcode HeapView.Flush} after the call.
  */
-export type ImU16 = number;
+export const HeapView = {
+  pool: { ptr: 0, size: 0, used: 0 },
+  retired: [] as number[],
+  pending: [] as [ArrayLike<number> & { [i: number]: number }, number, HeapViewConstructor][],
+
+  /**
+   * Reserve `size` bytes in the scratch pool, growing it if needed. A replaced pool is kept alive
+   * until {@linkcode HeapView.Flush}, since earlier arguments of the same call may still use it.
+   */
+  Reserve(size: number): number {
+    const pool = HeapView.pool;
+    const offset = (pool.used + 7) & ~7;
+
+    if (offset + size > pool.size) {
+      if (pool.ptr) HeapView.retired.push(pool.ptr);
+      pool.size = Math.max(pool.size * 2, size, 256);
+      pool.ptr = Mod.export.heap_alloc(pool.size);
+      pool.used = size;
+      return pool.ptr;
+    }
+
+    pool.used = offset + size;
+    return pool.ptr + offset;
+  },
+
+  /**
+   * Returns the WASM heap address to pass for a primitive pointer parameter.
+   *
+   * @param value The typed array, array or null to pass.
+   * @param type The element type the native function expects.
+   * @param writeBack Whether the native function may write to the values.
+   * @param length The number of elements the native function accesses, e.g. 3 for `float[3]`.
+   */
+  In(
+    value: HeapViewType | number[] | null,
+    type: HeapViewConstructor,
+    writeBack = true,
+    length = 0,
+  ): number {
+    if (value === null) {
+      return 0;
+    }
+
+    if (value.length < length) {
+      throw new Error(`jsimgui: Expected at least ${length} values, got ${value.length}.`);
+    }
+
+    if (value instanceof type && value.buffer === Mod.export.HEAPU8.buffer) {
+      return value.byteOffset;
+    }
+
+    const ptr = HeapView.Reserve(value.length * type.BYTES_PER_ELEMENT);
+    new type(Mod.export.HEAPU8.buffer, ptr, value.length).set(value);
+
+    if (writeBack) {
+      HeapView.pending.push([value, ptr, type]);
+    }
+
+    return ptr;
+  },
+
+  /**
+   * Copies pooled values back to their arrays and resets the scratch pool. Called after each
+   * `_View` binding call.
+   */
+  Flush(): void {
+    for (const [value, ptr, type] of HeapView.pending) {
+      const src = new type(Mod.export.HEAPU8.buffer, ptr, value.length);
+      for (let i = 0; i < src.length; i++) {
+        value[i] = src[i];
+      }
+    }
+
+    for (const ptr of HeapView.retired) {
+      Mod.export.heap_free(ptr);
+    }
+
+    HeapView.pending.length = 0;
+    HeapView.retired.length = 0;
+    HeapView.pool.used = 0;
+  },
+
+  /**
+   * Returns `view` if it still covers `length` elements at `ptr` of the current WASM memory,
+   * otherwise a new view. For views onto native results which usually stay in place, so they
+   * aren't recreated on every call but still follow memory growth.
+   *
+   * @param view The view returned last time.
+   * @param type The typed array constructor, e.g. `Uint32Array`.
+   * @param ptr The WASM heap address of the result.
+   * @param length The number of elements of the result.
+   */
+  Cached<T extends HeapViewType | Uint8Array>(
+    view: T,
+    type: new (buffer: ArrayBufferLike, byteOffset: number, length: number) => T,
+    ptr: number,
+    length: number,
+  ): T {
+    const buffer = Mod.export.HEAPU8.buffer;
+    if (view.buffer === buffer && view.byteOffset === ptr && view.length === length) {
+      return view;
+    }
+
+    return new type(buffer, ptr, length);
+  },
+};
+
 /**
- * 32-bit signed integer == int
+ * Types of {@linkcode ColumnTable} and {@linkcode TableSorter} columns.
  */
-export type ImS32 = number;
+export const TableColumnType = {
+  /** Numbers from a `HeapArray<Float64Array>`, formatted like `%.3f`. */
+  Float64: 0,
+  /** Integers from a `HeapArray<Int32Array>`, formatted like `%d`. */
+  Int32: 1,
+  /** Indices from a `HeapArray<Int32Array>` into a string table. */
+  String: 2,
+} as const;
+
+export type TableColumnType = (typeof TableColumnType)[keyof typeof TableColumnType];
+
 /**
- * 32-bit unsigned integer (often used to store packed colors)
+ * Descriptor of a {@linkcode ColumnTable} column.
  */
-export type ImU32 = number;
+export interface TableColumn {
+  /**
+   * The header label.
+   */
+  label: string;
+
+  /**
+   * The type of the values.
+   */
+  type: TableColumnType;
+
+  /**
+   * The printf format of numeric cells, with exactly one conversion matching the type. Default is
+   * `%.3f` for `Float64` and `%d` for `Int32`.
+   */
+  format?: string;
+
+  /**
+   * The fixed width in pixels (with `ImGui.TableColumnFlags.WidthFixed`) or stretch weight.
+   */
+  width?: number;
+
+  /**
+   * The `ImGui.TableColumnFlags` of the column.
+   */
+  flags?: ImGuiTableColumnFlags;
+}
+
 /**
- * 64-bit signed integer
+ * Table rendered natively from columns in the WASM heap. One {@linkcode ColumnTable.Render} call
+ * clips the rows and formats and draws every visible cell in C++, instead of a `TableNextRow`,
+ * `TableSetColumnIndex` and `Text` call plus a string per cell from JS.
+ *
+ * The table only keeps the addresses of the column arrays, keep them alive while it is rendered.
+ * With `ImGui.TableFlags.Sortable`, the rows are shown sorted by the table's sort specs, see
+ * {@linkcode TableSorter}.
+ *
+ * @example
+ * ```ts
+ * const prices = HeapArray.New<Float64Array>(Float64Array, 100_000);
+ * const table = ColumnTable.New([
+ *     { label: "Price", type: TableColumnType.Float64, format: "%.2f" },
+ * ]);
+ * table.SetColumn(0, prices);
+ * table.Rows = prices.length;
+ *
+ * // Every frame:
+ * table.Render("prices");
+ * ```
  */
-export type ImS64 = bigint;
+export class ColumnTable extends ReferenceStruct {
+  /**
+   * Allocate a new table.
+   *
+   * @param columns The column descriptors.
+   */
+  static New(columns: TableColumn[]): ColumnTable {
+    const obj = new ColumnTable();
+    obj.ptr = new Mod.export.ColumnTable();
+
+    for (const column of columns) {
+      const format = column.format ?? (column.type === TableColumnType.Float64 ? "%.3f" : "%d");
+      const added = obj.ptr.AddColumn(
+        column.label,
+        column.type,
+        format,
+        column.flags ?? 0,
+        column.width ?? 0,
+      );
+
+      if (!added) {
+        obj.Drop();
+        throw new Error(`jsimgui: Invalid format "${format}" for table column "${column.label}".`);
+      }
+    }
+
+    return obj;
+  }
+
+  /**
+   * The number of rows. Columns shorter than this leave their remaining cells empty.
+   */
+  get Rows(): number {
+    return this.ptr.get_Rows();
+  }
+  set Rows(v: number) {
+    this.ptr.set_Rows(v);
+  }
+
+  /**
+   * Whether to sort on another thread, see {@linkcode TableSorter.Async}.
+   */
+  set Async(v: boolean) {
+    this.ptr.set_Async(v);
+  }
+
+  /**
+   * Point a numeric column at its values.
+   *
+   * @param column The column index.
+   * @param values The values, a `Float64Array` or `Int32Array` array matching the column type.
+   */
+  SetColumn(column: number, values: HeapArray<Float64Array> | HeapArray<Int32Array>): void {
+    const type = values.type === Float64Array ? TableColumnType.Float64 : TableColumnType.Int32;
+    if (!this.ptr.SetColumnData(column, type, values.ptr, values.length)) {
+      throw new Error(`jsimgui: Table column ${column} doesn't take ${values.type.name} values.`);
+    }
+  }
+
+  /**
+   * Sort the rows again on the next render, after the column values were changed in place.
+   */
+  Invalidate(): void {
+    this.ptr.Invalidate();
+  }
+
+  /**
+   * Point a string column at its indices into a string table, which is copied into the WASM heap.
+   * Indices outside of the table leave the cell empty.
+   *
+   * @param column The column index.
+   * @param indices The index into `table` of each row.
+   * @param table The strings.
+   */
+  SetStringColumn(column: number, indices: HeapArray<Int32Array>, table: string[]): void {
+    const set =
+      indices.type === Int32Array &&
+      this.ptr.SetColumnData(column, TableColumnType.String, indices.ptr, indices.length) &&
+      this.ptr.SetStringTable(column, table);
+
+    if (!set) {
+      throw new Error(`jsimgui: Table column ${column} isn't a string column.`);
+    }
+  }
+
+  /**
+   * Render the table with a frozen header row, drawing only the visible rows. Sortable tables
+   * sort the rows when their sort specs change.
+   *
+   * @param id The table ID.
+   * @param flags The `ImGui.TableFlags`, scrolling by default.
+   * @param outerSize The outer size of the table, fills the window by default.
+   * @returns Whether the table is visible.
+   */
+  Render(
+    id: string,
+    flags: ImGuiTableFlags = ImGui.TableFlags.ScrollY |
+      ImGui.TableFlags.RowBg |
+      ImGui.TableFlags.BordersV |
+      ImGui.TableFlags.Resizable,
+    outerSize: ImVec2 = new ImVec2(0, 0),
+  ): boolean {
+    return this.ptr.Render(id, flags, outerSize);
+  }
+}
+
 /**
- * 64-bit unsigned integer
+ * Sorts the rows of a table natively by its `ImGuiTableSortSpecs`, for tables rendered from JS
+ * ({@linkcode ColumnTable} sorts by itself). The columns are typed arrays in the WASM heap,
+ * indexed like the table columns. {@linkcode TableSorter.Sort} returns the row permutation of a
+ * stable multi-key merge sort, which is cached until the specs change or are marked dirty.
+ *
+ * @example
+ * ```ts
+ * const sorter = TableSorter.New();
+ * sorter.SetColumn(0, ids);
+ * sorter.SetColumn(1, prices);
+ * sorter.Rows = ids.length;
+ *
+ * // Every frame, after the table columns are set up:
+ * const order = sorter.Sort();
+ * clipper.Begin(order.length);
+ * while (clipper.Step()) {
+ *     for (let i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+ *         const row = order[i];
+ *         // ...
+ *     }
+ * }
+ * ```
  */
-export type ImU64 = bigint;
+export class TableSorter extends ReferenceStruct {
+  #view = new Uint32Array(0);
 
-// Enumerations
-// - We don't use strongly typed enums much because they add constraints (can't extend in private code, can't store typed in bit fields, extra casting on iteration)
-// - Tip: Use your programming IDE navigation facilities on the names in the _central column_ below to find the actual flags/enum lists!
-//   - In Visual Studio: Ctrl+Comma ("Edit.GoToAll") can follow symbols inside comments, whereas Ctrl+F12 ("Edit.GoToImplementation") cannot.
-//   - In Visual Studio w/ Visual Assist installed: Alt+G ("VAssistX.GoToImplementation") can also follow symbols inside comments.
-//   - In VS Code, CLion, etc.: Ctrl+Click can follow symbols inside comments.
+  /**
+   * Allocate a new sorter.
+   */
+  static New(): TableSorter {
+    const obj = new TableSorter();
+    obj.ptr = new Mod.export.TableSorter();
+    return obj;
+  }
+
+  /**
+   * The number of rows. Rows past the end of a column sort last.
+   */
+  get Rows(): number {
+    return this.ptr.get_Rows();
+  }
+  set Rows(v: number) {
+    this.ptr.set_Rows(v);
+  }
+
+  /**
+   * Whether to sort on another thread, only with the pthreads loader (`build.ts --pthread`).
+   * {@linkcode TableSorter.Sort} then keeps returning the previous order until the sort is done.
+   * The sorted columns are copied when the sort starts, so they can be changed or dropped while
+   * {@linkcode TableSorter.Busy}.
+   */
+  get Async(): boolean {
+    return this.ptr.get_Async();
+  }
+  set Async(v: boolean) {
+    this.ptr.set_Async(v);
+  }
+
+  /**
+   * Whether an async sort is still running.
+   */
+  get Busy(): boolean {
+    return this.ptr.get_Busy();
+  }
+
+  /**
+   * Point a numeric column at its values.
+   *
+   * @param column The table column index.
+   * @param values The values.
+   */
+  SetColumn(column: number, values: HeapArray<Float64Array> | HeapArray<Int32Array>): void {
+    const type = values.type === Float64Array ? TableColumnType.Float64 : TableColumnType.Int32;
+    if (!this.ptr.SetColumnData(column, type, values.ptr, values.length)) {
+      throw new Error(`jsimgui: Invalid table column ${column}.`);
+    }
+  }
+
+  /**
+   * Point a string column at its indices into a string table, which is copied into the WASM heap.
+   * Rows are sorted by their strings, indices outside of the table sort last.
+   *
+   * @param column The table column index.
+   * @param indices The index into `table` of each row.
+   * @param table The strings.
+   */
+  SetStringColumn(column: number, indices: HeapArray<Int32Array>, table: string[]): void {
+    const set =
+      this.ptr.SetColumnData(column, TableColumnType.String, indices.ptr, indices.length) &&
+      this.ptr.SetStringTable(column, table);
+
+    if (!set) {
+      throw new Error(`jsimgui: Invalid table column ${column}.`);
+    }
+  }
+
+  /**
+   * Sort again on the next {@linkcode TableSorter.Sort}, after the column values were changed in
+   * place.
+   */
+  Invalidate(): void {
+    this.ptr.Invalidate();
+  }
+
+  /**
+   * Returns the row permutation for the sort specs, sorting only if they changed, and clears
+   * their `SpecsDirty`. Without sort specs the rows keep their order.
+   *
+   * The returned view onto the WASM heap is valid until the next call.
+   *
+   * @param specs The sort specs, defaults to those of the current table.
+   */
+  Sort(specs: ImGuiTableSortSpecs = ImGui.TableGetSortSpecs()): Uint32Array {
+    const ptr = this.ptr.Sort(specs?.ptr ?? null);
+    const length = this.ptr.get_Rows();
+
+    this.#view = HeapView.Cached(this.#view, Uint32Array, ptr, length);
+    return this.#view;
+  }
+}
 
 /**
- * -> enum ImGuiDir              // Enum: A cardinal direction (Left, Right, Up, Down)
+ * Filters a list of strings natively with the `ImGuiTextFilter` syntax: comma separated terms,
+ * a leading `-` excludes, matching is case-insensitive for ASCII. The strings are loaded once as a
+ * packed UTF-8 pool, each filter change scans it (vectorized in the SIMD build) instead of calling
+ * `String.includes` per item in JS.
+ *
+ * @example
+ * ```ts
+ * const index = TextFilterIndex.New();
+ * index.Load(items);
+ *
+ * // Every frame:
+ * ImGui.InputText("Filter", filter, 256);
+ * const matches = index.Filter(filter[0]);
+ * clipper.Begin(matches.length);
+ * while (clipper.Step()) {
+ *     for (let i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+ *         ImGui.Text(items[matches[i]]);
+ *     }
+ * }
+ * ```
+ */
+export class TextFilterIndex extends ReferenceStruct {
+  #view = new Uint32Array(0);
+
+  /**
+   * Allocate a new filter index.
+   */
+  static New(): TextFilterIndex {
+    const obj = new TextFilterIndex();
+    obj.ptr = new Mod.export.TextFilterIndex();
+    return obj;
+  }
+
+  /**
+   * The number of loaded strings.
+   */
+  get Count(): number {
+    return this.ptr.get_Count();
+  }
+
+  /**
+   * Load the strings to filter, replacing the previous ones. They are UTF-8 encoded straight into
+   * the WASM heap and copied into the index.
+   *
+   * @param items The strings.
+   */
+  Load(items: string[]): void {
+    // UTF-16 code units take at most 3 bytes in UTF-8.
+    const capacity = items.reduce((sum, item) => sum + item.length * 3, 0);
+    const data = Mod.export.heap_alloc(Math.max(capacity, 1));
+    const offsets = HeapArray.New<Uint32Array>(Uint32Array, items.length + 1);
+
+    try {
+      const encoder = new TextEncoder();
+      const pool = new Uint8Array(Mod.export.HEAPU8.buffer, data, capacity);
+      const starts = offsets.view;
+
+      let end = 0;
+      for (let i = 0; i < items.length; i++) {
+        starts[i] = end;
+        end += encoder.encodeInto(items[i], pool.subarray(end)).written;
+      }
+      starts[items.length] = end;
+
+      if (!this.ptr.Load(data, offsets.ptr, items.length)) {
+        throw new Error("jsimgui: Failed to load the text filter index.");
+      }
+    } finally {
+      Mod.export.heap_free(data);
+      offsets.Drop();
+    }
+  }
+
+  /**
+   * Returns the indices of the strings passing the filter, scanning only when the filter changed
+   * since the last call.
+   *
+   * The returned view onto the WASM heap is valid until the next call.
+   *
+   * @param filter The filter, e.g. `"apple,-pie"`.
+   */
+  Filter(filter: string): Uint32Array {
+    const ptr = this.ptr.Apply(filter);
+    const length = this.ptr.get_MatchCount();
+
+    this.#view = HeapView.Cached(this.#view, Uint32Array, ptr, length);
+    return this.#view;
+  }
+}
+
+/**
+ * Dear ImGui's text filter ("aaa,-bbb": comma separated terms, a leading `-` excludes), for
+ * filtering in JS item by item. Prefer {@linkcode TextFilterIndex} for long lists.
+ *
+ * @example
+ * ```ts
+ * const filter = ImGuiTextFilter.New();
+ *
+ * // Every frame:
+ * filter.Draw();
+ * for (const item of items) {
+ *     if (filter.PassFilter(item)) ImGui.Text(item);
+ * }
+ * ```
+ */
+export class ImGuiTextFilter extends ReferenceStruct {
+  /**
+   * Allocate a new text filter.
+   *
+   * @param filter The initial filter text.
+   */
+  static New(filter = ""): ImGuiTextFilter {
+    const obj = new ImGuiTextFilter();
+    obj.ptr = new Mod.export.ImGuiTextFilter(filter);
+    return obj;
+  }
+
+  /**
+   * The filter text, parsed again when set. Longer text than 255 bytes is truncated.
+   */
+  get InputBuf(): string {
+    return this.ptr.get_InputBuf();
+  }
+  set InputBuf(v: string) {
+    this.ptr.Set(v);
+  }
+
+  /**
+   * Draw an input text editing the filter.
+   *
+   * @param label The label.
+   * @param width The width, `0` for the default item width.
+   * @returns Whether the filter changed.
+   */
+  Draw(label = "Filter (inc,-exc)", width = 0): boolean {
+    return this.ptr.Draw(label, width);
+  }
+
+  /**
+   * Whether the filter has any term.
+   */
+  IsActive(): boolean {
+    return this.ptr.IsActive();
+  }
+
+  /**
+   * Whether the text passes the filter.
+   *
+   * @param text The text.
+   */
+  PassFilter(text: string): boolean {
+    return this.ptr.PassFilter(text);
+  }
+}
+
+/**
+ * Append-only log console living in the WASM heap. Appended text is UTF-8 encoded straight into
+ * the native buffer, which indexes the line starts and evicts the oldest lines over its limits.
+ * `Render` draws only the visible lines through an `ImGuiListClipper` in a single call, so neither
+ * appending nor drawing creates a JS string per line.
+ *
+ * @example
+ * ```ts
+ * const log = LogBuffer.New();
+ * worker.onmessage = (event) => log.Append(event.data); // Batches of "\n" terminated lines.
+ *
+ * // Every frame:
+ * ImGui.Begin("Log");
+ * log.Render("lines");
+ * ImGui.End();
+ * ```
+ */
+export class LogBuffer extends ReferenceStruct {
+  static #encoder = new TextEncoder();
+
+  /**
+   * Allocate a new log.
+   *
+   * @param maxLines The number of lines kept before the oldest ones are evicted.
+   * @param maxBytes The number of bytes kept before the oldest lines are evicted.
+   */
+  static New(maxLines = 100_000, maxBytes = 16 * 1024 * 1024): LogBuffer {
+    const obj = new LogBuffer();
+    obj.ptr = new Mod.export.LogBuffer(maxLines, maxBytes);
+    return obj;
+  }
+
+  /**
+   * The number of lines, not counting an empty last line after a trailing newline.
+   */
+  get LineCount(): number {
+    return this.ptr.get_LineCount();
+  }
+
+  /**
+   * The number of bytes of the kept lines.
+   */
+  get ByteCount(): number {
+    return this.ptr.get_ByteCount();
+  }
+
+  /**
+   * The text of a kept line without its line ending.
+   *
+   * @param index The line, `0` being the oldest kept one.
+   */
+  Line(index: number): string {
+    if (!Number.isInteger(index) || index < 0 || index >= this.LineCount) {
+      throw new Error(`jsimgui: Invalid log line ${index}.`);
+    }
+
+    return this.ptr.GetLine(index);
+  }
+
+  /**
+   * Append text, split into lines at `\n`. Text not ending in a newline is continued by the next
+   * append, until the line exceeds `maxBytes` and is split. Batch many lines into one call, each
+   * call crosses into WASM twice.
+   *
+   * @param text The text, or its UTF-8 bytes.
+   */
+  Append(text: string | Uint8Array): void {
+    if (typeof text === "string") {
+      // UTF-16 code units take at most 3 bytes in UTF-8.
+      const capacity = text.length * 3;
+      const ptr = this.ptr.Reserve(capacity);
+      const dest = Mod.export.HEAPU8.subarray(ptr, ptr + capacity);
+      this.ptr.Commit(LogBuffer.#encoder.encodeInto(text, dest).written);
+    } else {
+      const ptr = this.ptr.Reserve(text.length);
+      Mod.export.HEAPU8.set(text, ptr);
+      this.ptr.Commit(text.length);
+    }
+  }
+
+  /**
+   * Remove all lines.
+   */
+  Clear(): void {
+    this.ptr.Clear();
+  }
+
+  /**
+   * Draw the lines in a child window.
+   *
+   * @param id The child window id.
+   * @param size The child window size, `(0, 0)` fills the remaining space.
+   * @param autoScroll Keep the view at the newest line while it is scrolled to the bottom.
+   */
+  Render(id: string, size: ImVec2 = new ImVec2(0, 0), autoScroll = true): void {
+    this.ptr.Render(id, size, autoScroll);
+  }
+}
+
+/**
+ * Text buffer living in the WASM heap across frames for `ImGui.InputText`,
+ * `ImGui.InputTextMultiline` and `ImGui.InputTextWithHint`. It grows as the text does and, unlike
+ * a `[string]` buffer, isn't copied from and back to JS every frame. The text is only decoded when
+ * read after an edit.
+ *
+ * @example
+ * ```ts
+ * const config = TextBuffer.New(await file.text());
+ *
+ * // Every frame:
+ * if (ImGui.InputTextMultiline("##config", config, 0, new ImVec2(-1, -1))) {
+ *     validate(config.Text);
+ * }
+ * ```
+ */
+export class TextBuffer extends ReferenceStruct {
+  static #decoder = new TextDecoder();
+  #view = new Uint8Array(0);
+  #text = "";
+  #textVersion = 0;
+
+  /**
+   * Allocate a new text buffer.
+   *
+   * @param text The initial text.
+   */
+  static New(text = ""): TextBuffer {
+    const obj = new TextBuffer();
+    obj.ptr = new Mod.export.TextBuffer();
+    if (text) obj.Text = text;
+    return obj;
+  }
+
+  /**
+   * Incremented whenever the text changes, compare it to detect edits without reading the text.
+   */
+  get Version(): number {
+    return this.ptr.get_Version();
+  }
+
+  /**
+   * The length of the text in UTF-8 bytes.
+   */
+  get Length(): number {
+    return this.ptr.get_Length();
+  }
+
+  /**
+   * The UTF-8 text without a terminator, a view onto the WASM heap valid until the next edit.
+   */
+  get Bytes(): Uint8Array {
+    const ptr = this.ptr.get_Data();
+    const length = this.ptr.get_Length();
+
+    this.#view = HeapView.Cached(this.#view, Uint8Array, ptr, length);
+    return this.#view;
+  }
+
+  /**
+   * The text, decoded only if it changed since the last read.
+   */
+  get Text(): string {
+    const version = this.Version;
+    if (version !== this.#textVersion) {
+      const bytes = this.Bytes;
+      // TextDecoder rejects views onto a SharedArrayBuffer, decode a copy in pthread builds.
+      const source = bytes.buffer instanceof ArrayBuffer ? bytes : bytes.slice();
+      this.#text = TextBuffer.#decoder.decode(source);
+      this.#textVersion = version;
+    }
+
+    return this.#text;
+  }
+
+  set Text(text: string) {
+    this.ptr.Set(text);
+    this.#text = text;
+    this.#textVersion = this.Version;
+  }
+}
+
+/**
+ * Fixed capacity ring buffer of plot samples living in the WASM heap. Pass it to
+ * `ImGui.PlotLines`/`ImGui.PlotHistogram` instead of an array, so only newly pushed samples
+ * cross into WASM instead of the whole history every frame.
+ */
+export class PlotRingBuffer extends ReferenceStruct {
+  /**
+   * Allocate a new ring buffer.
+   *
+   * @param capacity The maximum number of samples kept, older samples are overwritten.
+   */
+  static New(capacity: number): PlotRingBuffer {
+    const obj = new PlotRingBuffer();
+    obj.ptr = new Mod.export.PlotRingBuffer(capacity);
+    return obj;
+  }
+
+  /**
+   * The number of samples currently stored.
+   */
+  get Size(): number {
+    return this.ptr.get_Size();
+  }
+
+  /**
+   * The maximum number of samples stored.
+   */
+  get Capacity(): number {
+    return this.ptr.get_Capacity();
+  }
+
+  /**
+   * Append samples, overwriting the oldest ones once the buffer is full.
+   *
+   * @param values The new samples.
+   */
+  Push(values: Float32Array | number[]): void {
+    this.ptr.Push(HeapView.In(values, Float32Array, false), values.length);
+    HeapView.Flush();
+  }
+
+  /**
+   * Remove all samples.
+   */
+  Clear(): void {
+    this.ptr.Clear();
+  }
+}
+
+/**
+ * Default: 16-bit (for maximum compatibility with renderer backends)
+ */
+export type ImDrawIdx = number;
+
+// Scalar data types
+
+/**
+ * A unique ID used by widgets (typically the result of hashing a stack of string)
+ */
+export type ImGuiID = number;
+/**
+ * 8-bit signed integer
+ */
+export type ImS8 = number;
+/**
+ * 8-bit unsigned integer
+ */
+export type ImU8 = number;
+/**
+ * 16-bit signed integer
+ */
+export type ImS16 = number;
+/**
+ * 16-bit unsigned integer
+ */
+export type ImU16 = number;
+/**
+ * 32-bit signed integer == int
+ */
+export type ImS32 = number;
+/**
+ * 32-bit unsigned integer (often used to store packed colors)
+ */
+export type ImU32 = number;
+/**
+ * 64-bit signed integer
+ */
+export type ImS64 = bigint;
+/**
+ * 64-bit unsigned integer
+ */
+export type ImU64 = bigint;
+
+// Enumerations
+// - We don't use strongly typed enums much because they add constraints (can't extend in private code, can't store typed in bit fields, extra casting on iteration)
+// - Tip: Use your programming IDE navigation facilities on the names in the _central column_ below to find the actual flags/enum lists!
+//   - In Visual Studio: Ctrl+Comma ("Edit.GoToAll") can follow symbols inside comments, whereas Ctrl+F12 ("Edit.GoToImplementation") cannot.
+//   - In Visual Studio w/ Visual Assist installed: Alt+G ("VAssistX.GoToImplementation") can also follow symbols inside comments.
+//   - In VS Code, CLion, etc.: Ctrl+Click can follow symbols inside comments.
+
+/**
+ * -> enum ImGuiDir              // Enum: A cardinal direction (Left, Right, Up, Down)
  */
 export type ImGuiDir = number;
 /**
@@ -6753,21 +7762,33 @@ export const ImGui = {
 
   /**
    * access the ImGuiIO structure (mouse/keyboard/gamepad inputs, time, various configuration options/flags)
+   *
+   * The wrapper is cached for the current context, see ContextStructs in imgui.ts.
    */
   GetIO(): ImGuiIO {
-    return ImGuiIO.From(Mod.export.ImGui_GetIO());
+    const structs = ContextStructs.Current();
+    structs.io ??= ImGuiIO.From(Mod.export.ImGui_GetIO());
+    return structs.io;
   },
   /**
    * access the ImGuiPlatformIO structure (mostly hooks/functions to connect to platform/renderer and OS Clipboard, IME etc.)
+   *
+   * The wrapper is cached for the current context, see ContextStructs in imgui.ts.
    */
   GetPlatformIO(): ImGuiPlatformIO {
-    return ImGuiPlatformIO.From(Mod.export.ImGui_GetPlatformIO());
+    const structs = ContextStructs.Current();
+    structs.platformIO ??= ImGuiPlatformIO.From(Mod.export.ImGui_GetPlatformIO());
+    return structs.platformIO;
   },
   /**
    * access the Style structure (colors, sizes). Always use PushStyleColor(), PushStyleVar() to modify style mid-frame!
+   *
+   * The wrapper is cached for the current context, see ContextStructs in imgui.ts.
    */
   GetStyle(): ImGuiStyle {
-    return ImGuiStyle.From(Mod.export.ImGui_GetStyle());
+    const structs = ContextStructs.Current();
+    structs.style ??= ImGuiStyle.From(Mod.export.ImGui_GetStyle());
+    return structs.style;
   },
   /**
    * start a new Dear ImGui frame, you can submit any command from this point until Render()/EndFrame().
@@ -6835,13 +7856,20 @@ export const ImGui = {
   /**
    * add style selector block (not a window), essentially a combo listing the default styles.
    */
-  ShowStyleSelector(label: string): boolean {
+  ShowStyleSelector(label: string | ImStrHandle): boolean {
+    if (typeof label === "number") {
+      return Mod.export.ImGui_ShowStyleSelector_Interned(label);
+    }
     return Mod.export.ImGui_ShowStyleSelector(label);
   },
   /**
    * add font selector block (not a window), essentially a combo listing the loaded fonts.
    */
-  ShowFontSelector(label: string): void {
+  ShowFontSelector(label: string | ImStrHandle): void {
+    if (typeof label === "number") {
+      Mod.export.ImGui_ShowFontSelector_Interned(label);
+      return;
+    }
     Mod.export.ImGui_ShowFontSelector(label);
   },
   /**
@@ -6891,7 +7919,14 @@ export const ImGui = {
    *    BeginXXX function returned true. Begin and BeginChild are the only odd ones out. Will be fixed in a future update.]
    * - Note that the bottom of window stack always contains a window called "Debug".
    */
-  Begin(name: string, p_open: [boolean] | null = null, flags: ImGuiWindowFlags = 0): boolean {
+  Begin(
+    name: string | ImStrHandle,
+    p_open: [boolean] | null = null,
+    flags: ImGuiWindowFlags = 0,
+  ): boolean {
+    if (typeof name === "number") {
+      return Mod.export.ImGui_Begin_Interned(name, p_open, flags);
+    }
     return Mod.export.ImGui_Begin(name, p_open, flags);
   },
   End(): void {
@@ -6918,11 +7953,14 @@ export const ImGui = {
    *    BeginXXX function returned true. Begin and BeginChild are the only odd ones out. Will be fixed in a future update.]
    */
   BeginChild(
-    str_id: string,
+    str_id: string | ImStrHandle,
     size: ImVec2 = new ImVec2(0, 0),
     child_flags: ImGuiChildFlags = 0,
     window_flags: ImGuiWindowFlags = 0,
   ): boolean {
+    if (typeof str_id === "number") {
+      return Mod.export.ImGui_BeginChild_Interned(str_id, size, child_flags, window_flags);
+    }
     return Mod.export.ImGui_BeginChild(str_id, size, child_flags, window_flags);
   },
   BeginChildID(
@@ -7082,25 +8120,41 @@ export const ImGui = {
   /**
    * set named window position.
    */
-  SetWindowPosStr(name: string, pos: ImVec2, cond: ImGuiCond = 0): void {
+  SetWindowPosStr(name: string | ImStrHandle, pos: ImVec2, cond: ImGuiCond = 0): void {
+    if (typeof name === "number") {
+      Mod.export.ImGui_SetWindowPosStr_Interned(name, pos, cond);
+      return;
+    }
     Mod.export.ImGui_SetWindowPosStr(name, pos, cond);
   },
   /**
    * set named window size. set axis to 0.0f to force an auto-fit on this axis.
    */
-  SetWindowSizeStr(name: string, size: ImVec2, cond: ImGuiCond = 0): void {
+  SetWindowSizeStr(name: string | ImStrHandle, size: ImVec2, cond: ImGuiCond = 0): void {
+    if (typeof name === "number") {
+      Mod.export.ImGui_SetWindowSizeStr_Interned(name, size, cond);
+      return;
+    }
     Mod.export.ImGui_SetWindowSizeStr(name, size, cond);
   },
   /**
    * set named window collapsed state
    */
-  SetWindowCollapsedStr(name: string, collapsed: boolean, cond: ImGuiCond = 0): void {
+  SetWindowCollapsedStr(name: string | ImStrHandle, collapsed: boolean, cond: ImGuiCond = 0): void {
+    if (typeof name === "number") {
+      Mod.export.ImGui_SetWindowCollapsedStr_Interned(name, collapsed, cond);
+      return;
+    }
     Mod.export.ImGui_SetWindowCollapsedStr(name, collapsed, cond);
   },
   /**
    * set named window to be focused / top-most. use NULL to remove focus.
    */
-  SetWindowFocusStr(name: string): void {
+  SetWindowFocusStr(name: string | ImStrHandle): void {
+    if (typeof name === "number") {
+      Mod.export.ImGui_SetWindowFocusStr_Interned(name);
+      return;
+    }
     Mod.export.ImGui_SetWindowFocusStr(name);
   },
 
@@ -7506,7 +8560,11 @@ export const ImGui = {
   /**
    * push string into the ID stack (will hash string).
    */
-  PushID(str_id: string): void {
+  PushID(str_id: string | ImStrHandle): void {
+    if (typeof str_id === "number") {
+      Mod.export.ImGui_PushID_Interned(str_id);
+      return;
+    }
     Mod.export.ImGui_PushID(str_id);
   },
   /**
@@ -7524,34 +8582,65 @@ export const ImGui = {
   /**
    * calculate unique ID (hash of whole ID stack + given parameter). e.g. if you want to query into ImGuiStorage yourself
    */
-  GetID(str_id: string): ImGuiID {
+  GetID(str_id: string | ImStrHandle): ImGuiID {
+    if (typeof str_id === "number") {
+      return Mod.export.ImGui_GetID_Interned(str_id);
+    }
     return Mod.export.ImGui_GetID(str_id);
   },
   GetIDInt(int_id: number): ImGuiID {
     return Mod.export.ImGui_GetIDInt(int_id);
   },
-  Text(fmt: string): void {
+  Text(fmt: string | ImStrHandle): void {
+    if (typeof fmt === "number") {
+      Mod.export.ImGui_Text_Interned(fmt);
+      return;
+    }
     Mod.export.ImGui_Text(fmt);
   },
-  TextColored(col: ImVec4, fmt: string): void {
+  TextColored(col: ImVec4, fmt: string | ImStrHandle): void {
+    if (typeof fmt === "number") {
+      Mod.export.ImGui_TextColored_Interned(col, fmt);
+      return;
+    }
     Mod.export.ImGui_TextColored(col, fmt);
   },
-  TextDisabled(fmt: string): void {
+  TextDisabled(fmt: string | ImStrHandle): void {
+    if (typeof fmt === "number") {
+      Mod.export.ImGui_TextDisabled_Interned(fmt);
+      return;
+    }
     Mod.export.ImGui_TextDisabled(fmt);
   },
-  TextWrapped(fmt: string): void {
+  TextWrapped(fmt: string | ImStrHandle): void {
+    if (typeof fmt === "number") {
+      Mod.export.ImGui_TextWrapped_Interned(fmt);
+      return;
+    }
     Mod.export.ImGui_TextWrapped(fmt);
   },
-  LabelText(label: string, fmt: string): void {
+  LabelText(label: string | ImStrHandle, fmt: string | ImStrHandle): void {
+    if (typeof label === "number" && typeof fmt === "number") {
+      Mod.export.ImGui_LabelText_Interned(label, fmt);
+      return;
+    }
     Mod.export.ImGui_LabelText(label, fmt);
   },
-  BulletText(fmt: string): void {
+  BulletText(fmt: string | ImStrHandle): void {
+    if (typeof fmt === "number") {
+      Mod.export.ImGui_BulletText_Interned(fmt);
+      return;
+    }
     Mod.export.ImGui_BulletText(fmt);
   },
   /**
    * currently: formatted text with a horizontal line
    */
-  SeparatorText(label: string): void {
+  SeparatorText(label: string | ImStrHandle): void {
+    if (typeof label === "number") {
+      Mod.export.ImGui_SeparatorText_Interned(label);
+      return;
+    }
     Mod.export.ImGui_SeparatorText(label);
   },
 
@@ -7562,53 +8651,145 @@ export const ImGui = {
   /**
    * button
    */
-  Button(label: string, size: ImVec2 = new ImVec2(0, 0)): boolean {
+  Button(label: string | ImStrHandle, size: ImVec2 = new ImVec2(0, 0)): boolean {
+    if (typeof label === "number") {
+      return Mod.export.ImGui_Button_Interned(label, size);
+    }
     return Mod.export.ImGui_Button(label, size);
   },
   /**
    * button with (FramePadding.y == 0) to easily embed within text
    */
-  SmallButton(label: string): boolean {
+  SmallButton(label: string | ImStrHandle): boolean {
+    if (typeof label === "number") {
+      return Mod.export.ImGui_SmallButton_Interned(label);
+    }
     return Mod.export.ImGui_SmallButton(label);
   },
   /**
    * flexible button behavior without the visuals, frequently useful to build custom behaviors using the public api (along with IsItemActive, IsItemHovered, etc.)
    */
-  InvisibleButton(str_id: string, size: ImVec2, flags: ImGuiButtonFlags = 0): boolean {
+  InvisibleButton(
+    str_id: string | ImStrHandle,
+    size: ImVec2,
+    flags: ImGuiButtonFlags = 0,
+  ): boolean {
+    if (typeof str_id === "number") {
+      return Mod.export.ImGui_InvisibleButton_Interned(str_id, size, flags);
+    }
     return Mod.export.ImGui_InvisibleButton(str_id, size, flags);
   },
   /**
    * square button with an arrow shape
    */
-  ArrowButton(str_id: string, dir: ImGuiDir): boolean {
+  ArrowButton(str_id: string | ImStrHandle, dir: ImGuiDir): boolean {
+    if (typeof str_id === "number") {
+      return Mod.export.ImGui_ArrowButton_Interned(str_id, dir);
+    }
     return Mod.export.ImGui_ArrowButton(str_id, dir);
   },
-  Checkbox(label: string, v: [boolean]): boolean {
+  Checkbox(label: string | ImStrHandle, v: [boolean]): boolean {
+    if (typeof label === "number") {
+      return Mod.export.ImGui_Checkbox_Interned(label, v);
+    }
     return Mod.export.ImGui_Checkbox(label, v);
   },
-  CheckboxFlagsIntPtr(label: string, flags: [number], flags_value: number): boolean {
-    return Mod.export.ImGui_CheckboxFlagsIntPtr(label, flags, flags_value);
+  CheckboxFlagsIntPtr(
+    label: string | ImStrHandle,
+    flags: [number] | Int32Array,
+    flags_value: number,
+  ): boolean {
+    if (typeof label === "number") {
+      const ret = Mod.export.ImGui_CheckboxFlagsIntPtr_Interned(
+        label,
+        HeapView.In(flags, Int32Array, true, 1),
+        flags_value,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(flags)) {
+      const ret = Mod.export.ImGui_CheckboxFlagsIntPtr_View(
+        label,
+        HeapView.In(flags, Int32Array, true, 1),
+        flags_value,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_CheckboxFlagsIntPtr(label, flags, flags_value);
   },
-  CheckboxFlagsUintPtr(label: string, flags: [number], flags_value: number): boolean {
+  CheckboxFlagsUintPtr(
+    label: string | ImStrHandle,
+    flags: [number] | Uint32Array,
+    flags_value: number,
+  ): boolean {
+    if (typeof label === "number") {
+      const ret = Mod.export.ImGui_CheckboxFlagsUintPtr_Interned(
+        label,
+        HeapView.In(flags, Uint32Array, true, 1),
+        flags_value,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(flags)) {
+      const ret = Mod.export.ImGui_CheckboxFlagsUintPtr_View(
+        label,
+        HeapView.In(flags, Uint32Array, true, 1),
+        flags_value,
+      );
+      HeapView.Flush();
+      return ret;
+    }
     return Mod.export.ImGui_CheckboxFlagsUintPtr(label, flags, flags_value);
   },
   /**
    * use with e.g. if (RadioButton("one", my_value==1)) { my_value = 1; }
    */
-  RadioButton(label: string, active: boolean): boolean {
+  RadioButton(label: string | ImStrHandle, active: boolean): boolean {
+    if (typeof label === "number") {
+      return Mod.export.ImGui_RadioButton_Interned(label, active);
+    }
     return Mod.export.ImGui_RadioButton(label, active);
   },
   /**
    * shortcut to handle the above pattern when value is an integer
    */
-  RadioButtonIntPtr(label: string, v: [number], v_button: number): boolean {
+  RadioButtonIntPtr(
+    label: string | ImStrHandle,
+    v: [number] | Int32Array,
+    v_button: number,
+  ): boolean {
+    if (typeof label === "number") {
+      const ret = Mod.export.ImGui_RadioButtonIntPtr_Interned(
+        label,
+        HeapView.In(v, Int32Array, true, 1),
+        v_button,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_RadioButtonIntPtr_View(
+        label,
+        HeapView.In(v, Int32Array, true, 1),
+        v_button,
+      );
+      HeapView.Flush();
+      return ret;
+    }
     return Mod.export.ImGui_RadioButtonIntPtr(label, v, v_button);
   },
   ProgressBar(
     fraction: number,
     size_arg: ImVec2 = new ImVec2(-Number.MIN_VALUE, 0),
-    overlay: string = "",
+    overlay: string | ImStrHandle = "",
   ): void {
+    if (typeof overlay === "number") {
+      Mod.export.ImGui_ProgressBar_Interned(fraction, size_arg, overlay);
+      return;
+    }
     Mod.export.ImGui_ProgressBar(fraction, size_arg, overlay);
   },
   /**
@@ -7620,14 +8801,23 @@ export const ImGui = {
   /**
    * hyperlink text button, return true when clicked
    */
-  TextLink(label: string): boolean {
+  TextLink(label: string | ImStrHandle): boolean {
+    if (typeof label === "number") {
+      return Mod.export.ImGui_TextLink_Interned(label);
+    }
     return Mod.export.ImGui_TextLink(label);
   },
   /**
    * hyperlink text button, automatically open file/url when clicked
    */
-  TextLinkOpenURL(label: string, url: string = ""): boolean {
-    return Mod.export.ImGui_TextLinkOpenURL(label, url);
+  TextLinkOpenURL(label: string | ImStrHandle, url: string | ImStrHandle = ""): boolean {
+    if (typeof label === "number" && (typeof url === "number" || url === "")) {
+      return Mod.export.ImGui_TextLinkOpenURL_Interned(
+        label,
+        typeof url === "number" ? url : ImGuiImplWeb.Intern(url),
+      );
+    }
+    return Mod.export.ImGui_TextLinkOpenURL(getString(label), getString(url));
   },
   /**
    * Widgets: Images
@@ -7656,7 +8846,7 @@ export const ImGui = {
     Mod.export.ImGui_ImageWithBg(tex_ref, image_size, uv0, uv1, bg_col, tint_col);
   },
   ImageButton(
-    str_id: string,
+    str_id: string | ImStrHandle,
     tex_ref: ImTextureRef,
     image_size: ImVec2,
     uv0: ImVec2 = new ImVec2(0, 0),
@@ -7664,6 +8854,17 @@ export const ImGui = {
     bg_col: ImVec4 = new ImVec4(0, 0, 0, 0),
     tint_col: ImVec4 = new ImVec4(1, 1, 1, 1),
   ): boolean {
+    if (typeof str_id === "number") {
+      return Mod.export.ImGui_ImageButton_Interned(
+        str_id,
+        tex_ref,
+        image_size,
+        uv0,
+        uv1,
+        bg_col,
+        tint_col,
+      );
+    }
     return Mod.export.ImGui_ImageButton(str_id, tex_ref, image_size, uv0, uv1, bg_col, tint_col);
   },
   /**
@@ -7671,8 +8872,15 @@ export const ImGui = {
    * - The BeginCombo()/EndCombo() api allows you to manage your contents and selection state however you want it, by creating e.g. Selectable() items.
    * - The old Combo() api are helpers over BeginCombo()/EndCombo() which are kept available for convenience purpose. This is analogous to how ListBox are created.
    */
-  BeginCombo(label: string, preview_value: string, flags: ImGuiComboFlags = 0): boolean {
-    return Mod.export.ImGui_BeginCombo(label, preview_value, flags);
+  BeginCombo(
+    label: string | ImStrHandle,
+    preview_value: string | ImStrHandle,
+    flags: ImGuiComboFlags = 0,
+  ): boolean {
+    if (typeof label === "number" && typeof preview_value === "number") {
+      return Mod.export.ImGui_BeginCombo_Interned(label, preview_value, flags);
+    }
+    return Mod.export.ImGui_BeginCombo(getString(label), getString(preview_value), flags);
   },
   /**
    * only call EndCombo() if BeginCombo() returns true!
@@ -7684,15 +8892,35 @@ export const ImGui = {
    * Separate items with \0 within a string, end item-list with \0\0. e.g. "One\0Two\0Three\0"
    */
   Combo(
-    label: string,
-    current_item: [number],
-    items_separated_by_zeros: string,
+    label: string | ImStrHandle,
+    current_item: [number] | Int32Array,
+    items_separated_by_zeros: string | ImStrHandle,
     popup_max_height_in_items: number = -1,
   ): boolean {
+    if (typeof label === "number" && typeof items_separated_by_zeros === "number") {
+      const ret = Mod.export.ImGui_Combo_Interned(
+        label,
+        HeapView.In(current_item, Int32Array, true, 1),
+        items_separated_by_zeros,
+        popup_max_height_in_items,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(current_item)) {
+      const ret = Mod.export.ImGui_Combo_View(
+        getString(label),
+        HeapView.In(current_item, Int32Array, true, 1),
+        getString(items_separated_by_zeros),
+        popup_max_height_in_items,
+      );
+      HeapView.Flush();
+      return ret;
+    }
     return Mod.export.ImGui_Combo(
-      label,
+      getString(label),
       current_item,
-      items_separated_by_zeros,
+      getString(items_separated_by_zeros),
       popup_max_height_in_items,
     );
   },
@@ -7714,69 +8942,239 @@ export const ImGui = {
    * If v_min >= v_max we have no bound
    */
   DragFloat(
-    label: string,
-    v: [number],
+    label: string | ImStrHandle,
+    v: [number] | Float32Array,
     v_speed: number = 1.0,
     v_min: number = 0.0,
     v_max: number = 0.0,
-    format: string = "%.3f",
+    format: string | ImStrHandle = "%.3f",
     flags: ImGuiSliderFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_DragFloat(label, v, v_speed, v_min, v_max, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%.3f")) {
+      const ret = Mod.export.ImGui_DragFloat_Interned(
+        label,
+        HeapView.In(v, Float32Array, true, 1),
+        v_speed,
+        v_min,
+        v_max,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_DragFloat_View(
+        getString(label),
+        HeapView.In(v, Float32Array, true, 1),
+        v_speed,
+        v_min,
+        v_max,
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_DragFloat(
+      getString(label),
+      v,
+      v_speed,
+      v_min,
+      v_max,
+      getString(format),
+      flags,
+    );
   },
   DragFloat2(
-    label: string,
-    v: [number, number],
+    label: string | ImStrHandle,
+    v: [number, number] | Float32Array,
     v_speed: number = 1.0,
     v_min: number = 0.0,
     v_max: number = 0.0,
-    format: string = "%.3f",
+    format: string | ImStrHandle = "%.3f",
     flags: ImGuiSliderFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_DragFloat2(label, v, v_speed, v_min, v_max, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%.3f")) {
+      const ret = Mod.export.ImGui_DragFloat2_Interned(
+        label,
+        HeapView.In(v, Float32Array, true, 2),
+        v_speed,
+        v_min,
+        v_max,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_DragFloat2_View(
+        getString(label),
+        HeapView.In(v, Float32Array, true, 2),
+        v_speed,
+        v_min,
+        v_max,
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_DragFloat2(
+      getString(label),
+      v,
+      v_speed,
+      v_min,
+      v_max,
+      getString(format),
+      flags,
+    );
   },
   DragFloat3(
-    label: string,
-    v: [number, number, number],
+    label: string | ImStrHandle,
+    v: [number, number, number] | Float32Array,
     v_speed: number = 1.0,
     v_min: number = 0.0,
     v_max: number = 0.0,
-    format: string = "%.3f",
+    format: string | ImStrHandle = "%.3f",
     flags: ImGuiSliderFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_DragFloat3(label, v, v_speed, v_min, v_max, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%.3f")) {
+      const ret = Mod.export.ImGui_DragFloat3_Interned(
+        label,
+        HeapView.In(v, Float32Array, true, 3),
+        v_speed,
+        v_min,
+        v_max,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_DragFloat3_View(
+        getString(label),
+        HeapView.In(v, Float32Array, true, 3),
+        v_speed,
+        v_min,
+        v_max,
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_DragFloat3(
+      getString(label),
+      v,
+      v_speed,
+      v_min,
+      v_max,
+      getString(format),
+      flags,
+    );
   },
   DragFloat4(
-    label: string,
-    v: [number, number, number, number],
+    label: string | ImStrHandle,
+    v: [number, number, number, number] | Float32Array,
     v_speed: number = 1.0,
     v_min: number = 0.0,
     v_max: number = 0.0,
-    format: string = "%.3f",
+    format: string | ImStrHandle = "%.3f",
     flags: ImGuiSliderFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_DragFloat4(label, v, v_speed, v_min, v_max, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%.3f")) {
+      const ret = Mod.export.ImGui_DragFloat4_Interned(
+        label,
+        HeapView.In(v, Float32Array, true, 4),
+        v_speed,
+        v_min,
+        v_max,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_DragFloat4_View(
+        getString(label),
+        HeapView.In(v, Float32Array, true, 4),
+        v_speed,
+        v_min,
+        v_max,
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_DragFloat4(
+      getString(label),
+      v,
+      v_speed,
+      v_min,
+      v_max,
+      getString(format),
+      flags,
+    );
   },
   DragFloatRange2(
-    label: string,
-    v_current_min: [number],
-    v_current_max: [number],
+    label: string | ImStrHandle,
+    v_current_min: [number] | Float32Array,
+    v_current_max: [number] | Float32Array,
     v_speed: number = 1.0,
     v_min: number = 0.0,
     v_max: number = 0.0,
-    format: string = "%.3f",
-    format_max: string = "",
+    format: string | ImStrHandle = "%.3f",
+    format_max: string | ImStrHandle = "",
     flags: ImGuiSliderFlags = 0,
   ): boolean {
+    if (
+      typeof label === "number" &&
+      (typeof format === "number" || format === "%.3f") &&
+      (typeof format_max === "number" || format_max === "")
+    ) {
+      const ret = Mod.export.ImGui_DragFloatRange2_Interned(
+        label,
+        HeapView.In(v_current_min, Float32Array, true, 1),
+        HeapView.In(v_current_max, Float32Array, true, 1),
+        v_speed,
+        v_min,
+        v_max,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        typeof format_max === "number" ? format_max : ImGuiImplWeb.Intern(format_max),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v_current_min) || ArrayBuffer.isView(v_current_max)) {
+      const ret = Mod.export.ImGui_DragFloatRange2_View(
+        getString(label),
+        HeapView.In(v_current_min, Float32Array, true, 1),
+        HeapView.In(v_current_max, Float32Array, true, 1),
+        v_speed,
+        v_min,
+        v_max,
+        getString(format),
+        getString(format_max),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
     return Mod.export.ImGui_DragFloatRange2(
-      label,
+      getString(label),
       v_current_min,
       v_current_max,
       v_speed,
       v_min,
       v_max,
-      format,
-      format_max,
+      getString(format),
+      getString(format_max),
       flags,
     );
   },
@@ -7784,69 +9182,239 @@ export const ImGui = {
    * If v_min >= v_max we have no bound
    */
   DragInt(
-    label: string,
-    v: [number],
+    label: string | ImStrHandle,
+    v: [number] | Int32Array,
     v_speed: number = 1.0,
     v_min: number = 0,
     v_max: number = 0,
-    format: string = "%d",
+    format: string | ImStrHandle = "%d",
     flags: ImGuiSliderFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_DragInt(label, v, v_speed, v_min, v_max, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%d")) {
+      const ret = Mod.export.ImGui_DragInt_Interned(
+        label,
+        HeapView.In(v, Int32Array, true, 1),
+        v_speed,
+        v_min,
+        v_max,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_DragInt_View(
+        getString(label),
+        HeapView.In(v, Int32Array, true, 1),
+        v_speed,
+        v_min,
+        v_max,
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_DragInt(
+      getString(label),
+      v,
+      v_speed,
+      v_min,
+      v_max,
+      getString(format),
+      flags,
+    );
   },
   DragInt2(
-    label: string,
-    v: [number, number],
+    label: string | ImStrHandle,
+    v: [number, number] | Int32Array,
     v_speed: number = 1.0,
     v_min: number = 0,
     v_max: number = 0,
-    format: string = "%d",
+    format: string | ImStrHandle = "%d",
     flags: ImGuiSliderFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_DragInt2(label, v, v_speed, v_min, v_max, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%d")) {
+      const ret = Mod.export.ImGui_DragInt2_Interned(
+        label,
+        HeapView.In(v, Int32Array, true, 2),
+        v_speed,
+        v_min,
+        v_max,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_DragInt2_View(
+        getString(label),
+        HeapView.In(v, Int32Array, true, 2),
+        v_speed,
+        v_min,
+        v_max,
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_DragInt2(
+      getString(label),
+      v,
+      v_speed,
+      v_min,
+      v_max,
+      getString(format),
+      flags,
+    );
   },
   DragInt3(
-    label: string,
-    v: [number, number, number],
+    label: string | ImStrHandle,
+    v: [number, number, number] | Int32Array,
     v_speed: number = 1.0,
     v_min: number = 0,
     v_max: number = 0,
-    format: string = "%d",
+    format: string | ImStrHandle = "%d",
     flags: ImGuiSliderFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_DragInt3(label, v, v_speed, v_min, v_max, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%d")) {
+      const ret = Mod.export.ImGui_DragInt3_Interned(
+        label,
+        HeapView.In(v, Int32Array, true, 3),
+        v_speed,
+        v_min,
+        v_max,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_DragInt3_View(
+        getString(label),
+        HeapView.In(v, Int32Array, true, 3),
+        v_speed,
+        v_min,
+        v_max,
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_DragInt3(
+      getString(label),
+      v,
+      v_speed,
+      v_min,
+      v_max,
+      getString(format),
+      flags,
+    );
   },
   DragInt4(
-    label: string,
-    v: [number, number, number, number],
+    label: string | ImStrHandle,
+    v: [number, number, number, number] | Int32Array,
     v_speed: number = 1.0,
     v_min: number = 0,
     v_max: number = 0,
-    format: string = "%d",
+    format: string | ImStrHandle = "%d",
     flags: ImGuiSliderFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_DragInt4(label, v, v_speed, v_min, v_max, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%d")) {
+      const ret = Mod.export.ImGui_DragInt4_Interned(
+        label,
+        HeapView.In(v, Int32Array, true, 4),
+        v_speed,
+        v_min,
+        v_max,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_DragInt4_View(
+        getString(label),
+        HeapView.In(v, Int32Array, true, 4),
+        v_speed,
+        v_min,
+        v_max,
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_DragInt4(
+      getString(label),
+      v,
+      v_speed,
+      v_min,
+      v_max,
+      getString(format),
+      flags,
+    );
   },
   DragIntRange2(
-    label: string,
-    v_current_min: [number],
-    v_current_max: [number],
+    label: string | ImStrHandle,
+    v_current_min: [number] | Int32Array,
+    v_current_max: [number] | Int32Array,
     v_speed: number = 1.0,
     v_min: number = 0,
     v_max: number = 0,
-    format: string = "%d",
-    format_max: string = "",
+    format: string | ImStrHandle = "%d",
+    format_max: string | ImStrHandle = "",
     flags: ImGuiSliderFlags = 0,
   ): boolean {
+    if (
+      typeof label === "number" &&
+      (typeof format === "number" || format === "%d") &&
+      (typeof format_max === "number" || format_max === "")
+    ) {
+      const ret = Mod.export.ImGui_DragIntRange2_Interned(
+        label,
+        HeapView.In(v_current_min, Int32Array, true, 1),
+        HeapView.In(v_current_max, Int32Array, true, 1),
+        v_speed,
+        v_min,
+        v_max,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        typeof format_max === "number" ? format_max : ImGuiImplWeb.Intern(format_max),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v_current_min) || ArrayBuffer.isView(v_current_max)) {
+      const ret = Mod.export.ImGui_DragIntRange2_View(
+        getString(label),
+        HeapView.In(v_current_min, Int32Array, true, 1),
+        HeapView.In(v_current_max, Int32Array, true, 1),
+        v_speed,
+        v_min,
+        v_max,
+        getString(format),
+        getString(format_max),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
     return Mod.export.ImGui_DragIntRange2(
-      label,
+      getString(label),
       v_current_min,
       v_current_max,
       v_speed,
       v_min,
       v_max,
-      format,
-      format_max,
+      getString(format),
+      getString(format_max),
       flags,
     );
   },
@@ -7862,186 +9430,667 @@ export const ImGui = {
    * adjust format to decorate the value with a prefix or a suffix for in-slider labels or unit display.
    */
   SliderFloat(
-    label: string,
-    v: [number],
+    label: string | ImStrHandle,
+    v: [number] | Float32Array,
     v_min: number,
     v_max: number,
-    format: string = "%.3f",
+    format: string | ImStrHandle = "%.3f",
     flags: ImGuiSliderFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_SliderFloat(label, v, v_min, v_max, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%.3f")) {
+      const ret = Mod.export.ImGui_SliderFloat_Interned(
+        label,
+        HeapView.In(v, Float32Array, true, 1),
+        v_min,
+        v_max,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_SliderFloat_View(
+        getString(label),
+        HeapView.In(v, Float32Array, true, 1),
+        v_min,
+        v_max,
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_SliderFloat(
+      getString(label),
+      v,
+      v_min,
+      v_max,
+      getString(format),
+      flags,
+    );
   },
   SliderFloat2(
-    label: string,
-    v: [number, number],
+    label: string | ImStrHandle,
+    v: [number, number] | Float32Array,
     v_min: number,
     v_max: number,
-    format: string = "%.3f",
+    format: string | ImStrHandle = "%.3f",
     flags: ImGuiSliderFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_SliderFloat2(label, v, v_min, v_max, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%.3f")) {
+      const ret = Mod.export.ImGui_SliderFloat2_Interned(
+        label,
+        HeapView.In(v, Float32Array, true, 2),
+        v_min,
+        v_max,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_SliderFloat2_View(
+        getString(label),
+        HeapView.In(v, Float32Array, true, 2),
+        v_min,
+        v_max,
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_SliderFloat2(
+      getString(label),
+      v,
+      v_min,
+      v_max,
+      getString(format),
+      flags,
+    );
   },
   SliderFloat3(
-    label: string,
-    v: [number, number, number],
+    label: string | ImStrHandle,
+    v: [number, number, number] | Float32Array,
     v_min: number,
     v_max: number,
-    format: string = "%.3f",
+    format: string | ImStrHandle = "%.3f",
     flags: ImGuiSliderFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_SliderFloat3(label, v, v_min, v_max, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%.3f")) {
+      const ret = Mod.export.ImGui_SliderFloat3_Interned(
+        label,
+        HeapView.In(v, Float32Array, true, 3),
+        v_min,
+        v_max,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_SliderFloat3_View(
+        getString(label),
+        HeapView.In(v, Float32Array, true, 3),
+        v_min,
+        v_max,
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_SliderFloat3(
+      getString(label),
+      v,
+      v_min,
+      v_max,
+      getString(format),
+      flags,
+    );
   },
   SliderFloat4(
-    label: string,
-    v: [number, number, number, number],
+    label: string | ImStrHandle,
+    v: [number, number, number, number] | Float32Array,
     v_min: number,
     v_max: number,
-    format: string = "%.3f",
+    format: string | ImStrHandle = "%.3f",
     flags: ImGuiSliderFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_SliderFloat4(label, v, v_min, v_max, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%.3f")) {
+      const ret = Mod.export.ImGui_SliderFloat4_Interned(
+        label,
+        HeapView.In(v, Float32Array, true, 4),
+        v_min,
+        v_max,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_SliderFloat4_View(
+        getString(label),
+        HeapView.In(v, Float32Array, true, 4),
+        v_min,
+        v_max,
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_SliderFloat4(
+      getString(label),
+      v,
+      v_min,
+      v_max,
+      getString(format),
+      flags,
+    );
   },
   SliderAngle(
-    label: string,
-    v_rad: [number],
+    label: string | ImStrHandle,
+    v_rad: [number] | Float32Array,
     v_degrees_min: number = -360.0,
     v_degrees_max: number = +360.0,
-    format: string = "%.0f deg",
+    format: string | ImStrHandle = "%.0f deg",
     flags: ImGuiSliderFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_SliderAngle(label, v_rad, v_degrees_min, v_degrees_max, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%.0f deg")) {
+      const ret = Mod.export.ImGui_SliderAngle_Interned(
+        label,
+        HeapView.In(v_rad, Float32Array, true, 1),
+        v_degrees_min,
+        v_degrees_max,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v_rad)) {
+      const ret = Mod.export.ImGui_SliderAngle_View(
+        getString(label),
+        HeapView.In(v_rad, Float32Array, true, 1),
+        v_degrees_min,
+        v_degrees_max,
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_SliderAngle(
+      getString(label),
+      v_rad,
+      v_degrees_min,
+      v_degrees_max,
+      getString(format),
+      flags,
+    );
   },
   SliderInt(
-    label: string,
-    v: [number],
+    label: string | ImStrHandle,
+    v: [number] | Int32Array,
     v_min: number,
     v_max: number,
-    format: string = "%d",
+    format: string | ImStrHandle = "%d",
     flags: ImGuiSliderFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_SliderInt(label, v, v_min, v_max, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%d")) {
+      const ret = Mod.export.ImGui_SliderInt_Interned(
+        label,
+        HeapView.In(v, Int32Array, true, 1),
+        v_min,
+        v_max,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_SliderInt_View(
+        getString(label),
+        HeapView.In(v, Int32Array, true, 1),
+        v_min,
+        v_max,
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_SliderInt(getString(label), v, v_min, v_max, getString(format), flags);
   },
   SliderInt2(
-    label: string,
-    v: [number, number],
+    label: string | ImStrHandle,
+    v: [number, number] | Int32Array,
     v_min: number,
     v_max: number,
-    format: string = "%d",
+    format: string | ImStrHandle = "%d",
     flags: ImGuiSliderFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_SliderInt2(label, v, v_min, v_max, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%d")) {
+      const ret = Mod.export.ImGui_SliderInt2_Interned(
+        label,
+        HeapView.In(v, Int32Array, true, 2),
+        v_min,
+        v_max,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_SliderInt2_View(
+        getString(label),
+        HeapView.In(v, Int32Array, true, 2),
+        v_min,
+        v_max,
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_SliderInt2(getString(label), v, v_min, v_max, getString(format), flags);
   },
   SliderInt3(
-    label: string,
-    v: [number, number, number],
+    label: string | ImStrHandle,
+    v: [number, number, number] | Int32Array,
     v_min: number,
     v_max: number,
-    format: string = "%d",
+    format: string | ImStrHandle = "%d",
     flags: ImGuiSliderFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_SliderInt3(label, v, v_min, v_max, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%d")) {
+      const ret = Mod.export.ImGui_SliderInt3_Interned(
+        label,
+        HeapView.In(v, Int32Array, true, 3),
+        v_min,
+        v_max,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_SliderInt3_View(
+        getString(label),
+        HeapView.In(v, Int32Array, true, 3),
+        v_min,
+        v_max,
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_SliderInt3(getString(label), v, v_min, v_max, getString(format), flags);
   },
   SliderInt4(
-    label: string,
-    v: [number, number, number, number],
+    label: string | ImStrHandle,
+    v: [number, number, number, number] | Int32Array,
     v_min: number,
     v_max: number,
-    format: string = "%d",
+    format: string | ImStrHandle = "%d",
     flags: ImGuiSliderFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_SliderInt4(label, v, v_min, v_max, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%d")) {
+      const ret = Mod.export.ImGui_SliderInt4_Interned(
+        label,
+        HeapView.In(v, Int32Array, true, 4),
+        v_min,
+        v_max,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_SliderInt4_View(
+        getString(label),
+        HeapView.In(v, Int32Array, true, 4),
+        v_min,
+        v_max,
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_SliderInt4(getString(label), v, v_min, v_max, getString(format), flags);
   },
+  /**
+   * Pass a {@linkcode TextBuffer} as `buf` to edit text kept in the WASM heap across frames.
+   * It grows as needed, so `buf_size` can be left out, and isn't copied from and back to JS every
+   * frame. `[string]` buffers hold `buf_size` bytes, 256 by default.
+   */
   InputText(
     label: string,
-    buf: [string],
-    buf_size: number,
+    buf: [string] | TextBuffer,
+    buf_size: number = 256,
     flags: ImGuiInputTextFlags = 0,
   ): boolean {
+    if (buf instanceof TextBuffer) {
+      return Mod.export.TextBuffer_InputText(buf.ptr, label, flags);
+    }
     return Mod.export.ImGui_InputText(label, buf, buf_size, flags);
   },
+  /**
+   * Pass a {@linkcode TextBuffer} as `buf` to edit text kept in the WASM heap across frames.
+   * It grows as needed, so `buf_size` can be left out, and isn't copied from and back to JS every
+   * frame. `[string]` buffers hold `buf_size` bytes, 256 by default.
+   */
   InputTextMultiline(
     label: string,
-    buf: [string],
-    buf_size: number,
+    buf: [string] | TextBuffer,
+    buf_size: number = 256,
     size: ImVec2 = new ImVec2(0, 0),
     flags: ImGuiInputTextFlags = 0,
   ): boolean {
+    if (buf instanceof TextBuffer) {
+      return Mod.export.TextBuffer_InputTextMultiline(buf.ptr, label, size, flags);
+    }
     return Mod.export.ImGui_InputTextMultiline(label, buf, buf_size, size, flags);
   },
+  /**
+   * Pass a {@linkcode TextBuffer} as `buf` to edit text kept in the WASM heap across frames.
+   * It grows as needed, so `buf_size` can be left out, and isn't copied from and back to JS every
+   * frame. `[string]` buffers hold `buf_size` bytes, 256 by default.
+   */
   InputTextWithHint(
     label: string,
     hint: string,
-    buf: [string],
-    buf_size: number,
+    buf: [string] | TextBuffer,
+    buf_size: number = 256,
     flags: ImGuiInputTextFlags = 0,
   ): boolean {
+    if (buf instanceof TextBuffer) {
+      return Mod.export.TextBuffer_InputTextWithHint(buf.ptr, label, hint, flags);
+    }
     return Mod.export.ImGui_InputTextWithHint(label, hint, buf, buf_size, flags);
   },
   InputFloat(
-    label: string,
-    v: [number],
+    label: string | ImStrHandle,
+    v: [number] | Float32Array,
     step: number = 0.0,
     step_fast: number = 0.0,
-    format: string = "%.3f",
+    format: string | ImStrHandle = "%.3f",
     flags: ImGuiInputTextFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_InputFloat(label, v, step, step_fast, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%.3f")) {
+      const ret = Mod.export.ImGui_InputFloat_Interned(
+        label,
+        HeapView.In(v, Float32Array, true, 1),
+        step,
+        step_fast,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_InputFloat_View(
+        getString(label),
+        HeapView.In(v, Float32Array, true, 1),
+        step,
+        step_fast,
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_InputFloat(
+      getString(label),
+      v,
+      step,
+      step_fast,
+      getString(format),
+      flags,
+    );
   },
   InputFloat2(
-    label: string,
-    v: [number, number],
-    format: string = "%.3f",
+    label: string | ImStrHandle,
+    v: [number, number] | Float32Array,
+    format: string | ImStrHandle = "%.3f",
     flags: ImGuiInputTextFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_InputFloat2(label, v, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%.3f")) {
+      const ret = Mod.export.ImGui_InputFloat2_Interned(
+        label,
+        HeapView.In(v, Float32Array, true, 2),
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_InputFloat2_View(
+        getString(label),
+        HeapView.In(v, Float32Array, true, 2),
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_InputFloat2(getString(label), v, getString(format), flags);
   },
   InputFloat3(
-    label: string,
-    v: [number, number, number],
-    format: string = "%.3f",
+    label: string | ImStrHandle,
+    v: [number, number, number] | Float32Array,
+    format: string | ImStrHandle = "%.3f",
     flags: ImGuiInputTextFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_InputFloat3(label, v, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%.3f")) {
+      const ret = Mod.export.ImGui_InputFloat3_Interned(
+        label,
+        HeapView.In(v, Float32Array, true, 3),
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_InputFloat3_View(
+        getString(label),
+        HeapView.In(v, Float32Array, true, 3),
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_InputFloat3(getString(label), v, getString(format), flags);
   },
   InputFloat4(
-    label: string,
-    v: [number, number, number, number],
-    format: string = "%.3f",
+    label: string | ImStrHandle,
+    v: [number, number, number, number] | Float32Array,
+    format: string | ImStrHandle = "%.3f",
     flags: ImGuiInputTextFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_InputFloat4(label, v, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%.3f")) {
+      const ret = Mod.export.ImGui_InputFloat4_Interned(
+        label,
+        HeapView.In(v, Float32Array, true, 4),
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_InputFloat4_View(
+        getString(label),
+        HeapView.In(v, Float32Array, true, 4),
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_InputFloat4(getString(label), v, getString(format), flags);
   },
   InputInt(
-    label: string,
-    v: [number],
+    label: string | ImStrHandle,
+    v: [number] | Int32Array,
     step: number = 1,
     step_fast: number = 100,
     flags: ImGuiInputTextFlags = 0,
   ): boolean {
+    if (typeof label === "number") {
+      const ret = Mod.export.ImGui_InputInt_Interned(
+        label,
+        HeapView.In(v, Int32Array, true, 1),
+        step,
+        step_fast,
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_InputInt_View(
+        label,
+        HeapView.In(v, Int32Array, true, 1),
+        step,
+        step_fast,
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
     return Mod.export.ImGui_InputInt(label, v, step, step_fast, flags);
   },
-  InputInt2(label: string, v: [number, number], flags: ImGuiInputTextFlags = 0): boolean {
+  InputInt2(
+    label: string | ImStrHandle,
+    v: [number, number] | Int32Array,
+    flags: ImGuiInputTextFlags = 0,
+  ): boolean {
+    if (typeof label === "number") {
+      const ret = Mod.export.ImGui_InputInt2_Interned(
+        label,
+        HeapView.In(v, Int32Array, true, 2),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_InputInt2_View(
+        label,
+        HeapView.In(v, Int32Array, true, 2),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
     return Mod.export.ImGui_InputInt2(label, v, flags);
   },
-  InputInt3(label: string, v: [number, number, number], flags: ImGuiInputTextFlags = 0): boolean {
+  InputInt3(
+    label: string | ImStrHandle,
+    v: [number, number, number] | Int32Array,
+    flags: ImGuiInputTextFlags = 0,
+  ): boolean {
+    if (typeof label === "number") {
+      const ret = Mod.export.ImGui_InputInt3_Interned(
+        label,
+        HeapView.In(v, Int32Array, true, 3),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_InputInt3_View(
+        label,
+        HeapView.In(v, Int32Array, true, 3),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
     return Mod.export.ImGui_InputInt3(label, v, flags);
   },
   InputInt4(
-    label: string,
-    v: [number, number, number, number],
+    label: string | ImStrHandle,
+    v: [number, number, number, number] | Int32Array,
     flags: ImGuiInputTextFlags = 0,
   ): boolean {
+    if (typeof label === "number") {
+      const ret = Mod.export.ImGui_InputInt4_Interned(
+        label,
+        HeapView.In(v, Int32Array, true, 4),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_InputInt4_View(
+        label,
+        HeapView.In(v, Int32Array, true, 4),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
     return Mod.export.ImGui_InputInt4(label, v, flags);
   },
   InputDouble(
-    label: string,
-    v: [number],
+    label: string | ImStrHandle,
+    v: [number] | Float64Array,
     step: number = 0.0,
     step_fast: number = 0.0,
-    format: string = "%.6f",
+    format: string | ImStrHandle = "%.6f",
     flags: ImGuiInputTextFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_InputDouble(label, v, step, step_fast, format, flags);
+    if (typeof label === "number" && (typeof format === "number" || format === "%.6f")) {
+      const ret = Mod.export.ImGui_InputDouble_Interned(
+        label,
+        HeapView.In(v, Float64Array, true, 1),
+        step,
+        step_fast,
+        typeof format === "number" ? format : ImGuiImplWeb.Intern(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(v)) {
+      const ret = Mod.export.ImGui_InputDouble_View(
+        getString(label),
+        HeapView.In(v, Float64Array, true, 1),
+        step,
+        step_fast,
+        getString(format),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_InputDouble(
+      getString(label),
+      v,
+      step,
+      step_fast,
+      getString(format),
+      flags,
+    );
   },
   /**
    * Widgets: Color Editor/Picker (tip: the ColorEdit* functions have a little color square that can be left-clicked to open a picker, and right-clicked to open an option menu.)
@@ -8049,43 +10098,120 @@ export const ImGui = {
    * - You can pass the address of a first float element out of a contiguous structure, e.g. &myvector.x
    */
   ColorEdit3(
-    label: string,
-    col: [number, number, number],
+    label: string | ImStrHandle,
+    col: [number, number, number] | Float32Array,
     flags: ImGuiColorEditFlags = 0,
   ): boolean {
+    if (typeof label === "number") {
+      const ret = Mod.export.ImGui_ColorEdit3_Interned(
+        label,
+        HeapView.In(col, Float32Array, true, 3),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(col)) {
+      const ret = Mod.export.ImGui_ColorEdit3_View(
+        label,
+        HeapView.In(col, Float32Array, true, 3),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
     return Mod.export.ImGui_ColorEdit3(label, col, flags);
   },
   ColorEdit4(
-    label: string,
-    col: [number, number, number, number],
+    label: string | ImStrHandle,
+    col: [number, number, number, number] | Float32Array,
     flags: ImGuiColorEditFlags = 0,
   ): boolean {
-    return Mod.export.ImGui_ColorEdit4(label, col, flags);
-  },
-  ColorPicker3(
-    label: string,
-    col: [number, number, number],
+    if (typeof label === "number") {
+      const ret = Mod.export.ImGui_ColorEdit4_Interned(
+        label,
+        HeapView.In(col, Float32Array, true, 4),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(col)) {
+      const ret = Mod.export.ImGui_ColorEdit4_View(
+        label,
+        HeapView.In(col, Float32Array, true, 4),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    return Mod.export.ImGui_ColorEdit4(label, col, flags);
+  },
+  ColorPicker3(
+    label: string | ImStrHandle,
+    col: [number, number, number] | Float32Array,
     flags: ImGuiColorEditFlags = 0,
   ): boolean {
+    if (typeof label === "number") {
+      const ret = Mod.export.ImGui_ColorPicker3_Interned(
+        label,
+        HeapView.In(col, Float32Array, true, 3),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(col)) {
+      const ret = Mod.export.ImGui_ColorPicker3_View(
+        label,
+        HeapView.In(col, Float32Array, true, 3),
+        flags,
+      );
+      HeapView.Flush();
+      return ret;
+    }
     return Mod.export.ImGui_ColorPicker3(label, col, flags);
   },
   ColorPicker4(
-    label: string,
-    col: [number, number, number, number],
+    label: string | ImStrHandle,
+    col: [number, number, number, number] | Float32Array,
     flags: ImGuiColorEditFlags = 0,
-    ref_col: number[] | null = null,
+    ref_col: number[] | Float32Array | null = null,
   ): boolean {
+    if (typeof label === "number") {
+      const ret = Mod.export.ImGui_ColorPicker4_Interned(
+        label,
+        HeapView.In(col, Float32Array, true, 4),
+        flags,
+        HeapView.In(ref_col, Float32Array, false, 0),
+      );
+      HeapView.Flush();
+      return ret;
+    }
+    if (ArrayBuffer.isView(col) || ArrayBuffer.isView(ref_col)) {
+      const ret = Mod.export.ImGui_ColorPicker4_View(
+        label,
+        HeapView.In(col, Float32Array, true, 4),
+        flags,
+        HeapView.In(ref_col, Float32Array, false, 0),
+      );
+      HeapView.Flush();
+      return ret;
+    }
     return Mod.export.ImGui_ColorPicker4(label, col, flags, ref_col);
   },
   /**
    * display a color square/button, hover for details, return true when pressed.
    */
   ColorButton(
-    desc_id: string,
+    desc_id: string | ImStrHandle,
     col: ImVec4,
     flags: ImGuiColorEditFlags = 0,
     size: ImVec2 = new ImVec2(0, 0),
   ): boolean {
+    if (typeof desc_id === "number") {
+      return Mod.export.ImGui_ColorButton_Interned(desc_id, col, flags, size);
+    }
     return Mod.export.ImGui_ColorButton(desc_id, col, flags, size);
   },
   /**
@@ -8098,16 +10224,26 @@ export const ImGui = {
    * Widgets: Trees
    * - TreeNode functions return true when the node is open, in which case you need to also call TreePop() when you are finished displaying the tree node contents.
    */
-  TreeNode(label: string): boolean {
+  TreeNode(label: string | ImStrHandle): boolean {
+    if (typeof label === "number") {
+      return Mod.export.ImGui_TreeNode_Interned(label);
+    }
     return Mod.export.ImGui_TreeNode(label);
   },
-  TreeNodeEx(label: string, flags: ImGuiTreeNodeFlags = 0): boolean {
+  TreeNodeEx(label: string | ImStrHandle, flags: ImGuiTreeNodeFlags = 0): boolean {
+    if (typeof label === "number") {
+      return Mod.export.ImGui_TreeNodeEx_Interned(label, flags);
+    }
     return Mod.export.ImGui_TreeNodeEx(label, flags);
   },
   /**
    * ~ Indent()+PushID(). Already called by TreeNode() when returning true, but you can call TreePush/TreePop yourself if desired.
    */
-  TreePush(str_id: string): void {
+  TreePush(str_id: string | ImStrHandle): void {
+    if (typeof str_id === "number") {
+      Mod.export.ImGui_TreePush_Interned(str_id);
+      return;
+    }
     Mod.export.ImGui_TreePush(str_id);
   },
   /**
@@ -8125,17 +10261,23 @@ export const ImGui = {
   /**
    * if returning 'true' the header is open. doesn't indent nor push on ID stack. user doesn't have to call TreePop().
    */
-  CollapsingHeader(label: string, flags: ImGuiTreeNodeFlags = 0): boolean {
+  CollapsingHeader(label: string | ImStrHandle, flags: ImGuiTreeNodeFlags = 0): boolean {
+    if (typeof label === "number") {
+      return Mod.export.ImGui_CollapsingHeader_Interned(label, flags);
+    }
     return Mod.export.ImGui_CollapsingHeader(label, flags);
   },
   /**
    * when 'p_visible != NULL': if '*p_visible==true' display an additional small close button on upper right of the header which will set the bool to false when clicked, if '*p_visible==false' don't display the header.
    */
   CollapsingHeaderBoolPtr(
-    label: string,
+    label: string | ImStrHandle,
     p_visible: [boolean],
     flags: ImGuiTreeNodeFlags = 0,
   ): boolean {
+    if (typeof label === "number") {
+      return Mod.export.ImGui_CollapsingHeaderBoolPtr_Interned(label, p_visible, flags);
+    }
     return Mod.export.ImGui_CollapsingHeaderBoolPtr(label, p_visible, flags);
   },
   /**
@@ -8165,22 +10307,28 @@ export const ImGui = {
    * "bool selected" carry the selection state (read-only). Selectable() is clicked is returns true so you can modify your selection state. size.x==0.0: use remaining width, size.x>0.0: specify width. size.y==0.0: use label height, size.y>0.0: specify height
    */
   Selectable(
-    label: string,
+    label: string | ImStrHandle,
     selected: boolean = false,
     flags: ImGuiSelectableFlags = 0,
     size: ImVec2 = new ImVec2(0, 0),
   ): boolean {
+    if (typeof label === "number") {
+      return Mod.export.ImGui_Selectable_Interned(label, selected, flags, size);
+    }
     return Mod.export.ImGui_Selectable(label, selected, flags, size);
   },
   /**
    * "bool* p_selected" point to the selection state (read-write), as a convenient helper.
    */
   SelectableBoolPtr(
-    label: string,
+    label: string | ImStrHandle,
     p_selected: [boolean],
     flags: ImGuiSelectableFlags = 0,
     size: ImVec2 = new ImVec2(0, 0),
   ): boolean {
+    if (typeof label === "number") {
+      return Mod.export.ImGui_SelectableBoolPtr_Interned(label, p_selected, flags, size);
+    }
     return Mod.export.ImGui_SelectableBoolPtr(label, p_selected, flags, size);
   },
   /**
@@ -8225,7 +10373,10 @@ export const ImGui = {
   /**
    * open a framed scrolling region
    */
-  BeginListBox(label: string, size: ImVec2 = new ImVec2(0, 0)): boolean {
+  BeginListBox(label: string | ImStrHandle, size: ImVec2 = new ImVec2(0, 0)): boolean {
+    if (typeof label === "number") {
+      return Mod.export.ImGui_BeginListBox_Interned(label, size);
+    }
     return Mod.export.ImGui_BeginListBox(label, size);
   },
   /**
@@ -8235,12 +10386,13 @@ export const ImGui = {
     Mod.export.ImGui_EndListBox();
   },
   /**
-   * Widgets: Data Plotting
-   * - Consider using ImPlot (https://github.com/epezent/implot) which is much better!
+   * Pass a {@linkcode PlotRingBuffer} as `values` to plot straight from the WASM heap. In that case
+   * `values_count` is the number of newest samples to plot and `values_offset` moves this window
+   * back into the history.
    */
   PlotLines(
     label: string,
-    values: number[],
+    values: number[] | Float32Array | PlotRingBuffer,
     values_count: number,
     values_offset: number = 0,
     overlay_text: string = "",
@@ -8249,6 +10401,34 @@ export const ImGui = {
     graph_size: ImVec2 = new ImVec2(0, 0),
     stride: number = 4,
   ): void {
+    if (values instanceof PlotRingBuffer) {
+      Mod.export.PlotRingBuffer_PlotLines(
+        values.ptr,
+        label,
+        values_count,
+        values_offset,
+        overlay_text,
+        scale_min,
+        scale_max,
+        graph_size,
+      );
+      return;
+    }
+    if (ArrayBuffer.isView(values)) {
+      Mod.export.ImGui_PlotLines_View(
+        label,
+        HeapView.In(values, Float32Array, false),
+        values_count,
+        values_offset,
+        overlay_text,
+        scale_min,
+        scale_max,
+        graph_size,
+        stride,
+      );
+      HeapView.Flush();
+      return;
+    }
     Mod.export.ImGui_PlotLines(
       label,
       values,
@@ -8261,9 +10441,14 @@ export const ImGui = {
       stride,
     );
   },
+  /**
+   * Pass a {@linkcode PlotRingBuffer} as `values` to plot straight from the WASM heap. In that case
+   * `values_count` is the number of newest samples to plot and `values_offset` moves this window
+   * back into the history.
+   */
   PlotHistogram(
     label: string,
-    values: number[],
+    values: number[] | Float32Array | PlotRingBuffer,
     values_count: number,
     values_offset: number = 0,
     overlay_text: string = "",
@@ -8272,6 +10457,34 @@ export const ImGui = {
     graph_size: ImVec2 = new ImVec2(0, 0),
     stride: number = 4,
   ): void {
+    if (values instanceof PlotRingBuffer) {
+      Mod.export.PlotRingBuffer_PlotHistogram(
+        values.ptr,
+        label,
+        values_count,
+        values_offset,
+        overlay_text,
+        scale_min,
+        scale_max,
+        graph_size,
+      );
+      return;
+    }
+    if (ArrayBuffer.isView(values)) {
+      Mod.export.ImGui_PlotHistogram_View(
+        label,
+        HeapView.In(values, Float32Array, false),
+        values_count,
+        values_offset,
+        overlay_text,
+        scale_min,
+        scale_max,
+        graph_size,
+        stride,
+      );
+      HeapView.Flush();
+      return;
+    }
     Mod.export.ImGui_PlotHistogram(
       label,
       values,
@@ -8318,7 +10531,10 @@ export const ImGui = {
   /**
    * create a sub-menu entry. only call EndMenu() if this returns true!
    */
-  BeginMenu(label: string, enabled: boolean = true): boolean {
+  BeginMenu(label: string | ImStrHandle, enabled: boolean = true): boolean {
+    if (typeof label === "number") {
+      return Mod.export.ImGui_BeginMenu_Interned(label, enabled);
+    }
     return Mod.export.ImGui_BeginMenu(label, enabled);
   },
   /**
@@ -8331,23 +10547,39 @@ export const ImGui = {
    * return true when activated.
    */
   MenuItem(
-    label: string,
-    shortcut: string = "",
+    label: string | ImStrHandle,
+    shortcut: string | ImStrHandle = "",
     selected: boolean = false,
     enabled: boolean = true,
   ): boolean {
-    return Mod.export.ImGui_MenuItem(label, shortcut, selected, enabled);
+    if (typeof label === "number" && (typeof shortcut === "number" || shortcut === "")) {
+      return Mod.export.ImGui_MenuItem_Interned(
+        label,
+        typeof shortcut === "number" ? shortcut : ImGuiImplWeb.Intern(shortcut),
+        selected,
+        enabled,
+      );
+    }
+    return Mod.export.ImGui_MenuItem(getString(label), getString(shortcut), selected, enabled);
   },
   /**
    * return true when activated + toggle (*p_selected) if p_selected != NULL
    */
   MenuItemBoolPtr(
-    label: string,
-    shortcut: string,
+    label: string | ImStrHandle,
+    shortcut: string | ImStrHandle,
     p_selected: [boolean],
     enabled: boolean = true,
   ): boolean {
-    return Mod.export.ImGui_MenuItemBoolPtr(label, shortcut, p_selected, enabled);
+    if (typeof label === "number" && typeof shortcut === "number") {
+      return Mod.export.ImGui_MenuItemBoolPtr_Interned(label, shortcut, p_selected, enabled);
+    }
+    return Mod.export.ImGui_MenuItemBoolPtr(
+      getString(label),
+      getString(shortcut),
+      p_selected,
+      enabled,
+    );
   },
 
   // Tooltips
@@ -8400,17 +10632,23 @@ export const ImGui = {
   /**
    * return true if the popup is open, and you can start outputting to it.
    */
-  BeginPopup(str_id: string, flags: ImGuiWindowFlags = 0): boolean {
+  BeginPopup(str_id: string | ImStrHandle, flags: ImGuiWindowFlags = 0): boolean {
+    if (typeof str_id === "number") {
+      return Mod.export.ImGui_BeginPopup_Interned(str_id, flags);
+    }
     return Mod.export.ImGui_BeginPopup(str_id, flags);
   },
   /**
    * return true if the modal is open, and you can start outputting to it.
    */
   BeginPopupModal(
-    name: string,
+    name: string | ImStrHandle,
     p_open: [boolean] | null = null,
     flags: ImGuiWindowFlags = 0,
   ): boolean {
+    if (typeof name === "number") {
+      return Mod.export.ImGui_BeginPopupModal_Interned(name, p_open, flags);
+    }
     return Mod.export.ImGui_BeginPopupModal(name, p_open, flags);
   },
   /**
@@ -8431,7 +10669,11 @@ export const ImGui = {
   /**
    * call to mark popup as open (don't call every frame!).
    */
-  OpenPopup(str_id: string, popup_flags: ImGuiPopupFlags = 0): void {
+  OpenPopup(str_id: string | ImStrHandle, popup_flags: ImGuiPopupFlags = 0): void {
+    if (typeof str_id === "number") {
+      Mod.export.ImGui_OpenPopup_Interned(str_id, popup_flags);
+      return;
+    }
     Mod.export.ImGui_OpenPopup(str_id, popup_flags);
   },
   /**
@@ -8443,7 +10685,11 @@ export const ImGui = {
   /**
    * helper to open popup when clicked on last item. Default to ImGuiPopupFlags_MouseButtonRight == 1. (note: actually triggers on the mouse _released_ event to be consistent with popup behaviors)
    */
-  OpenPopupOnItemClick(str_id: string = "", popup_flags: ImGuiPopupFlags = 0): void {
+  OpenPopupOnItemClick(str_id: string | ImStrHandle = "", popup_flags: ImGuiPopupFlags = 0): void {
+    if (typeof str_id === "number") {
+      Mod.export.ImGui_OpenPopupOnItemClick_Interned(str_id, popup_flags);
+      return;
+    }
     Mod.export.ImGui_OpenPopupOnItemClick(str_id, popup_flags);
   },
   /**
@@ -8466,19 +10712,37 @@ export const ImGui = {
   /**
    * open+begin popup when clicked on last item. Use str_id==NULL to associate the popup to previous item. If you want to use that on a non-interactive item such as Text() you need to pass in an explicit ID here. read comments in .cpp!
    */
-  BeginPopupContextItem(str_id: string = "", popup_flags: ImGuiPopupFlags = 0): boolean {
+  BeginPopupContextItem(
+    str_id: string | ImStrHandle = "",
+    popup_flags: ImGuiPopupFlags = 0,
+  ): boolean {
+    if (typeof str_id === "number") {
+      return Mod.export.ImGui_BeginPopupContextItem_Interned(str_id, popup_flags);
+    }
     return Mod.export.ImGui_BeginPopupContextItem(str_id, popup_flags);
   },
   /**
    * open+begin popup when clicked on current window.
    */
-  BeginPopupContextWindow(str_id: string = "", popup_flags: ImGuiPopupFlags = 0): boolean {
+  BeginPopupContextWindow(
+    str_id: string | ImStrHandle = "",
+    popup_flags: ImGuiPopupFlags = 0,
+  ): boolean {
+    if (typeof str_id === "number") {
+      return Mod.export.ImGui_BeginPopupContextWindow_Interned(str_id, popup_flags);
+    }
     return Mod.export.ImGui_BeginPopupContextWindow(str_id, popup_flags);
   },
   /**
    * open+begin popup when clicked in void (where there are no windows).
    */
-  BeginPopupContextVoid(str_id: string = "", popup_flags: ImGuiPopupFlags = 0): boolean {
+  BeginPopupContextVoid(
+    str_id: string | ImStrHandle = "",
+    popup_flags: ImGuiPopupFlags = 0,
+  ): boolean {
+    if (typeof str_id === "number") {
+      return Mod.export.ImGui_BeginPopupContextVoid_Interned(str_id, popup_flags);
+    }
     return Mod.export.ImGui_BeginPopupContextVoid(str_id, popup_flags);
   },
 
@@ -8490,7 +10754,10 @@ export const ImGui = {
   /**
    * return true if the popup is open.
    */
-  IsPopupOpen(str_id: string, flags: ImGuiPopupFlags = 0): boolean {
+  IsPopupOpen(str_id: string | ImStrHandle, flags: ImGuiPopupFlags = 0): boolean {
+    if (typeof str_id === "number") {
+      return Mod.export.ImGui_IsPopupOpen_Interned(str_id, flags);
+    }
     return Mod.export.ImGui_IsPopupOpen(str_id, flags);
   },
   /**
@@ -8517,12 +10784,15 @@ export const ImGui = {
    * - 5. Call EndTable()
    */
   BeginTable(
-    str_id: string,
+    str_id: string | ImStrHandle,
     columns: number,
     flags: ImGuiTableFlags = 0,
     outer_size: ImVec2 = new ImVec2(0.0, 0.0),
     inner_width: number = 0.0,
   ): boolean {
+    if (typeof str_id === "number") {
+      return Mod.export.ImGui_BeginTable_Interned(str_id, columns, flags, outer_size, inner_width);
+    }
     return Mod.export.ImGui_BeginTable(str_id, columns, flags, outer_size, inner_width);
   },
   /**
@@ -8560,11 +10830,15 @@ export const ImGui = {
    * - Use TableSetupScrollFreeze() to lock columns/rows so they stay visible when scrolled. When freezing columns you would usually also use ImGuiTableColumnFlags_NoHide on them.
    */
   TableSetupColumn(
-    label: string,
+    label: string | ImStrHandle,
     flags: ImGuiTableColumnFlags = 0,
     init_width_or_weight: number = 0.0,
     user_id: ImGuiID = 0,
   ): void {
+    if (typeof label === "number") {
+      Mod.export.ImGui_TableSetupColumn_Interned(label, flags, init_width_or_weight, user_id);
+      return;
+    }
     Mod.export.ImGui_TableSetupColumn(label, flags, init_width_or_weight, user_id);
   },
   /**
@@ -8576,7 +10850,11 @@ export const ImGui = {
   /**
    * submit one header cell manually (rarely used)
    */
-  TableHeader(label: string): void {
+  TableHeader(label: string | ImStrHandle): void {
+    if (typeof label === "number") {
+      Mod.export.ImGui_TableHeader_Interned(label);
+      return;
+    }
     Mod.export.ImGui_TableHeader(label);
   },
   /**
@@ -8657,7 +10935,11 @@ export const ImGui = {
    * Legacy Columns API (prefer using Tables!)
    * - You can also use SameLine(pos_x) to mimic simplified columns.
    */
-  Columns(count: number = 1, id: string = "", borders: boolean = true): void {
+  Columns(count: number = 1, id: string | ImStrHandle = "", borders: boolean = true): void {
+    if (typeof id === "number") {
+      Mod.export.ImGui_Columns_Interned(count, id, borders);
+      return;
+    }
     Mod.export.ImGui_Columns(count, id, borders);
   },
   /**
@@ -8706,7 +10988,10 @@ export const ImGui = {
   /**
    * create and append into a TabBar
    */
-  BeginTabBar(str_id: string, flags: ImGuiTabBarFlags = 0): boolean {
+  BeginTabBar(str_id: string | ImStrHandle, flags: ImGuiTabBarFlags = 0): boolean {
+    if (typeof str_id === "number") {
+      return Mod.export.ImGui_BeginTabBar_Interned(str_id, flags);
+    }
     return Mod.export.ImGui_BeginTabBar(str_id, flags);
   },
   /**
@@ -8719,10 +11004,13 @@ export const ImGui = {
    * create a Tab. Returns true if the Tab is selected.
    */
   BeginTabItem(
-    label: string,
+    label: string | ImStrHandle,
     p_open: [boolean] | null = null,
     flags: ImGuiTabItemFlags = 0,
   ): boolean {
+    if (typeof label === "number") {
+      return Mod.export.ImGui_BeginTabItem_Interned(label, p_open, flags);
+    }
     return Mod.export.ImGui_BeginTabItem(label, p_open, flags);
   },
   /**
@@ -8734,13 +11022,20 @@ export const ImGui = {
   /**
    * create a Tab behaving like a button. return true when clicked. cannot be selected in the tab bar.
    */
-  TabItemButton(label: string, flags: ImGuiTabItemFlags = 0): boolean {
+  TabItemButton(label: string | ImStrHandle, flags: ImGuiTabItemFlags = 0): boolean {
+    if (typeof label === "number") {
+      return Mod.export.ImGui_TabItemButton_Interned(label, flags);
+    }
     return Mod.export.ImGui_TabItemButton(label, flags);
   },
   /**
    * notify TabBar or Docking system of a closed tab/window ahead (useful to reduce visual flicker on reorderable tab bars). For tab-bar: call after BeginTabBar() and before Tab submissions. Otherwise call with a window name.
    */
-  SetTabItemClosed(tab_or_docked_window_label: string): void {
+  SetTabItemClosed(tab_or_docked_window_label: string | ImStrHandle): void {
+    if (typeof tab_or_docked_window_label === "number") {
+      Mod.export.ImGui_SetTabItemClosed_Interned(tab_or_docked_window_label);
+      return;
+    }
     Mod.export.ImGui_SetTabItemClosed(tab_or_docked_window_label);
   },
   /**
@@ -8824,7 +11119,11 @@ export const ImGui = {
   /**
    * start logging to file
    */
-  LogToFile(auto_open_depth: number = -1, filename: string = ""): void {
+  LogToFile(auto_open_depth: number = -1, filename: string | ImStrHandle = ""): void {
+    if (typeof filename === "number") {
+      Mod.export.ImGui_LogToFile_Interned(auto_open_depth, filename);
+      return;
+    }
     Mod.export.ImGui_LogToFile(auto_open_depth, filename);
   },
   /**
@@ -8879,7 +11178,10 @@ export const ImGui = {
   /**
    * accept contents of a given type. If ImGuiDragDropFlags_AcceptBeforeDelivery is set you can peek into the payload before the mouse button is released.
    */
-  AcceptDragDropPayload(type: string, flags: ImGuiDragDropFlags = 0): ImGuiPayload {
+  AcceptDragDropPayload(type: string | ImStrHandle, flags: ImGuiDragDropFlags = 0): ImGuiPayload {
+    if (typeof type === "number") {
+      return ImGuiPayload.From(Mod.export.ImGui_AcceptDragDropPayload_Interned(type, flags));
+    }
     return ImGuiPayload.From(Mod.export.ImGui_AcceptDragDropPayload(type, flags));
   },
   /**
@@ -9137,13 +11439,28 @@ export const ImGui = {
    * Text Utilities
    */
   CalcTextSize(
-    text: string,
-    text_end: string = "",
+    text: string | ImStrHandle,
+    text_end: string | ImStrHandle = "",
     hide_text_after_double_hash: boolean = false,
     wrap_width: number = -1.0,
   ): ImVec2 {
+    if (typeof text === "number" && (typeof text_end === "number" || text_end === "")) {
+      return ImVec2.From(
+        Mod.export.ImGui_CalcTextSize_Interned(
+          text,
+          typeof text_end === "number" ? text_end : ImGuiImplWeb.Intern(text_end),
+          hide_text_after_double_hash,
+          wrap_width,
+        ),
+      );
+    }
     return ImVec2.From(
-      Mod.export.ImGui_CalcTextSize(text, text_end, hide_text_after_double_hash, wrap_width),
+      Mod.export.ImGui_CalcTextSize(
+        getString(text),
+        getString(text_end),
+        hide_text_after_double_hash,
+        wrap_width,
+      ),
     );
   },
   /**
@@ -9159,20 +11476,44 @@ export const ImGui = {
     r: number,
     g: number,
     b: number,
-    out_h: [number],
-    out_s: [number],
-    out_v: [number],
+    out_h: [number] | Float32Array,
+    out_s: [number] | Float32Array,
+    out_v: [number] | Float32Array,
   ): void {
+    if (ArrayBuffer.isView(out_h) || ArrayBuffer.isView(out_s) || ArrayBuffer.isView(out_v)) {
+      Mod.export.ImGui_ColorConvertRGBtoHSV_View(
+        r,
+        g,
+        b,
+        HeapView.In(out_h, Float32Array, true, 1),
+        HeapView.In(out_s, Float32Array, true, 1),
+        HeapView.In(out_v, Float32Array, true, 1),
+      );
+      HeapView.Flush();
+      return;
+    }
     Mod.export.ImGui_ColorConvertRGBtoHSV(r, g, b, out_h, out_s, out_v);
   },
   ColorConvertHSVtoRGB(
     h: number,
     s: number,
     v: number,
-    out_r: [number],
-    out_g: [number],
-    out_b: [number],
+    out_r: [number] | Float32Array,
+    out_g: [number] | Float32Array,
+    out_b: [number] | Float32Array,
   ): void {
+    if (ArrayBuffer.isView(out_r) || ArrayBuffer.isView(out_g) || ArrayBuffer.isView(out_b)) {
+      Mod.export.ImGui_ColorConvertHSVtoRGB_View(
+        h,
+        s,
+        v,
+        HeapView.In(out_r, Float32Array, true, 1),
+        HeapView.In(out_g, Float32Array, true, 1),
+        HeapView.In(out_b, Float32Array, true, 1),
+      );
+      HeapView.Flush();
+      return;
+    }
     Mod.export.ImGui_ColorConvertHSVtoRGB(h, s, v, out_r, out_g, out_b);
   },
 
@@ -9380,13 +11721,21 @@ export const ImGui = {
   GetClipboardText(): string {
     return Mod.export.ImGui_GetClipboardText();
   },
-  SetClipboardText(text: string): void {
+  SetClipboardText(text: string | ImStrHandle): void {
+    if (typeof text === "number") {
+      Mod.export.ImGui_SetClipboardText_Interned(text);
+      return;
+    }
     Mod.export.ImGui_SetClipboardText(text);
   },
   /**
    * call after CreateContext() and before the first call to NewFrame() to provide .ini data from your own data source.
    */
-  LoadIniSettingsFromMemory(ini_data: string, ini_size: number = 0): void {
+  LoadIniSettingsFromMemory(ini_data: string | ImStrHandle, ini_size: number = 0): void {
+    if (typeof ini_data === "number") {
+      Mod.export.ImGui_LoadIniSettingsFromMemory_Interned(ini_data, ini_size);
+      return;
+    }
     Mod.export.ImGui_LoadIniSettingsFromMemory(ini_data, ini_size);
   },
   /**
@@ -9401,7 +11750,11 @@ export const ImGui = {
    * - Interactive tools are all accessible from the 'Dear ImGui Demo->Tools' menu.
    * - Read https://github.com/ocornut/imgui/wiki/Debug-Tools for a description of all available debug tools.
    */
-  DebugTextEncoding(text: string): void {
+  DebugTextEncoding(text: string | ImStrHandle): void {
+    if (typeof text === "number") {
+      Mod.export.ImGui_DebugTextEncoding_Interned(text);
+      return;
+    }
     Mod.export.ImGui_DebugTextEncoding(text);
   },
   DebugFlashStyleColor(idx: ImGuiCol): void {
@@ -9414,7 +11767,7 @@ export const ImGui = {
    * This is called by IMGUI_CHECKVERSION() macro.
    */
   DebugCheckVersionAndDataLayout(
-    version_str: string,
+    version_str: string | ImStrHandle,
     sz_io: number,
     sz_style: number,
     sz_vec2: number,
@@ -9422,6 +11775,17 @@ export const ImGui = {
     sz_drawvert: number,
     sz_drawidx: number,
   ): boolean {
+    if (typeof version_str === "number") {
+      return Mod.export.ImGui_DebugCheckVersionAndDataLayout_Interned(
+        version_str,
+        sz_io,
+        sz_style,
+        sz_vec2,
+        sz_vec4,
+        sz_drawvert,
+        sz_drawidx,
+      );
+    }
     return Mod.export.ImGui_DebugCheckVersionAndDataLayout(
       version_str,
       sz_io,
@@ -9562,6 +11926,51 @@ export const ImGuiImplWGPU = {
   },
 };
 
+/**
+ * Totals counted by {@linkcode ImGuiImplNull} since the last reset.
+ */
+export interface NullRenderStats {
+  frames: number;
+  vertices: number;
+  indices: number;
+  drawCalls: number;
+
+  /**
+   * Draw commands referencing indices, vertices or textures which don't exist.
+   */
+  errors: number;
+}
+
+/**
+ * Renderer backend which doesn't draw anything. It validates the draw data and counts the
+ * vertices, indices and draw calls instead, for measuring the CPU cost of frames without a GPU.
+ */
+export const ImGuiImplNull = {
+  Init(): boolean {
+    return Mod.export.cImGui_ImplNull_Init();
+  },
+
+  Shutdown(): void {
+    Mod.export.cImGui_ImplNull_Shutdown();
+  },
+
+  NewFrame(): void {
+    Mod.export.cImGui_ImplNull_NewFrame();
+  },
+
+  RenderDrawData(draw_data: ImDrawData): void {
+    Mod.export.cImGui_ImplNull_RenderDrawData(draw_data.ptr);
+  },
+
+  GetStats(): NullRenderStats {
+    return Mod.export.cImGui_ImplNull_GetStats();
+  },
+
+  ResetStats(): void {
+    Mod.export.cImGui_ImplNull_ResetStats();
+  },
+};
+
 export function loadTextureWebGPU(
   device: GPUDevice,
   data?: HTMLImageElement | Uint8Array,
@@ -9830,6 +12239,29 @@ const metaKeyInfo = {
   isDown: false,
 };
 
+/**
+ * The part of {@linkcode ImGuiIO} fed by the browser input handlers. This is the
+ * {@linkcode InputRingBuffer} in the WASM heap, or an {@linkcode InputEventQueue} when Dear ImGui
+ * runs in a worker.
+ */
+type InputSink = Pick<
+  ImGuiIO,
+  | "AddMousePosEvent"
+  | "AddMouseButtonEvent"
+  | "AddMouseWheelEvent"
+  | "AddKeyEvent"
+  | "AddInputCharactersUTF8"
+  | "AddFocusEvent"
+>;
+
+/**
+ * State of Dear ImGui the browser input handlers react to.
+ */
+interface InputFeedback {
+  mouseCursor(): ImGuiMouseCursor;
+  wantTextInput(): boolean;
+}
+
 /**
  * Forwards keyboard events to Dear ImGui. This is both used for normal keyboard events as well as
  * for the virtual keyboard, see {@linkcode setupKeyboardIO} and {@linkcode setupTouchIO}.
@@ -9838,7 +12270,7 @@ const metaKeyInfo = {
  * @param keyDown Whether the key is being pressed or released.
  * @param io The {@linkcode ImGuiIO} object to forward the event to.
  */
-const handleKeyboardEvent = (event: KeyboardEvent, keyDown: boolean, io: ImGuiIO) => {
+const handleKeyboardEvent = (event: KeyboardEvent, keyDown: boolean, io: InputSink) => {
   if (!Object.hasOwn(KEYBOARD_MAP, event.key)) {
     return;
   }
@@ -9867,10 +12299,9 @@ const handleKeyboardEvent = (event: KeyboardEvent, keyDown: boolean, io: ImGuiIO
 };
 
 const setDisplayProperties = (canvas: HTMLCanvasElement) => {
-  const io = ImGui.GetIO();
-  const width = Math.floor(canvas.clientWidth);
-  const height = Math.floor(canvas.clientHeight);
-  io.DisplaySize = new ImVec2(width, height);
+  const io = ImGuiImplWeb.GetIOFields();
+  io.Set(IOField.DisplayWidth, Math.floor(canvas.clientWidth));
+  io.Set(IOField.DisplayHeight, Math.floor(canvas.clientHeight));
 };
 
 /**
@@ -9880,7 +12311,7 @@ const setDisplayProperties = (canvas: HTMLCanvasElement) => {
  * @param isDown Whether the button is being pressed or released.
  * @param io The {@linkcode ImGuiIO} object to forward the event to.
  */
-const handleMouseButtonEvent = (event: MouseEvent, isDown: boolean, io: ImGuiIO) => {
+const handleMouseButtonEvent = (event: MouseEvent, isDown: boolean, io: InputSink) => {
   if (!Object.hasOwn(MOUSE_BUTTON_MAP, event.button)) {
     return;
   }
@@ -9892,22 +12323,35 @@ const handleMouseButtonEvent = (event: MouseEvent, isDown: boolean, io: ImGuiIO)
  * Sets up mouse key, wheel input and movement. Also handles cursor style changes.
  *
  * @param canvas The canvas element to set up.
+ * @param io The input sink to forward the events to.
+ * @param feedback The state of Dear ImGui for the cursor style.
+ * @param signal Removes the event listeners when aborted.
  */
-const setupMouseIO = (canvas: HTMLCanvasElement) => {
-  const io = ImGui.GetIO();
+const setupMouseIO = (
+  canvas: HTMLCanvasElement,
+  io: InputSink,
+  feedback: InputFeedback,
+  signal?: AbortSignal,
+) => {
   const scrollSpeed = 0.01;
 
-  canvas.addEventListener("pointermove", (e) => {
-    const rect = canvas.getBoundingClientRect();
-    io.AddMousePosEvent(e.clientX - rect.left, e.clientY - rect.top);
+  canvas.addEventListener(
+    "pointermove",
+    (e) => {
+      const rect = canvas.getBoundingClientRect();
+      io.AddMousePosEvent(e.clientX - rect.left, e.clientY - rect.top);
 
-    canvas.style.cursor = MOUSE_CURSOR_MAP[ImGui.GetMouseCursor()];
-  });
+      canvas.style.cursor = MOUSE_CURSOR_MAP[feedback.mouseCursor()];
+    },
+    { signal },
+  );
 
-  canvas.addEventListener("pointerdown", (e) => handleMouseButtonEvent(e, true, io));
-  canvas.addEventListener("pointerup", (e) => handleMouseButtonEvent(e, false, io));
-  canvas.addEventListener("wheel", (e) =>
-    io.AddMouseWheelEvent(-e.deltaX * scrollSpeed, -e.deltaY * scrollSpeed),
+  canvas.addEventListener("pointerdown", (e) => handleMouseButtonEvent(e, true, io), { signal });
+  canvas.addEventListener("pointerup", (e) => handleMouseButtonEvent(e, false, io), { signal });
+  canvas.addEventListener(
+    "wheel",
+    (e) => io.AddMouseWheelEvent(-e.deltaX * scrollSpeed, -e.deltaY * scrollSpeed),
+    { signal },
   );
 };
 
@@ -9916,18 +12360,13 @@ const setupMouseIO = (canvas: HTMLCanvasElement) => {
  * {@linkcode handleKeyboardEvent}.
  *
  * @param canvas The canvas element to set up.
+ * @param io The input sink to forward the events to.
+ * @param signal Removes the event listeners when aborted.
  */
-const setupKeyboardIO = (canvas: HTMLCanvasElement) => {
-  const io = ImGui.GetIO();
-
-  // Swap super and ctrl keys on macOS.
-  if (navigator.userAgent.includes("Mac")) {
-    io.ConfigMacOSXBehaviors = true;
-  }
-
+const setupKeyboardIO = (canvas: HTMLCanvasElement, io: InputSink, signal?: AbortSignal) => {
   // TODO: Fix too fast repeated inputs (Backspace, Delete...).
-  canvas.addEventListener("keydown", (e) => handleKeyboardEvent(e, true, io));
-  canvas.addEventListener("keyup", (e) => handleKeyboardEvent(e, false, io));
+  canvas.addEventListener("keydown", (e) => handleKeyboardEvent(e, true, io), { signal });
+  canvas.addEventListener("keyup", (e) => handleKeyboardEvent(e, false, io), { signal });
 };
 
 /**
@@ -9937,9 +12376,16 @@ const setupKeyboardIO = (canvas: HTMLCanvasElement) => {
  * - Two-finger touches are treated as mouse scrolls.
  *
  * @param canvas The canvas element to set up.
+ * @param io The input sink to forward the events to.
+ * @param feedback The state of Dear ImGui for showing the virtual keyboard.
+ * @param signal Removes the event listeners when aborted.
  */
-const setupTouchIO = (canvas: HTMLCanvasElement) => {
-  const io = ImGui.GetIO();
+const setupTouchIO = (
+  canvas: HTMLCanvasElement,
+  io: InputSink,
+  feedback: InputFeedback,
+  signal?: AbortSignal,
+) => {
   const scrollSpeed = 0.02;
   let lastPos = { x: 0, y: 0 };
 
@@ -9995,7 +12441,7 @@ const setupTouchIO = (canvas: HTMLCanvasElement) => {
   };
 
   const handleTextInput = () => {
-    if (io.WantTextInput) {
+    if (feedback.wantTextInput()) {
       document.body.appendChild(input);
       input.focus();
 
@@ -10005,7 +12451,7 @@ const setupTouchIO = (canvas: HTMLCanvasElement) => {
         keyUpHandler(e);
 
         // Exits single-line input fields when pressing Enter.
-        if (!io.WantTextInput) {
+        if (!feedback.wantTextInput()) {
           blurHandler();
         }
       });
@@ -10014,19 +12460,29 @@ const setupTouchIO = (canvas: HTMLCanvasElement) => {
     }
   };
 
-  canvas.addEventListener("touchstart", (e) => handleTouchEvent(e, true));
-  canvas.addEventListener("touchmove", (e) => handleTouchEvent(e));
+  canvas.addEventListener("touchstart", (e) => handleTouchEvent(e, true), { signal });
+  canvas.addEventListener("touchmove", (e) => handleTouchEvent(e), { signal });
+
+  canvas.addEventListener(
+    "touchend",
+    (e) => {
+      lastPos = { x: 0, y: 0 };
+      handleTouchEvent(e, false);
+      handleTextInput();
+    },
+    { signal },
+  );
 
-  canvas.addEventListener("touchend", (e) => {
-    lastPos = { x: 0, y: 0 };
-    handleTouchEvent(e, false);
-    handleTextInput();
-  });
+  canvas.addEventListener(
+    "touchcancel",
+    (e) => {
+      lastPos = { x: 0, y: 0 };
+      handleTouchEvent(e, false);
+    },
+    { signal },
+  );
 
-  canvas.addEventListener("touchcancel", (e) => {
-    lastPos = { x: 0, y: 0 };
-    handleTouchEvent(e, false);
-  });
+  signal?.addEventListener("abort", blurHandler);
 };
 
 /**
@@ -10049,6 +12505,24 @@ const setupClipboardIO = () => {
   });
 };
 
+/**
+ * Events which feed input into Dear ImGui and wake up the lazy render loop.
+ */
+const INPUT_EVENT_TYPES = [
+  "pointermove",
+  "pointerdown",
+  "pointerup",
+  "wheel",
+  "keydown",
+  "keyup",
+  "touchstart",
+  "touchmove",
+  "touchend",
+  "touchcancel",
+  "focus",
+  "blur",
+];
+
 /**
  * Sets up Dear ImGui for the browser. This includes:
  * - Setting up the canvas and resize events.
@@ -10064,73 +12538,535 @@ const setupBrowserIO = (canvas: HTMLCanvasElement) => {
   const io = ImGui.GetIO();
   io.BackendFlags = ImGui.BackendFlags.HasMouseCursors;
 
-  canvas.tabIndex = 1;
-  canvas.addEventListener("contextmenu", (e) => e.preventDefault());
-  canvas.addEventListener("focus", () => io.AddFocusEvent(true));
-  canvas.addEventListener("blur", () => io.AddFocusEvent(false));
+  // Swap super and ctrl keys on macOS.
+  if (navigator.userAgent.includes("Mac")) {
+    io.ConfigMacOSXBehaviors = true;
+  }
 
   setDisplayProperties(canvas);
 
-  setupMouseIO(canvas);
-  setupKeyboardIO(canvas);
-  setupTouchIO(canvas);
+  const feedback = {
+    mouseCursor: () => ImGui.GetMouseCursor(),
+    wantTextInput: () => ImGuiImplWeb.GetIOFields().Get(IOField.WantTextInput) !== 0,
+  };
+  State.inputRing = new InputRingBuffer();
+  setupCanvasInput(canvas, State.inputRing, feedback, () => State.wakeFn?.());
   setupClipboardIO();
 
   Mod.export.SetupIniSettings();
 };
 
 /**
- * Object containing some state information for jsimgui. Users most likely don't need to worry
- * about this.
+ * Sets up the input event listeners of the canvas, shared by {@linkcode setupBrowserIO} and the
+ * main thread side of {@linkcode ImGuiImplWeb.StartWorker}.
+ *
+ * @param canvas The canvas element to set up.
+ * @param io The input sink to forward the events to.
+ * @param feedback The state of Dear ImGui the handlers react to.
+ * @param wake Called on every input, to wake up the lazy render loop (see ImGuiImplWeb.RunLazy).
+ * @param signal Removes the event listeners when aborted.
  */
-export const State = {
-  canvas: null as HTMLCanvasElement | null,
-  device: null as GPUDevice | null,
-  backend: null as "webgl" | "webgl2" | "webgpu" | null,
-
-  beginRenderFn: null as (() => void) | null,
-  endRenderFn: null as ((passEncoder?: GPURenderPassEncoder) => void) | null,
+const setupCanvasInput = (
+  canvas: HTMLCanvasElement,
+  io: InputSink,
+  feedback: InputFeedback,
+  wake: () => void,
+  signal?: AbortSignal,
+) => {
+  canvas.tabIndex = 1;
+  canvas.addEventListener("contextmenu", (e) => e.preventDefault(), { signal });
+  canvas.addEventListener("focus", () => io.AddFocusEvent(true), { signal });
+  canvas.addEventListener("blur", () => io.AddFocusEvent(false), { signal });
 
-  clipboardData: "" as string,
+  setupMouseIO(canvas, io, feedback, signal);
+  setupKeyboardIO(canvas, io, signal);
+  setupTouchIO(canvas, io, feedback, signal);
 
-  saveIniSettingsFn: null as ((iniData: string) => void) | null,
-  loadIniSettingsFn: null as (() => string) | null,
+  for (const type of INPUT_EVENT_TYPES) {
+    canvas.addEventListener(type, wake, { passive: true, signal });
+  }
+  globalThis.addEventListener("resize", wake, { signal });
+  document.addEventListener("paste", wake, { signal });
 };
 
 /**
- * Options for loading a texture.
+ * Types of the events in an {@linkcode InputEventQueue} and {@linkcode InputRingBuffer}. Keep in
+ * sync with `input_event_type` in imgui.cpp.
  */
-export interface TextureOptions {
+const InputEventType = {
+  MousePos: 0,
+  MouseButton: 1,
+  MouseWheel: 2,
+  Key: 3,
+  Char: 4,
+  Focus: 5,
+} as const;
+
+/**
+ * Implements the {@linkcode InputSink} methods by packing each event into a record of one type
+ * word and three float payload words.
+ */
+abstract class InputEventWriter implements InputSink {
+  protected abstract push(type: number, a: number, b?: number, c?: number): void;
+
+  AddMousePosEvent(x: number, y: number): void {
+    this.push(InputEventType.MousePos, x, y);
+  }
+  AddMouseButtonEvent(button: number, down: boolean): void {
+    this.push(InputEventType.MouseButton, button, down ? 1 : 0);
+  }
+  AddMouseWheelEvent(wheel_x: number, wheel_y: number): void {
+    this.push(InputEventType.MouseWheel, wheel_x, wheel_y);
+  }
+  AddKeyEvent(key: ImGuiKey, down: boolean): void {
+    this.push(InputEventType.Key, key, down ? 1 : 0);
+  }
+  AddInputCharactersUTF8(str: string): void {
+    for (const char of str) {
+      this.push(InputEventType.Char, char.codePointAt(0) as number);
+    }
+  }
+  AddFocusEvent(focused: boolean): void {
+    this.push(InputEventType.Focus, focused ? 1 : 0);
+  }
+}
+
+/**
+ * Ring buffer of input events in the WASM heap (`input_ring` in imgui.cpp). The browser input
+ * handlers write into it without calling into WASM, and {@linkcode ImGuiImplWeb.BeginRender}
+ * replays the events natively in one call, coalescing runs of mouse moves. A full ring is drained
+ * early instead of dropping events.
+ */
+class InputRingBuffer extends InputEventWriter {
+  static readonly #HEAD = 0;
+  static readonly #TAIL = 1;
+  static readonly #CAPACITY = 2;
+  static readonly #HEADER_WORDS = 4;
+  static readonly #RECORD_WORDS = 4;
+
+  readonly ptr: number;
+  readonly capacity: number;
+  #ints = new Int32Array(0);
+  #floats = new Float32Array(0);
+
+  constructor() {
+    super();
+    this.ptr = Mod.export.get_input_ring();
+    this.#updateViews();
+    this.capacity = this.#ints[(this.ptr >> 2) + InputRingBuffer.#CAPACITY];
+  }
+
+  override push(type: number, a: number, b = 0, c = 0): void {
+    this.#updateViews();
+    const base = this.ptr >> 2;
+
+    let tail = this.#ints[base + InputRingBuffer.#TAIL];
+    if (((tail - Atomics.load(this.#ints, base + InputRingBuffer.#HEAD)) | 0) >= this.capacity) {
+      this.drain();
+      this.#updateViews();
+      tail = this.#ints[base + InputRingBuffer.#TAIL];
+    }
+
+    const slot = tail & (this.capacity - 1);
+    const i = base + InputRingBuffer.#HEADER_WORDS + slot * InputRingBuffer.#RECORD_WORDS;
+    this.#ints[i] = type;
+    this.#floats[i + 1] = a;
+    this.#floats[i + 2] = b;
+    this.#floats[i + 3] = c;
+
+    // Publishes the record to the native drain.
+    Atomics.store(this.#ints, base + InputRingBuffer.#TAIL, (tail + 1) | 0);
+  }
+
   /**
-   * The texture reference to update. Only required if you want to update an existing texture.
+   * Replays the queued events into the `ImGuiIO` natively. Returns the number of events.
    */
-  ref?: ImTextureRef;
+  drain(): number {
+    return Mod.export.drain_input_events();
+  }
+
+  #updateViews(): void {
+    const buffer = Mod.export.HEAPU8.buffer;
+    if (this.#ints.buffer !== buffer) {
+      this.#ints = new Int32Array(buffer);
+      this.#floats = new Float32Array(buffer);
+    }
+  }
+}
+
+/**
+ * Single-producer single-consumer queue of input events in a `SharedArrayBuffer`, used when Dear
+ * ImGui runs in a worker (see {@linkcode ImGuiImplWeb.StartWorker}). The main thread pushes the
+ * browser input without blocking, the worker moves it into its {@linkcode InputRingBuffer} in
+ * {@linkcode ImGuiImplWeb.BeginRender}. The header also carries the display size from the main
+ * thread and the mouse cursor and text input state back from the worker.
+ *
+ * Events are records of one type word and three float payload words. When the worker falls behind
+ * by a full queue, new events are dropped and counted.
+ *
+ * A worker running {@linkcode ImGuiImplWeb.RunLazy} marks the queue idle before it sleeps, and the
+ * main thread only posts a wake message for the first event after that, not for every event.
+ */
+export class InputEventQueue extends InputEventWriter implements InputFeedback {
+  static readonly #HEAD = 0;
+  static readonly #TAIL = 1;
+  static readonly #DROPPED = 2;
+  static readonly #DISPLAY_WIDTH = 3;
+  static readonly #DISPLAY_HEIGHT = 4;
+  static readonly #MOUSE_CURSOR = 5;
+  static readonly #WANT_TEXT_INPUT = 6;
+  static readonly #IDLE = 7;
+  static readonly #HEADER_WORDS = 8;
+  static readonly #RECORD_WORDS = 4;
+
+  readonly buffer: SharedArrayBuffer;
+  readonly capacity: number;
+  #ints: Int32Array;
+  #floats: Float32Array;
+
+  /**
+   * @param source The capacity in events of a new queue (a power of two), or the buffer of an
+   * existing queue, e.g. received by the worker.
+   */
+  constructor(source: number | SharedArrayBuffer) {
+    super();
+
+    if (typeof source === "number" && (source <= 0 || (source & (source - 1)) !== 0)) {
+      throw new Error("jsimgui: The input queue capacity must be a power of two.");
+    }
+
+    this.buffer =
+      typeof source === "number"
+        ? new SharedArrayBuffer(
+            (InputEventQueue.#HEADER_WORDS + source * InputEventQueue.#RECORD_WORDS) * 4,
+          )
+        : source;
+    this.capacity =
+      (this.buffer.byteLength / 4 - InputEventQueue.#HEADER_WORDS) / InputEventQueue.#RECORD_WORDS;
+    this.#ints = new Int32Array(this.buffer);
+    this.#floats = new Float32Array(this.buffer);
+  }
 
   /**
-   * The width of the texture. This needs to be specified if the texture is loaded
-   * from a `Uint8Array`.
+   * The number of events dropped because the queue was full.
    */
-  width?: number;
+  get dropped(): number {
+    return Atomics.load(this.#ints, InputEventQueue.#DROPPED);
+  }
+
+  #recordIndex(position: number): number {
+    const slot = position & (this.capacity - 1);
+    return InputEventQueue.#HEADER_WORDS + slot * InputEventQueue.#RECORD_WORDS;
+  }
+
+  protected override push(type: number, a: number, b = 0, c = 0): void {
+    const tail = Atomics.load(this.#ints, InputEventQueue.#TAIL);
+    const head = Atomics.load(this.#ints, InputEventQueue.#HEAD);
+    if (((tail - head) | 0) >= this.capacity) {
+      Atomics.add(this.#ints, InputEventQueue.#DROPPED, 1);
+      return;
+    }
+
+    const i = this.#recordIndex(tail);
+    this.#ints[i] = type;
+    this.#floats[i + 1] = a;
+    this.#floats[i + 2] = b;
+    this.#floats[i + 3] = c;
+
+    // Publishes the record to the consumer.
+    Atomics.store(this.#ints, InputEventQueue.#TAIL, (tail + 1) | 0);
+  }
 
   /**
-   * The height of the texture. This needs to be specified if the texture is loaded
-   * from a `Uint8Array`.
+   * Moves the queued events into the given {@linkcode InputRingBuffer}, which replays them in
+   * the same frame. Called by the worker.
    */
-  height?: number;
+  drain(ring: InputRingBuffer): void {
+    let head = Atomics.load(this.#ints, InputEventQueue.#HEAD);
+    const tail = Atomics.load(this.#ints, InputEventQueue.#TAIL);
+
+    for (; head !== tail; head = (head + 1) | 0) {
+      const i = this.#recordIndex(head);
+      ring.push(this.#ints[i], this.#floats[i + 1], this.#floats[i + 2], this.#floats[i + 3]);
+    }
+
+    // Releases the records to the producer.
+    Atomics.store(this.#ints, InputEventQueue.#HEAD, head);
+  }
 
   /**
-   * Custom load function to use for loading the texture/image. You can use this if you require
-   * additional processing. Note that you will need to write backend-specific code for this.
+   * Marks the worker as idle, before its lazy render loop sleeps. Called by the worker.
    *
-   * @param data The image data to load.
-   * @param options The options for loading the texture.
-   * @returns The ImTextureID of the loaded image.
+   * @returns Whether events were pushed meanwhile, which the worker renders instead of sleeping.
+   * Either this sees the new events or {@linkcode InputEventQueue.claimWake} sees the idle flag.
    */
-  processFn?: (
-    data?: HTMLImageElement | Uint8Array,
-    options?: TextureOptions,
-  ) => WebGLTexture | [GPUTexture, GPUTextureView];
-}
+  markIdle(): boolean {
+    Atomics.store(this.#ints, InputEventQueue.#IDLE, 1);
+    const tail = Atomics.load(this.#ints, InputEventQueue.#TAIL);
+    return tail !== Atomics.load(this.#ints, InputEventQueue.#HEAD);
+  }
+
+  /**
+   * Marks the worker as rendering again. Called by the worker.
+   */
+  markBusy(): void {
+    Atomics.store(this.#ints, InputEventQueue.#IDLE, 0);
+  }
+
+  /**
+   * Clears the idle flag of the worker. Called by the main thread after pushing events.
+   *
+   * @returns Whether the worker was idle, so the caller is the one to wake it up.
+   */
+  claimWake(): boolean {
+    return Atomics.compareExchange(this.#ints, InputEventQueue.#IDLE, 1, 0) === 1;
+  }
+
+  setDisplaySize(width: number, height: number): void {
+    Atomics.store(this.#ints, InputEventQueue.#DISPLAY_WIDTH, width);
+    Atomics.store(this.#ints, InputEventQueue.#DISPLAY_HEIGHT, height);
+  }
+  getDisplaySize(): [number, number] {
+    return [
+      Atomics.load(this.#ints, InputEventQueue.#DISPLAY_WIDTH),
+      Atomics.load(this.#ints, InputEventQueue.#DISPLAY_HEIGHT),
+    ];
+  }
+
+  setFeedback(mouseCursor: ImGuiMouseCursor, wantTextInput: boolean): void {
+    Atomics.store(this.#ints, InputEventQueue.#MOUSE_CURSOR, mouseCursor);
+    Atomics.store(this.#ints, InputEventQueue.#WANT_TEXT_INPUT, wantTextInput ? 1 : 0);
+  }
+  mouseCursor(): ImGuiMouseCursor {
+    return Atomics.load(this.#ints, InputEventQueue.#MOUSE_CURSOR);
+  }
+  wantTextInput(): boolean {
+    return Atomics.load(this.#ints, InputEventQueue.#WANT_TEXT_INPUT) !== 0;
+  }
+}
+
+/**
+ * Sets up Dear ImGui in a worker, with input from the {@linkcode InputEventQueue} filled by the
+ * main thread and the clipboard forwarded through messages.
+ *
+ * This function is called by {@linkcode ImGuiImplWeb.InitInWorker}.
+ */
+const setupWorkerIO = () => {
+  const io = ImGui.GetIO();
+  io.BackendFlags = ImGui.BackendFlags.HasMouseCursors;
+  State.inputRing = new InputRingBuffer();
+
+  if (navigator.userAgent.includes("Mac")) {
+    io.ConfigMacOSXBehaviors = true;
+  }
+
+  const getClipboard = (): string => {
+    return State.clipboardData;
+  };
+
+  const setClipboard = (text: string) => {
+    State.clipboardData = text;
+    globalThis.postMessage({ type: "jsimgui:copy", text });
+  };
+
+  Mod.export.SetupClipboardFunctions(getClipboard, setClipboard);
+  Mod.export.SetupIniSettings();
+};
+
+/**
+ * Fields of {@linkcode ImGuiIOFields}, also the order of its packed
+ * {@linkcode ImGuiIOFields.Read} and {@linkcode ImGuiIOFields.Write}. Keep in sync with
+ * `io_field_layout` in imgui.cpp.
+ */
+export const IOField = {
+  DisplayWidth: 0,
+  DisplayHeight: 1,
+  DeltaTime: 2,
+  MouseX: 3,
+  MouseY: 4,
+  Framerate: 5,
+  WantCaptureMouse: 6,
+  WantCaptureKeyboard: 7,
+  WantTextInput: 8,
+  WantSetMousePos: 9,
+  WantSaveIniSettings: 10,
+} as const;
+
+export type IOField = (typeof IOField)[keyof typeof IOField];
+
+/**
+ * The {@linkcode ImGuiIO} fields used every frame, read and written in place through typed array
+ * views onto the WASM heap. Unlike the embind accessors of `ImGui.GetIO()`, which return a new
+ * `ImVec2` for `DisplaySize` or `MousePos`, nothing is allocated. Get it with
+ * {@linkcode ImGuiImplWeb.GetIOFields}.
+ *
+ * @example
+ * ```ts
+ * const io = ImGuiImplWeb.GetIOFields();
+ * io.Set(IOField.DisplayWidth, canvas.clientWidth);
+ * if (io.Get(IOField.WantCaptureMouse)) { ... }
+ * ```
+ */
+export class ImGuiIOFields {
+  static readonly #COUNT = 11;
+
+  /**
+   * The byte address of each {@linkcode IOField} in the WASM heap.
+   */
+  readonly addresses: Int32Array;
+
+  #f32 = new Float32Array(0);
+  #u8 = new Uint8Array(0);
+
+  constructor() {
+    const layout = new Int32Array(
+      Mod.export.HEAPU8.buffer,
+      Mod.export.get_io_field_layout(),
+      ImGuiIOFields.#COUNT,
+    );
+    this.addresses = layout.slice();
+  }
+
+  /**
+   * Returns a field, the `Want*` flags as 0 or 1.
+   */
+  Get(field: IOField): number {
+    this.#updateViews();
+    const address = this.addresses[field];
+    return field < IOField.WantCaptureMouse ? this.#f32[address >> 2] : this.#u8[address];
+  }
+
+  /**
+   * Sets a field, the `Want*` flags to whether the value is non-zero.
+   */
+  Set(field: IOField, value: number): void {
+    this.#updateViews();
+    const address = this.addresses[field];
+    if (field < IOField.WantCaptureMouse) {
+      this.#f32[address >> 2] = value;
+    } else {
+      this.#u8[address] = value !== 0 ? 1 : 0;
+    }
+  }
+
+  /**
+   * Reads all fields into a packed array, indexed by {@linkcode IOField}.
+   *
+   * @param out The array to fill, reuse it to avoid allocating.
+   */
+  Read(out = new Float32Array(ImGuiIOFields.#COUNT)): Float32Array {
+    for (let field = 0; field < ImGuiIOFields.#COUNT; field++) {
+      out[field] = this.Get(field as IOField);
+    }
+    return out;
+  }
+
+  /**
+   * Writes all fields from a packed array, indexed by {@linkcode IOField}.
+   */
+  Write(values: ArrayLike<number>): void {
+    for (let field = 0; field < ImGuiIOFields.#COUNT; field++) {
+      this.Set(field as IOField, values[field]);
+    }
+  }
+
+  #updateViews(): void {
+    const buffer = Mod.export.HEAPU8.buffer;
+    if (this.#u8.buffer !== buffer) {
+      this.#f32 = new Float32Array(buffer);
+      this.#u8 = new Uint8Array(buffer);
+    }
+  }
+}
+
+/**
+ * Wrappers of the structs owned by the current Dear ImGui context. `ImGui.GetIO()`,
+ * `ImGui.GetPlatformIO()` and `ImGui.GetStyle()` return them instead of wrapping a new embind
+ * handle on every call. They are recreated when the current context changes.
+ */
+const ContextStructs = {
+  context: 0,
+  io: null as ImGuiIO | null,
+  ioFields: null as ImGuiIOFields | null,
+  platformIO: null as ImGuiPlatformIO | null,
+  style: null as ImGuiStyle | null,
+
+  /**
+   * Returns the wrappers of the current context, cleared if it changed since the last call.
+   */
+  Current(): typeof ContextStructs {
+    const context = Mod.export.get_current_context_address();
+    if (context !== ContextStructs.context) {
+      ContextStructs.context = context;
+      ContextStructs.io = null;
+      ContextStructs.ioFields = null;
+      ContextStructs.platformIO = null;
+      ContextStructs.style = null;
+    }
+    return ContextStructs;
+  },
+};
+
+/**
+ * Object containing some state information for jsimgui. Users most likely don't need to worry
+ * about this.
+ */
+export const State = {
+  canvas: null as HTMLCanvasElement | OffscreenCanvas | null,
+  device: null as GPUDevice | null,
+  backend: null as "webgl" | "webgl2" | "webgpu" | "null" | null,
+
+  beginRenderFn: null as (() => void) | null,
+  endRenderFn: null as ((passEncoder?: GPURenderPassEncoder) => void) | null,
+
+  clipboardData: "" as string,
+
+  wakeFn: null as (() => void) | null,
+
+  inputQueue: null as InputEventQueue | null,
+  inputRing: null as InputRingBuffer | null,
+
+  internedStrings: new Map<string, ImStrHandle>(),
+  internedHandles: [] as string[],
+
+  saveIniSettingsFn: null as ((iniData: string) => void) | null,
+  loadIniSettingsFn: null as (() => string) | null,
+};
+
+/**
+ * Options for loading a texture.
+ */
+export interface TextureOptions {
+  /**
+   * The texture reference to update. Only required if you want to update an existing texture.
+   */
+  ref?: ImTextureRef;
+
+  /**
+   * The width of the texture. This needs to be specified if the texture is loaded
+   * from a `Uint8Array`.
+   */
+  width?: number;
+
+  /**
+   * The height of the texture. This needs to be specified if the texture is loaded
+   * from a `Uint8Array`.
+   */
+  height?: number;
+
+  /**
+   * Custom load function to use for loading the texture/image. You can use this if you require
+   * additional processing. Note that you will need to write backend-specific code for this.
+   *
+   * @param data The image data to load.
+   * @param options The options for loading the texture.
+   * @returns The ImTextureID of the loaded image.
+   */
+  processFn?: (
+    data?: HTMLImageElement | Uint8Array,
+    options?: TextureOptions,
+  ) => WebGLTexture | [GPUTexture, GPUTextureView];
+}
 
 /**
  * Object containing memory information of the WASM heap, mallinfo and stack.
@@ -10159,6 +13095,44 @@ interface MemoryInfo {
     current: number;
     free: number;
   };
+  /**
+   * The arena of the per-call binding temporaries. `peak` is the most bytes a single call used,
+   * `mallocs` only increases while the arena grows, it stays the same for steady-state frames.
+   */
+  arena: {
+    capacity: number;
+    used: number;
+    peak: number;
+    mallocs: number;
+  };
+  /**
+   * The heap allocations of Dear ImGui and of the bindings. `peak` is the high-water mark of the
+   * `live` bytes since the last {@linkcode ImGuiImplWeb.ResetMemoryPeak}. Only `counted` in
+   * instrumented builds (`build.ts --instrument`), which replace the allocator, zero otherwise.
+   */
+  alloc: {
+    counted: boolean;
+    allocs: number;
+    frees: number;
+    live: number;
+    peak: number;
+  };
+}
+
+/**
+ * Call count and cumulative time of a binding, see {@linkcode ImGuiImplWeb.GetBindingStats}.
+ */
+export interface BindingStats {
+  /**
+   * The name of the binding, e.g. `ImGui_Text` or `ImGui_SliderFloat_View`.
+   */
+  name: string;
+  calls: number;
+  /**
+   * Cumulative time in milliseconds, only measured while {@linkcode ImGuiImplWeb.SetBindingTiming}
+   * is enabled.
+   */
+  time: number;
 }
 
 /**
@@ -10166,9 +13140,17 @@ interface MemoryInfo {
  */
 export interface InitOptions {
   /**
-   * The canvas element to render Dear ImGui on.
+   * The canvas element to render Dear ImGui on. Without a canvas, jsimgui runs headless with the
+   * `null` backend, e.g. under Node.js for tests and benchmarks.
+   */
+  canvas?: HTMLCanvasElement | OffscreenCanvas;
+
+  /**
+   * The display size used when running headless without a canvas.
+   *
+   * Default is `1280x720`.
    */
-  canvas: HTMLCanvasElement;
+  displaySize?: ImVec2;
 
   /**
    * The WebGPU device used for rendering. This is only required when using the WebGPU backend.
@@ -10177,125 +13159,911 @@ export interface InitOptions {
 
   /**
    * Specify the rendering backend to use. If not specified, will be inferred from the canvas or
-   * from {@linkcode device}.
+   * from {@linkcode device}. The `null` backend renders nothing, see {@linkcode ImGuiImplNull}.
+   */
+  backend?: "webgl" | "webgl2" | "webgpu" | "null";
+
+  /**
+   * The font loader and rasterizer to use for loading fonts. Can be one of the following:
+   *
+   * - `truetype` (stb_truetype) is the default option.
+   * - `freetype` (FreeType) is an alternative option which supports more features than `truetype`
+   * but this also loads an increased WASM file (+500kb).
+   *
+   * Default is `truetype`.
+   */
+  fontLoader?: "truetype" | "freetype";
+
+  /**
+   * Whether to enable Dear ImGui extensions (imnodes, implot, ...).
+   */
+  extensions?: boolean;
+
+  /**
+   * Whether to load the split build (`build.ts --split`). Its core module leaves out the demo
+   * window, the backends and the extensions, which are loaded as side modules only when the chosen
+   * backend and options need them.
+   *
+   * Default is `false`.
+   */
+  split?: boolean;
+
+  /**
+   * Whether to load the loader with a standalone `.wasm` file (`build.ts --wasm`) instead of the
+   * WASM inlined as base64. The `.wasm` is smaller to download and compiled while it streams in.
+   *
+   * Default is `false`.
+   */
+  wasm?: boolean;
+
+  /**
+   * Whether to load the pthreads loader (`build.ts --pthread`), whose memory is a
+   * `SharedArrayBuffer`. Used by the async sorts of {@linkcode TableSorter}.
+   *
+   * Default is `false`.
+   */
+  pthread?: boolean;
+
+  /**
+   * Whether to load the SIMD loader (`build.ts --simd`), which vectorizes the string scan of
+   * {@linkcode TextFilterIndex}. Falls back to the regular loader on engines without WASM SIMD.
+   *
+   * Default is `false`.
+   */
+  simd?: boolean;
+
+  /**
+   * Name of a Cache Storage cache to keep the `.wasm` in, for the loaders with a standalone `.wasm`
+   * file. Repeat startups then skip the download and the browser can reuse its compiled code.
+   * Entries are keyed by URL, so change the name when updating jsimgui, e.g. `"jsimgui-0.13.0"`.
+   */
+  wasmCache?: string;
+
+  /**
+   * Whether to load the demo window (`ImGui.ShowDemoWindow` etc.) with the split build. The other
+   * builds always include it.
+   *
+   * Default is `false`.
+   */
+  enableDemos?: boolean;
+
+  /**
+   * Custom path to the emscripten loader script. If not provided, will be constructed
+   * automatically. If you use jsimgui via a package manager or CDN, you will most likely not
+   * need to worry about this.
+   */
+  loaderPath?: string;
+
+  /**
+   * Whether to hash the draw data to find what changed since the last hashed frame. If nothing
+   * changed, {@linkcode ImGuiImplWeb.DrawDataChanged} returns `false`, so custom renderers can skip
+   * re-uploading their buffers. A frame is only hashed when its changes are asked for, through
+   * {@linkcode ImGuiImplWeb.DrawDataChanged}, a draw data view or {@linkcode ImGuiImplWeb.RunLazy}.
+   * {@linkcode ImGuiImplWeb.EndRender} always renders, as hosts clear the canvas every frame and
+   * the backends process texture updates while rendering. The bundled backends upload the whole
+   * frame either way.
+   *
+   * Default is `false`.
    */
-  backend?: "webgl" | "webgl2" | "webgpu";
+  diffDrawData?: boolean;
+}
+
+/**
+ * This infers the backend to use for the given configuration.
+ *
+ * @param canvas The canvas element to infer the backend from.
+ * @param device The WebGPU device to use. This overrides the backend to WebGPU.
+ * @param backend The backend to use. This will explicitly use this backend.
+ * @returns The backend to use.
+ */
+const getUsedBackend = (
+  canvas: HTMLCanvasElement | OffscreenCanvas,
+  device?: GPUDevice,
+  backend?: "webgl" | "webgl2" | "webgpu" | "null",
+): "webgl" | "webgl2" | "webgpu" | "null" => {
+  if (backend) return backend;
+  if (device) return "webgpu";
+
+  const ctx =
+    canvas.getContext("webgl2") ||
+    canvas.getContext("webgl") ||
+    canvas.getContext("webgpu") ||
+    canvas.getContext("2d") ||
+    canvas.getContext("bitmaprenderer");
+
+  if (ctx instanceof WebGLRenderingContext) return "webgl";
+  if (ctx instanceof WebGL2RenderingContext) return "webgl2";
+  if (ctx instanceof GPUCanvasContext) return "webgpu";
+
+  if (ctx instanceof CanvasRenderingContext2D) {
+    throw new Error("jsimgui: 2D canvas context is not supported.");
+  }
+  if (ctx instanceof ImageBitmapRenderingContext) {
+    throw new Error("jsimgui: ImageBitmapRenderingContext is not supported.");
+  }
+
+  return "webgl2";
+};
+
+/**
+ * This initializes the WebGL/WebGL2 backend.
+ *
+ * @param canvas The canvas element to initialize the WebGL/WebGL2 backend on.
+ */
+const initWebGL = (canvas: HTMLCanvasElement | OffscreenCanvas) => {
+  const ctx = canvas.getContext("webgl2") || canvas.getContext("webgl");
+  if (!ctx) {
+    throw new Error("jsimgui: Could not create WebGL/WebGL2 context.");
+  }
+
+  const handle = Mod.export.GL.registerContext(
+    ctx,
+    ctx.getContextAttributes() as WebGLContextAttributes,
+  ) as number;
+
+  Mod.export.GL.makeContextCurrent(handle);
+  ImGuiImplOpenGL3.Init();
+
+  State.beginRenderFn = () => {
+    ImGuiImplOpenGL3.NewFrame();
+  };
+
+  State.endRenderFn = () => {
+    ImGuiImplOpenGL3.RenderDrawData(ImGui.GetDrawData());
+  };
+
+  State.canvas = canvas;
+};
+
+/**
+ * This initializes the WebGPU backend.
+ *
+ * @param canvas The canvas element to initialize the WebGPU backend on.
+ * @param device The WebGPU device to use.
+ */
+const initWebGPU = (
+  canvas: HTMLCanvasElement | OffscreenCanvas,
+  device: GPUDevice | undefined,
+) => {
+  if (!device) {
+    throw new Error("jsimgui: WebGPU device is not provided.");
+  }
+
+  ImGuiImplWGPU.Init(device);
+
+  State.beginRenderFn = () => {
+    ImGuiImplWGPU.NewFrame();
+  };
+
+  State.endRenderFn = (passEncoder?: GPURenderPassEncoder) => {
+    ImGuiImplWGPU.RenderDrawData(ImGui.GetDrawData(), passEncoder as GPURenderPassEncoder);
+  };
+
+  State.canvas = canvas;
+  State.device = device;
+};
+
+/**
+ * This initializes the null backend, which renders nothing.
+ *
+ * @param canvas The canvas element used for the display size and input, if any.
+ */
+const initNull = (canvas?: HTMLCanvasElement | OffscreenCanvas) => {
+  ImGuiImplNull.Init();
+
+  State.beginRenderFn = () => {
+    ImGuiImplNull.NewFrame();
+  };
+
+  State.endRenderFn = () => {
+    ImGuiImplNull.RenderDrawData(ImGui.GetDrawData());
+  };
+
+  State.canvas = canvas ?? null;
+};
+
+/**
+ * Whether jsimgui runs under Node.js instead of a browser.
+ */
+const isNode = (): boolean => {
+  const process = (globalThis as { process?: { versions?: { node?: string } } }).process;
+  return typeof process?.versions?.node === "string";
+};
+
+/**
+ * Number of 32-bit words per draw command in {@linkcode ImDrawListView.CmdBuffer}.
+ */
+export const IMDRAWCMD_STRIDE = 8;
+
+/**
+ * Views onto the buffers of a single `ImDrawList` in the WASM heap.
+ */
+export interface ImDrawListView {
+  /**
+   * Interleaved vertices of 5 floats each: pos.x, pos.y, uv.x, uv.y and the packed color.
+   */
+  VtxBuffer: Float32Array;
+
+  /**
+   * The same vertices as bytes, the RGBA color of a vertex starts at byte offset 16 (stride 20).
+   */
+  VtxBytes: Uint8Array;
+
+  /**
+   * The 16-bit vertex indices.
+   */
+  IdxBuffer: Uint16Array;
+
+  /**
+   * The draw commands, {@linkcode IMDRAWCMD_STRIDE} words each: ClipRect (4 floats), texture id,
+   * ElemCount, IdxOffset and VtxOffset. Read the clip rect through
+   * {@linkcode ImDrawListView.CmdFloats}. Commands with a user callback have an ElemCount of 0.
+   */
+  CmdBuffer: Int32Array;
+
+  /**
+   * The draw commands as floats, for reading the clip rect.
+   */
+  CmdFloats: Float32Array;
+
+  /**
+   * Whether the content changed since the last frame. Always `true` unless
+   * {@linkcode InitOptions.diffDrawData} is enabled, the GPU buffers of unchanged lists can be
+   * kept as they are.
+   */
+  Changed: boolean;
+}
+
+/**
+ * Views onto the draw data of a frame in the WASM heap, see
+ * {@linkcode ImGuiImplWeb.GetDrawDataView}.
+ */
+export interface ImDrawDataView {
+  DisplayPos: ImVec2;
+  DisplaySize: ImVec2;
+  FramebufferScale: ImVec2;
+  TotalVtxCount: number;
+  TotalIdxCount: number;
+  CmdLists: ImDrawListView[];
+}
+
+/**
+ * Views onto all draw lists of a frame merged into single buffers, see
+ * {@linkcode ImGuiImplWeb.GetMergedDrawDataView}. The offsets of the commands refer to the merged
+ * buffers. If the frame has no more than 65536 vertices, the indices are already rebased and all
+ * VtxOffsets are 0.
+ */
+export interface ImMergedDrawDataView extends ImDrawListView {
+  DisplayPos: ImVec2;
+  DisplaySize: ImVec2;
+  FramebufferScale: ImVec2;
+  TotalVtxCount: number;
+  TotalIdxCount: number;
+}
+
+/**
+ * Opcodes of the command buffer. Keep in sync with `command_op` in imgui.cpp.
+ */
+const CommandOp = {
+  Begin: 1,
+  End: 2,
+  BeginChild: 3,
+  EndChild: 4,
+  Text: 5,
+  TextColored: 6,
+  TextDisabled: 7,
+  TextWrapped: 8,
+  LabelText: 9,
+  BulletText: 10,
+  SeparatorText: 11,
+  Button: 12,
+  SmallButton: 13,
+  Checkbox: 14,
+  RadioButton: 15,
+  SliderFloat: 16,
+  SliderInt: 17,
+  DragFloat: 18,
+  DragInt: 19,
+  Selectable: 20,
+  TreeNode: 21,
+  TreePop: 22,
+  CollapsingHeader: 23,
+  Separator: 24,
+  SameLine: 25,
+  NewLine: 26,
+  Spacing: 27,
+  Dummy: 28,
+  Indent: 29,
+  Unindent: 30,
+  PushID: 31,
+  PopID: 32,
+  SetNextItemWidth: 33,
+  PushStyleColor: 34,
+  PopStyleColor: 35,
+  IsItemHovered: 36,
+  IsItemClicked: 37,
+  BeginTable: 38,
+  EndTable: 39,
+  TableNextRow: 40,
+  TableNextColumn: 41,
+  TableSetColumnIndex: 42,
+  TableSetupColumn: 43,
+  TableHeadersRow: 44,
+  ProgressBar: 45,
+  BeginMenuBar: 46,
+  EndMenuBar: 47,
+  BeginMenu: 48,
+  EndMenu: 49,
+  MenuItem: 50,
+} as const;
+
+const textEncoder = new TextEncoder();
+
+/**
+ * Handle of a string interned with {@linkcode ImGuiImplWeb.Intern}.
+ */
+export type ImStrHandle = number;
+
+/**
+ * Returns the string of an {@linkcode ImStrHandle}, or the string itself. Functions taking several
+ * strings resolve their handles with this when mixing handles and strings.
+ */
+const getString = (value: string | ImStrHandle): string =>
+  typeof value === "number" ? (State.internedHandles[value] ?? "") : value;
+
+/**
+ * Records Dear ImGui calls into a buffer in the WASM heap and runs all of them with a single
+ * call into WASM in {@linkcode ImGuiCommandBuffer.Execute}. Calls which return a value give
+ * back a result slot, read it with {@linkcode ImGuiCommandBuffer.GetBool} & co. after executing.
+ *
+ * Strings can be passed as {@linkcode ImStrHandle} to skip encoding constant labels every frame.
+ *
+ * ```js
+ * const cmd = ImGuiCommandBuffer.New();
+ * const label = ImGuiImplWeb.Intern("Click me");
+ *
+ * // In the render loop:
+ * cmd.Begin("Window");
+ * const clicked = cmd.Button(label);
+ * cmd.End();
+ * cmd.Execute();
+ * if (cmd.GetBool(clicked)) { ... }
+ * ```
+ */
+export class ImGuiCommandBuffer {
+  /**
+   * The address of the command words in the WASM heap, followed by the result words.
+   */
+  ptr = 0;
+
+  /**
+   * The capacity of the command and result words each.
+   */
+  capacity = 0;
+
+  /**
+   * The number of recorded command words.
+   */
+  length = 0;
+
+  #slots = 0;
+  #i32 = new Int32Array(0);
+  #f32 = new Float32Array(0);
+  #u8 = new Uint8Array(0);
+
+  /**
+   * Allocate a new command buffer.
+   *
+   * @param capacity The initial capacity in 32-bit words, grows as needed.
+   */
+  static New(capacity = 4096): ImGuiCommandBuffer {
+    const cmd = new ImGuiCommandBuffer();
+    cmd.capacity = capacity;
+    cmd.ptr = Mod.export.heap_alloc(capacity * 8);
+    return cmd;
+  }
+
+  /**
+   * Free the command buffer's native allocated memory.
+   */
+  Drop(): void {
+    Mod.export.heap_free(this.ptr);
+    this.ptr = 0;
+  }
+
+  /**
+   * Executes all recorded commands and clears the buffer for the next frame. The results stay
+   * readable until the next call.
+   */
+  Execute(): void {
+    const count = Mod.export.ExecuteCommandBuffer(
+      this.ptr,
+      this.length,
+      this.ptr + this.capacity * 4,
+    );
+
+    if (count < 0) {
+      throw new Error("jsimgui: Invalid opcode or truncated arguments in command buffer.");
+    }
+
+    this.length = 0;
+    this.#slots = 0;
+  }
+
+  /**
+   * Returns a boolean result of the last {@linkcode ImGuiCommandBuffer.Execute}.
+   */
+  GetBool(slot: number): boolean {
+    return this.GetInt(slot) !== 0;
+  }
+
+  /**
+   * Returns an integer result of the last {@linkcode ImGuiCommandBuffer.Execute}.
+   */
+  GetInt(slot: number): number {
+    this.#updateViews();
+    return this.#i32[(this.ptr >> 2) + this.capacity + slot];
+  }
+
+  /**
+   * Returns a float result of the last {@linkcode ImGuiCommandBuffer.Execute}.
+   */
+  GetFloat(slot: number): number {
+    this.#updateViews();
+    return this.#f32[(this.ptr >> 2) + this.capacity + slot];
+  }
+
+  #updateViews(): void {
+    const buffer = Mod.export.HEAPU8.buffer;
+    if (this.#i32.buffer !== buffer) {
+      this.#i32 = new Int32Array(buffer);
+      this.#f32 = new Float32Array(buffer);
+      this.#u8 = new Uint8Array(buffer);
+    }
+  }
+
+  #reserve(words: number): void {
+    if (this.length + words > this.capacity) {
+      const capacity = Math.max(this.capacity * 2, this.length + words);
+      const ptr = Mod.export.heap_alloc(capacity * 8);
+
+      this.#updateViews();
+      this.#i32.copyWithin(ptr >> 2, this.ptr >> 2, (this.ptr >> 2) + this.length);
+      Mod.export.heap_free(this.ptr);
+
+      this.ptr = ptr;
+      this.capacity = capacity;
+    }
+
+    this.#updateViews();
+  }
+
+  #op(op: number, results = 0): number {
+    this.#int(op);
+
+    const slot = this.#slots;
+    this.#slots += results;
+    return slot;
+  }
+
+  #int(value: number): void {
+    this.#reserve(1);
+    this.#i32[(this.ptr >> 2) + this.length++] = value;
+  }
+
+  #float(value: number): void {
+    this.#reserve(1);
+    this.#f32[(this.ptr >> 2) + this.length++] = value;
+  }
+
+  #vec2(value: ImVec2): void {
+    this.#float(value.x);
+    this.#float(value.y);
+  }
+
+  #str(value: string | ImStrHandle): void {
+    if (typeof value === "number") {
+      this.#int(value);
+      return;
+    }
+
+    // Worst case is 3 UTF-8 bytes per UTF-16 code unit, plus the NUL terminator.
+    const maxBytes = value.length * 3 + 1;
+    this.#reserve(1 + Math.ceil(maxBytes / 4));
+
+    const start = this.ptr + (this.length + 1) * 4;
+    const { written } = textEncoder.encodeInto(value, this.#u8.subarray(start, start + maxBytes));
+    this.#u8[start + written] = 0;
+
+    this.#i32[(this.ptr >> 2) + this.length] = -(written + 1);
+    this.length += 1 + Math.ceil((written + 1) / 4);
+  }
+
+  Begin(name: string | ImStrHandle, flags: ImGuiWindowFlags = 0): number {
+    const slot = this.#op(CommandOp.Begin, 1);
+    this.#str(name);
+    this.#int(flags);
+    return slot;
+  }
+
+  End(): void {
+    this.#op(CommandOp.End);
+  }
+
+  BeginChild(
+    str_id: string | ImStrHandle,
+    size: ImVec2 = new ImVec2(0, 0),
+    child_flags: ImGuiChildFlags = 0,
+    window_flags: ImGuiWindowFlags = 0,
+  ): number {
+    const slot = this.#op(CommandOp.BeginChild, 1);
+    this.#str(str_id);
+    this.#vec2(size);
+    this.#int(child_flags);
+    this.#int(window_flags);
+    return slot;
+  }
+
+  EndChild(): void {
+    this.#op(CommandOp.EndChild);
+  }
+
+  Text(text: string | ImStrHandle): void {
+    this.#op(CommandOp.Text);
+    this.#str(text);
+  }
+
+  TextColored(col: ImVec4, text: string | ImStrHandle): void {
+    this.#op(CommandOp.TextColored);
+    this.#float(col.x);
+    this.#float(col.y);
+    this.#float(col.z);
+    this.#float(col.w);
+    this.#str(text);
+  }
+
+  TextDisabled(text: string | ImStrHandle): void {
+    this.#op(CommandOp.TextDisabled);
+    this.#str(text);
+  }
+
+  TextWrapped(text: string | ImStrHandle): void {
+    this.#op(CommandOp.TextWrapped);
+    this.#str(text);
+  }
+
+  LabelText(label: string | ImStrHandle, text: string | ImStrHandle): void {
+    this.#op(CommandOp.LabelText);
+    this.#str(label);
+    this.#str(text);
+  }
+
+  BulletText(text: string | ImStrHandle): void {
+    this.#op(CommandOp.BulletText);
+    this.#str(text);
+  }
+
+  SeparatorText(label: string | ImStrHandle): void {
+    this.#op(CommandOp.SeparatorText);
+    this.#str(label);
+  }
+
+  Button(label: string | ImStrHandle, size: ImVec2 = new ImVec2(0, 0)): number {
+    const slot = this.#op(CommandOp.Button, 1);
+    this.#str(label);
+    this.#vec2(size);
+    return slot;
+  }
+
+  SmallButton(label: string | ImStrHandle): number {
+    const slot = this.#op(CommandOp.SmallButton, 1);
+    this.#str(label);
+    return slot;
+  }
+
+  /**
+   * Result slot is whether the value changed, the next slot holds the new value.
+   */
+  Checkbox(label: string | ImStrHandle, value: boolean): number {
+    const slot = this.#op(CommandOp.Checkbox, 2);
+    this.#str(label);
+    this.#int(value ? 1 : 0);
+    return slot;
+  }
+
+  RadioButton(label: string | ImStrHandle, active: boolean): number {
+    const slot = this.#op(CommandOp.RadioButton, 1);
+    this.#str(label);
+    this.#int(active ? 1 : 0);
+    return slot;
+  }
+
+  /**
+   * Result slot is whether the value changed, the next slot holds the new value.
+   */
+  SliderFloat(
+    label: string | ImStrHandle,
+    value: number,
+    v_min: number,
+    v_max: number,
+    format: string | ImStrHandle = "%.3f",
+    flags: ImGuiSliderFlags = 0,
+  ): number {
+    const slot = this.#op(CommandOp.SliderFloat, 2);
+    this.#str(label);
+    this.#float(value);
+    this.#float(v_min);
+    this.#float(v_max);
+    this.#str(format);
+    this.#int(flags);
+    return slot;
+  }
+
+  /**
+   * Result slot is whether the value changed, the next slot holds the new value.
+   */
+  SliderInt(
+    label: string | ImStrHandle,
+    value: number,
+    v_min: number,
+    v_max: number,
+    format: string | ImStrHandle = "%d",
+    flags: ImGuiSliderFlags = 0,
+  ): number {
+    const slot = this.#op(CommandOp.SliderInt, 2);
+    this.#str(label);
+    this.#int(value);
+    this.#int(v_min);
+    this.#int(v_max);
+    this.#str(format);
+    this.#int(flags);
+    return slot;
+  }
+
+  /**
+   * Result slot is whether the value changed, the next slot holds the new value.
+   */
+  DragFloat(
+    label: string | ImStrHandle,
+    value: number,
+    v_speed: number = 1.0,
+    v_min: number = 0.0,
+    v_max: number = 0.0,
+    format: string | ImStrHandle = "%.3f",
+    flags: ImGuiSliderFlags = 0,
+  ): number {
+    const slot = this.#op(CommandOp.DragFloat, 2);
+    this.#str(label);
+    this.#float(value);
+    this.#float(v_speed);
+    this.#float(v_min);
+    this.#float(v_max);
+    this.#str(format);
+    this.#int(flags);
+    return slot;
+  }
+
+  /**
+   * Result slot is whether the value changed, the next slot holds the new value.
+   */
+  DragInt(
+    label: string | ImStrHandle,
+    value: number,
+    v_speed: number = 1.0,
+    v_min: number = 0,
+    v_max: number = 0,
+    format: string | ImStrHandle = "%d",
+    flags: ImGuiSliderFlags = 0,
+  ): number {
+    const slot = this.#op(CommandOp.DragInt, 2);
+    this.#str(label);
+    this.#int(value);
+    this.#float(v_speed);
+    this.#int(v_min);
+    this.#int(v_max);
+    this.#str(format);
+    this.#int(flags);
+    return slot;
+  }
+
+  Selectable(
+    label: string | ImStrHandle,
+    selected: boolean = false,
+    flags: ImGuiSelectableFlags = 0,
+    size: ImVec2 = new ImVec2(0, 0),
+  ): number {
+    const slot = this.#op(CommandOp.Selectable, 1);
+    this.#str(label);
+    this.#int(selected ? 1 : 0);
+    this.#int(flags);
+    this.#vec2(size);
+    return slot;
+  }
+
+  TreeNode(label: string | ImStrHandle): number {
+    const slot = this.#op(CommandOp.TreeNode, 1);
+    this.#str(label);
+    return slot;
+  }
+
+  TreePop(): void {
+    this.#op(CommandOp.TreePop);
+  }
+
+  CollapsingHeader(label: string | ImStrHandle, flags: ImGuiTreeNodeFlags = 0): number {
+    const slot = this.#op(CommandOp.CollapsingHeader, 1);
+    this.#str(label);
+    this.#int(flags);
+    return slot;
+  }
+
+  Separator(): void {
+    this.#op(CommandOp.Separator);
+  }
+
+  SameLine(offset_from_start_x: number = 0.0, spacing: number = -1.0): void {
+    this.#op(CommandOp.SameLine);
+    this.#float(offset_from_start_x);
+    this.#float(spacing);
+  }
+
+  NewLine(): void {
+    this.#op(CommandOp.NewLine);
+  }
+
+  Spacing(): void {
+    this.#op(CommandOp.Spacing);
+  }
+
+  Dummy(size: ImVec2): void {
+    this.#op(CommandOp.Dummy);
+    this.#vec2(size);
+  }
+
+  Indent(indent_w: number = 0.0): void {
+    this.#op(CommandOp.Indent);
+    this.#float(indent_w);
+  }
+
+  Unindent(indent_w: number = 0.0): void {
+    this.#op(CommandOp.Unindent);
+    this.#float(indent_w);
+  }
 
-  /**
-   * The font loader and rasterizer to use for loading fonts. Can be one of the following:
-   *
-   * - `truetype` (stb_truetype) is the default option.
-   * - `freetype` (FreeType) is an alternative option which supports more features than `truetype`
-   * but this also loads an increased WASM file (+500kb).
-   *
-   * Default is `truetype`.
-   */
-  fontLoader?: "truetype" | "freetype";
+  PushID(str_id: string | ImStrHandle): void {
+    this.#op(CommandOp.PushID);
+    this.#str(str_id);
+  }
 
-  /**
-   * Whether to enable Dear ImGui extensions (imnodes, implot, ...).
-   */
-  extensions?: boolean;
+  PopID(): void {
+    this.#op(CommandOp.PopID);
+  }
 
-  /**
-   * Custom path to the emscripten loader script. If not provided, will be constructed
-   * automatically. If you use jsimgui via a package manager or CDN, you will most likely not
-   * need to worry about this.
-   */
-  loaderPath?: string;
-}
+  SetNextItemWidth(item_width: number): void {
+    this.#op(CommandOp.SetNextItemWidth);
+    this.#float(item_width);
+  }
 
-/**
- * This infers the backend to use for the given configuration.
- *
- * @param canvas The canvas element to infer the backend from.
- * @param device The WebGPU device to use. This overrides the backend to WebGPU.
- * @param backend The backend to use. This will explicitly use this backend.
- * @returns The backend to use.
- */
-const getUsedBackend = (
-  canvas: HTMLCanvasElement,
-  device?: GPUDevice,
-  backend?: "webgl" | "webgl2" | "webgpu",
-): "webgl" | "webgl2" | "webgpu" => {
-  if (backend) return backend;
-  if (device) return "webgpu";
+  PushStyleColor(idx: ImGuiCol, col: ImU32): void {
+    this.#op(CommandOp.PushStyleColor);
+    this.#int(idx);
+    this.#int(col);
+  }
 
-  const ctx =
-    canvas.getContext("webgl2") ||
-    canvas.getContext("webgl") ||
-    canvas.getContext("webgpu") ||
-    canvas.getContext("2d") ||
-    canvas.getContext("bitmaprenderer");
+  PopStyleColor(count: number = 1): void {
+    this.#op(CommandOp.PopStyleColor);
+    this.#int(count);
+  }
 
-  if (ctx instanceof WebGLRenderingContext) return "webgl";
-  if (ctx instanceof WebGL2RenderingContext) return "webgl2";
-  if (ctx instanceof GPUCanvasContext) return "webgpu";
+  IsItemHovered(flags: ImGuiHoveredFlags = 0): number {
+    const slot = this.#op(CommandOp.IsItemHovered, 1);
+    this.#int(flags);
+    return slot;
+  }
 
-  if (ctx instanceof CanvasRenderingContext2D) {
-    throw new Error("jsimgui: 2D canvas context is not supported.");
+  IsItemClicked(mouse_button: ImGuiMouseButton = 0): number {
+    const slot = this.#op(CommandOp.IsItemClicked, 1);
+    this.#int(mouse_button);
+    return slot;
   }
-  if (ctx instanceof ImageBitmapRenderingContext) {
-    throw new Error("jsimgui: ImageBitmapRenderingContext is not supported.");
+
+  BeginTable(
+    str_id: string | ImStrHandle,
+    columns: number,
+    flags: ImGuiTableFlags = 0,
+    outer_size: ImVec2 = new ImVec2(0.0, 0.0),
+    inner_width: number = 0.0,
+  ): number {
+    const slot = this.#op(CommandOp.BeginTable, 1);
+    this.#str(str_id);
+    this.#int(columns);
+    this.#int(flags);
+    this.#vec2(outer_size);
+    this.#float(inner_width);
+    return slot;
   }
 
-  return "webgl2";
-};
+  EndTable(): void {
+    this.#op(CommandOp.EndTable);
+  }
 
-/**
- * This initializes the WebGL/WebGL2 backend.
- *
- * @param canvas The canvas element to initialize the WebGL/WebGL2 backend on.
- */
-const initWebGL = (canvas: HTMLCanvasElement) => {
-  const ctx = canvas.getContext("webgl2") || canvas.getContext("webgl");
-  if (!ctx) {
-    throw new Error("jsimgui: Could not create WebGL/WebGL2 context.");
+  TableNextRow(row_flags: ImGuiTableRowFlags = 0, min_row_height: number = 0.0): void {
+    this.#op(CommandOp.TableNextRow);
+    this.#int(row_flags);
+    this.#float(min_row_height);
   }
 
-  const handle = Mod.export.GL.registerContext(
-    ctx,
-    ctx.getContextAttributes() as WebGLContextAttributes,
-  ) as number;
+  TableNextColumn(): number {
+    return this.#op(CommandOp.TableNextColumn, 1);
+  }
 
-  Mod.export.GL.makeContextCurrent(handle);
-  ImGuiImplOpenGL3.Init();
+  TableSetColumnIndex(column_n: number): number {
+    const slot = this.#op(CommandOp.TableSetColumnIndex, 1);
+    this.#int(column_n);
+    return slot;
+  }
 
-  State.beginRenderFn = () => {
-    ImGuiImplOpenGL3.NewFrame();
-  };
+  TableSetupColumn(
+    label: string | ImStrHandle,
+    flags: ImGuiTableColumnFlags = 0,
+    init_width_or_weight: number = 0.0,
+    user_id: ImGuiID = 0,
+  ): void {
+    this.#op(CommandOp.TableSetupColumn);
+    this.#str(label);
+    this.#int(flags);
+    this.#float(init_width_or_weight);
+    this.#int(user_id);
+  }
 
-  State.endRenderFn = () => {
-    ImGuiImplOpenGL3.RenderDrawData(ImGui.GetDrawData());
-  };
+  TableHeadersRow(): void {
+    this.#op(CommandOp.TableHeadersRow);
+  }
 
-  State.canvas = canvas;
-};
+  ProgressBar(
+    fraction: number,
+    size_arg: ImVec2 = new ImVec2(-Number.MIN_VALUE, 0),
+    overlay: string | ImStrHandle = "",
+  ): void {
+    this.#op(CommandOp.ProgressBar);
+    this.#float(fraction);
+    this.#vec2(size_arg);
+    this.#str(overlay);
+  }
 
-/**
- * This initializes the WebGPU backend.
- *
- * @param canvas The canvas element to initialize the WebGPU backend on.
- * @param device The WebGPU device to use.
- */
-const initWebGPU = (canvas: HTMLCanvasElement, device: GPUDevice | undefined) => {
-  if (!device) {
-    throw new Error("jsimgui: WebGPU device is not provided.");
+  BeginMenuBar(): number {
+    return this.#op(CommandOp.BeginMenuBar, 1);
   }
 
-  ImGuiImplWGPU.Init(device);
+  EndMenuBar(): void {
+    this.#op(CommandOp.EndMenuBar);
+  }
 
-  State.beginRenderFn = () => {
-    ImGuiImplWGPU.NewFrame();
-  };
+  BeginMenu(label: string | ImStrHandle, enabled: boolean = true): number {
+    const slot = this.#op(CommandOp.BeginMenu, 1);
+    this.#str(label);
+    this.#int(enabled ? 1 : 0);
+    return slot;
+  }
 
-  State.endRenderFn = (passEncoder?: GPURenderPassEncoder) => {
-    ImGuiImplWGPU.RenderDrawData(ImGui.GetDrawData(), passEncoder as GPURenderPassEncoder);
-  };
+  EndMenu(): void {
+    this.#op(CommandOp.EndMenu);
+  }
 
-  State.canvas = canvas;
-  State.device = device;
-};
+  MenuItem(
+    label: string | ImStrHandle,
+    shortcut: string | ImStrHandle = "",
+    selected: boolean = false,
+    enabled: boolean = true,
+  ): number {
+    const slot = this.#op(CommandOp.MenuItem, 1);
+    this.#str(label);
+    this.#str(shortcut);
+    this.#int(selected ? 1 : 0);
+    this.#int(enabled ? 1 : 0);
+    return slot;
+  }
+}
 
 /**
  * Object providing easy to use functions for initializing jsimgui as well as other things like
@@ -10313,6 +14081,17 @@ export const ImGuiImplWeb = {
     return Mod.export;
   },
 
+  /**
+   * Loads side modules of the split build (`build.ts --split`) after
+   * {@linkcode ImGuiImplWeb.Init}, e.g. the demo window only once it's opened. Does nothing for
+   * the other builds.
+   *
+   * @param modules The side modules to load.
+   */
+  async LoadModules(...modules: SideModule[]): Promise<void> {
+    await Mod.loadModules(modules);
+  },
+
   /**
    * Returns memory information of the WASM heap, mallinfo and stack.
    *
@@ -10323,9 +14102,155 @@ export const ImGuiImplWeb = {
       heap: Mod.export.get_wasm_heap_info(),
       mall: Mod.export.get_wasm_mall_info(),
       stack: Mod.export.get_wasm_stack_info(),
+      arena: Mod.export.get_wasm_arena_info(),
+      alloc: Mod.export.get_wasm_alloc_info(),
+    };
+  },
+
+  /**
+   * Returns the hottest bindings by cumulative time (or by calls while timing is disabled) since
+   * the last {@linkcode ImGuiImplWeb.ResetBindingStats}. The stats are only recorded by builds with
+   * instrumented bindings (`node build.ts --instrument`), otherwise the list is empty.
+   *
+   * @param count The number of bindings to return.
+   * @returns The bindings, hottest first.
+   */
+  GetBindingStats(count = 20): BindingStats[] {
+    return Mod.export.get_binding_stats(count);
+  },
+
+  /**
+   * Resets the call counts and times returned by {@linkcode ImGuiImplWeb.GetBindingStats}.
+   */
+  ResetBindingStats(): void {
+    Mod.export.reset_binding_stats();
+  },
+
+  /**
+   * Enables timing the instrumented bindings in addition to counting their calls. Disabled by
+   * default since reading the clock costs more than most bindings themselves.
+   *
+   * @param enabled Whether to time the bindings.
+   */
+  SetBindingTiming(enabled: boolean): void {
+    Mod.export.set_binding_timing(enabled);
+  },
+
+  /**
+   * Resets the high-water mark of the heap allocations reported by
+   * {@linkcode ImGuiImplWeb.GetMemoryInfo} to the bytes currently alive.
+   */
+  ResetMemoryPeak(): void {
+    Mod.export.reset_wasm_alloc_peak();
+  },
+
+  /**
+   * Returns the typed array access to the hot {@linkcode ImGuiIO} fields of the current context,
+   * see {@linkcode ImGuiIOFields}.
+   */
+  GetIOFields(): ImGuiIOFields {
+    const structs = ContextStructs.Current();
+    structs.ioFields ??= new ImGuiIOFields();
+    return structs.ioFields;
+  },
+
+  /**
+   * Returns views onto the vertex, index and command buffers of the draw data, for renderers
+   * uploading the Dear ImGui geometry themselves. Nothing is copied, so the views are only valid
+   * until the next frame or until the WASM memory grows.
+   *
+   * @param drawData The draw data, defaults to `ImGui.GetDrawData()`.
+   */
+  GetDrawDataView(drawData: ImDrawData = ImGui.GetDrawData()): ImDrawDataView {
+    const buffer = Mod.export.HEAPU8.buffer;
+    const ptr = Mod.export.get_draw_data_layout(drawData.ptr);
+    const layout = new Int32Array(buffer, ptr);
+    const floats = new Float32Array(buffer, ptr);
+
+    const count = layout[0];
+    const cmdLists: ImDrawListView[] = [];
+
+    for (let i = 0; i < count; i++) {
+      const o = 9 + i * 7;
+      const [vtxPtr, vtxCount, idxPtr, idxCount, cmdOffset, cmdCount, changed] = layout.subarray(
+        o,
+        o + 7,
+      );
+      const cmdEnd = cmdOffset + cmdCount * IMDRAWCMD_STRIDE;
+
+      cmdLists.push({
+        VtxBuffer: new Float32Array(buffer, vtxPtr, vtxCount * 5),
+        VtxBytes: new Uint8Array(buffer, vtxPtr, vtxCount * 20),
+        IdxBuffer: new Uint16Array(buffer, idxPtr, idxCount),
+        CmdBuffer: layout.subarray(cmdOffset, cmdEnd),
+        CmdFloats: floats.subarray(cmdOffset, cmdEnd),
+        Changed: changed !== 0,
+      });
+    }
+
+    return {
+      TotalVtxCount: layout[1],
+      TotalIdxCount: layout[2],
+      DisplayPos: new ImVec2(floats[3], floats[4]),
+      DisplaySize: new ImVec2(floats[5], floats[6]),
+      FramebufferScale: new ImVec2(floats[7], floats[8]),
+      CmdLists: cmdLists,
+    };
+  },
+
+  /**
+   * Like {@linkcode ImGuiImplWeb.GetDrawDataView}, but with all draw lists merged into one vertex
+   * and one index buffer, so the geometry of a frame is uploaded with a single call each. The
+   * buffers are copied natively into reused memory, the views are valid until the next call.
+   *
+   * @param drawData The draw data, defaults to `ImGui.GetDrawData()`.
+   */
+  GetMergedDrawDataView(drawData: ImDrawData = ImGui.GetDrawData()): ImMergedDrawDataView {
+    const buffer = Mod.export.HEAPU8.buffer;
+    const ptr = Mod.export.get_merged_draw_data(drawData.ptr);
+    const layout = new Int32Array(buffer, ptr);
+    const floats = new Float32Array(buffer, ptr);
+
+    const [vtxPtr, idxPtr, cmdCount] = layout.subarray(9, 12);
+    const cmdEnd = 12 + cmdCount * IMDRAWCMD_STRIDE;
+
+    return {
+      TotalVtxCount: layout[1],
+      TotalIdxCount: layout[2],
+      DisplayPos: new ImVec2(floats[3], floats[4]),
+      DisplaySize: new ImVec2(floats[5], floats[6]),
+      FramebufferScale: new ImVec2(floats[7], floats[8]),
+      VtxBuffer: new Float32Array(buffer, vtxPtr, layout[1] * 5),
+      VtxBytes: new Uint8Array(buffer, vtxPtr, layout[1] * 20),
+      IdxBuffer: new Uint16Array(buffer, idxPtr, layout[2]),
+      CmdBuffer: layout.subarray(12, cmdEnd),
+      CmdFloats: floats.subarray(12, cmdEnd),
+      Changed: Mod.export.draw_data_changed(),
     };
   },
 
+  /**
+   * Interns a string in the WASM heap and returns its handle. The native string lives as long as
+   * the module, so only intern constant strings like labels, not changing text.
+   *
+   * The handle can be passed to `ImGui` functions instead of the string, e.g.
+   * `ImGui.Button(handle)`, which skips the UTF-8 conversion and allocation of the string on every
+   * call. Functions taking several strings only skip the conversion if all of them are handles or
+   * keep their default value, mixed calls resolve the handles and pass strings.
+   *
+   * @param str The string to intern.
+   * @returns The handle of the interned string.
+   */
+  Intern(str: string): ImStrHandle {
+    let handle = State.internedStrings.get(str);
+    if (handle === undefined) {
+      handle = Mod.export.InternString(str) as number;
+      State.internedStrings.set(str, handle);
+      State.internedHandles[handle] = str;
+    }
+    return handle;
+  },
+
   /**
    * Set the callback for saving the Dear ImGui ini settings. The ini settings will be passed as
    * string to the callback.
@@ -10380,11 +14305,29 @@ export const ImGuiImplWeb = {
    * Begins a new ImGui frame. Call this at the beginning of your render loop.
    */
   BeginRender() {
-    setDisplayProperties(State.canvas as HTMLCanvasElement);
+    const io = ImGuiImplWeb.GetIOFields();
+
+    if (State.inputQueue) {
+      const [width, height] = State.inputQueue.getDisplaySize();
+      State.inputQueue.drain(State.inputRing as InputRingBuffer);
+      io.Set(IOField.DisplayWidth, width);
+      io.Set(IOField.DisplayHeight, height);
+
+      // The OffscreenCanvas isn't laid out, so it follows the size of its element.
+      const canvas = State.canvas as OffscreenCanvas;
+      if (canvas.width !== width || canvas.height !== height) {
+        canvas.width = width;
+        canvas.height = height;
+      }
+    } else if (State.canvas) {
+      setDisplayProperties(State.canvas as HTMLCanvasElement);
+    }
+
+    State.inputRing?.drain();
 
-    if (ImGui.GetIO().WantSaveIniSettings) {
+    if (io.Get(IOField.WantSaveIniSettings)) {
       State.saveIniSettingsFn?.(ImGui.SaveIniSettingsToMemory());
-      ImGui.GetIO().WantSaveIniSettings = false;
+      io.Set(IOField.WantSaveIniSettings, 0);
     }
 
     State.beginRenderFn?.();
@@ -10398,10 +14341,212 @@ export const ImGuiImplWeb = {
    * @param passEncoder The WebGPU render pass encoder to use.
    */
   EndRender(passEncoder?: GPURenderPassEncoder) {
+    State.inputQueue?.setFeedback(
+      ImGui.GetMouseCursor(),
+      ImGuiImplWeb.GetIOFields().Get(IOField.WantTextInput) !== 0,
+    );
     ImGui.Render();
     State.endRenderFn?.(passEncoder);
   },
 
+  /**
+   * Whether the draw data of the last {@linkcode ImGuiImplWeb.EndRender} differs from the last
+   * frame this was asked for (or a draw data view was taken). Always `true` unless
+   * {@linkcode InitOptions.diffDrawData} is enabled.
+   */
+  DrawDataChanged(): boolean {
+    return Mod.export.draw_data_changed();
+  },
+
+  /**
+   * Requests a new frame from the loop started with {@linkcode ImGuiImplWeb.RunLazy}. Call this
+   * when the state shown in the UI changed outside of Dear ImGui, e.g. after receiving new data.
+   */
+  Invalidate(): void {
+    State.wakeFn?.();
+  },
+
+  /**
+   * Runs a render loop which only renders frames while something happens. After a frame in which
+   * nothing changed and nothing animates, the loop sleeps until an input event arrives,
+   * {@linkcode ImGuiImplWeb.Invalidate} is called or `maxIdleMs` elapsed. This enables
+   * {@linkcode InitOptions.diffDrawData} to find such frames, every frame that runs still renders
+   * in full, so the frame callback may clear the canvas.
+   *
+   * ```js
+   * const stop = ImGuiImplWeb.RunLazy(() => {
+   *     ImGuiImplWeb.BeginRender();
+   *     ImGui.Text(`Time: ${Date.now()}`);
+   *     ImGuiImplWeb.EndRender();
+   * });
+   * ```
+   *
+   * @param frameFn The frame callback, calling {@linkcode ImGuiImplWeb.BeginRender} and
+   * {@linkcode ImGuiImplWeb.EndRender}.
+   * @param maxIdleMs The longest time without a frame, for UIs showing timers or polled data.
+   * @returns A function stopping the loop.
+   */
+  RunLazy(frameFn: () => void, maxIdleMs = 1000): () => void {
+    Mod.export.set_draw_data_diffing(true);
+
+    let stopped = false;
+    let scheduled = false;
+    let idleTimer: ReturnType<typeof setTimeout> | undefined;
+
+    const schedule = () => {
+      if (stopped || scheduled) return;
+
+      scheduled = true;
+      clearTimeout(idleTimer);
+      State.inputQueue?.markBusy();
+      requestAnimationFrame(frame);
+    };
+
+    const frame = () => {
+      scheduled = false;
+      if (stopped) return;
+
+      frameFn();
+
+      if (Mod.export.needs_redraw()) {
+        schedule();
+      } else if (State.inputQueue?.markIdle()) {
+        // Input arrived in the worker after this frame drained the queue.
+        schedule();
+      } else {
+        idleTimer = setTimeout(schedule, maxIdleMs);
+      }
+    };
+
+    State.wakeFn = schedule;
+    schedule();
+
+    return () => {
+      stopped = true;
+      clearTimeout(idleTimer);
+      if (State.wakeFn === schedule) State.wakeFn = null;
+    };
+  },
+
+  /**
+   * Moves Dear ImGui to a worker, so building the UI doesn't compete with the main thread. The
+   * canvas is transferred to the worker as `OffscreenCanvas`, while its input events stay on the
+   * main thread and are forwarded through an {@linkcode InputEventQueue} in shared memory. The
+   * worker calls {@linkcode ImGuiImplWeb.InitInWorker} and runs the frames.
+   *
+   * Shared memory requires the page to be cross-origin isolated (COOP/COEP headers).
+   *
+   * @example
+   * ```ts
+   * // main.js
+   * const worker = new Worker(new URL("./worker.js", import.meta.url), { type: "module" });
+   * const { stop } = ImGuiImplWeb.StartWorker(canvas, worker);
+   *
+   * // worker.js
+   * await ImGuiImplWeb.InitInWorker({ backend: "webgl2" });
+   * const frame = () => {
+   *     ImGuiImplWeb.BeginRender();
+   *     ImGui.Text("Hello from a worker");
+   *     ImGuiImplWeb.EndRender();
+   *     requestAnimationFrame(frame);
+   * };
+   * requestAnimationFrame(frame);
+   * ```
+   *
+   * @param canvas The canvas element to render Dear ImGui on.
+   * @param worker The worker running Dear ImGui.
+   * @param queueCapacity The number of input events the queue holds, a power of two.
+   * @returns The input queue, e.g. to check for dropped events, and a function removing the
+   * listeners of the main thread, e.g. before terminating the worker.
+   */
+  StartWorker(
+    canvas: HTMLCanvasElement,
+    worker: Worker,
+    queueCapacity = 1024,
+  ): { queue: InputEventQueue; stop: () => void } {
+    const queue = new InputEventQueue(queueCapacity);
+    const controller = new AbortController();
+    const { signal } = controller;
+
+    const wake = () => {
+      if (queue.claimWake()) worker.postMessage({ type: "jsimgui:wake" });
+    };
+
+    const resize = () => {
+      queue.setDisplaySize(Math.floor(canvas.clientWidth), Math.floor(canvas.clientHeight));
+      wake();
+    };
+    resize();
+    const resizeObserver = new ResizeObserver(resize);
+    resizeObserver.observe(canvas);
+
+    setupCanvasInput(canvas, queue, queue, wake, signal);
+
+    document.addEventListener(
+      "paste",
+      (e) => {
+        const text = e.clipboardData?.getData("text/plain") ?? "";
+        worker.postMessage({ type: "jsimgui:paste", text });
+      },
+      { signal },
+    );
+    worker.addEventListener(
+      "message",
+      (e) => {
+        if (e.data?.type === "jsimgui:copy") {
+          navigator.clipboard.writeText(e.data.text);
+        }
+      },
+      { signal },
+    );
+
+    const offscreen = canvas.transferControlToOffscreen();
+    worker.postMessage({ type: "jsimgui:init", canvas: offscreen, queue: queue.buffer }, [
+      offscreen,
+    ]);
+
+    const stop = () => {
+      controller.abort();
+      resizeObserver.disconnect();
+    };
+    return { queue, stop };
+  },
+
+  /**
+   * Initializes Dear ImGui in a worker started with {@linkcode ImGuiImplWeb.StartWorker}. Waits
+   * for the canvas and input queue from the main thread and then calls
+   * {@linkcode ImGuiImplWeb.Init}. Any loader runs in a worker, the input queue is shared on its
+   * own and doesn't need the pthreads loader (`build.ts --pthread`).
+   *
+   * @param options The initialization options, the canvas comes from the main thread.
+   */
+  async InitInWorker(options: Omit<InitOptions, "canvas"> = {}): Promise<void> {
+    const { canvas, queue } = await new Promise<{
+      canvas: OffscreenCanvas;
+      queue: SharedArrayBuffer;
+    }>((resolve) => {
+      const onInit = (e: MessageEvent) => {
+        if (e.data?.type !== "jsimgui:init") return;
+
+        globalThis.removeEventListener("message", onInit);
+        resolve(e.data);
+      };
+      globalThis.addEventListener("message", onInit);
+    });
+
+    globalThis.addEventListener("message", (e: MessageEvent) => {
+      if (e.data?.type === "jsimgui:wake") {
+        State.wakeFn?.();
+      } else if (e.data?.type === "jsimgui:paste") {
+        State.clipboardData = e.data.text;
+      }
+    });
+
+    State.inputQueue = new InputEventQueue(queue);
+
+    await ImGuiImplWeb.Init({ backend: "webgl2", ...options, canvas });
+  },
+
   /**
    * Initialize Dear ImGui with the specified configuration. This is asynchronous because it
    * waits for the WASM file to be loaded.
@@ -10416,23 +14561,70 @@ export const ImGuiImplWeb = {
       fontLoader = "truetype",
       loaderPath,
       extensions = false,
+      split = false,
+      wasm = false,
+      simd = false,
+      pthread = false,
+      wasmCache,
+      enableDemos = false,
+      diffDrawData = false,
+      displaySize = new ImVec2(1280, 720),
     } = options;
 
-    const usedBackend = getUsedBackend(canvas, device, backend);
+    if (!canvas && backend && backend !== "null") {
+      throw new Error(`jsimgui: The ${backend} backend requires a canvas.`);
+    }
+
+    const usedBackend = canvas ? getUsedBackend(canvas, device, backend) : "null";
     State.backend = usedBackend;
 
-    await Mod.init(fontLoader === "freetype", extensions, loaderPath);
+    const variant = {
+      freetype: fontLoader === "freetype",
+      extensions,
+      node: isNode(),
+      split,
+      wasm,
+      simd,
+      pthread,
+    };
+    await Mod.init(variant, loaderPath, wasmCache);
+
+    const modules: SideModule[] = [];
+    if (usedBackend === "webgl" || usedBackend === "webgl2") modules.push("opengl3");
+    if (usedBackend === "webgpu") modules.push("wgpu");
+    if (extensions) modules.push("imnodes");
+    if (enableDemos) modules.push("demo");
+    await Mod.loadModules(modules);
 
     Mod.export.FS.mount(Mod.export.MEMFS, { root: "." }, ".");
 
     ImGui.CreateContext();
-    setupBrowserIO(canvas);
+
+    if (State.inputQueue) {
+      setupWorkerIO();
+    } else if (canvas) {
+      setupBrowserIO(canvas as HTMLCanvasElement);
+    } else {
+      ImGui.GetIO().DisplaySize = displaySize;
+      Mod.export.SetupIniSettings();
+    }
+
+    Mod.export.set_draw_data_diffing(diffDrawData);
 
     if (State.loadIniSettingsFn) {
       const iniData = State.loadIniSettingsFn() || "";
       ImGui.LoadIniSettingsFromMemory(iniData, iniData.length);
     }
 
+    if (usedBackend === "null") {
+      initNull(canvas);
+      return;
+    }
+
+    if (!canvas) {
+      return;
+    }
+
     if (usedBackend === "webgl" || usedBackend === "webgl2") {
       initWebGL(canvas);
       return;
@@ -4,13 +4,26 @@ export const Mod = {
   // biome-ignore lint/suspicious/noExplicitAny: _
   export: null as any,
 
-  async init(enableFreeType: boolean, extensions: boolean, loaderPath?: string): Promise<void> {
+  async init(variant: LoaderVariant, loaderPath?: string, wasmCache?: string): Promise<void> {
     // biome-ignore lint/suspicious/noExplicitAny: _
     let MainExport: any;
 
+    const { freetype, extensions, node, split, wasm, pthread } = variant;
+    const simd = variant.simd && hasWasmSimd();
+    const name =
+      `loader${extensions && !split ? "-extensions" : ""}${freetype ? "-freetype" : ""}` +
+      `${split ? "-split" : ""}${simd ? "-simd" : ""}${pthread ? "-pthread" : ""}` +
+      `${wasm && !split && !node ? "-wasm" : ""}${node ? "-node" : ""}`;
+
+    Mod.split = split;
+    Mod.name = name;
+
     if (loaderPath) {
       MainExport = await import(loaderPath);
-    } else if (enableFreeType) {
+    } else if (node || split || wasm || simd || pthread) {
+      // Loaders with a separate .wasm file (`build.ts --node|--split|--wasm`), SIMD and pthreads.
+      MainExport = await import(`./${name}.js`);
+    } else if (freetype) {
       MainExport = extensions
         ? // @ts-expect-error
           await import("./loader-freetype-extensions.js")
@@ -24,10 +37,144 @@ export const Mod = {
           await import("./loader.js");
     }
 
-    Mod.export = await MainExport.default();
+    // biome-ignore lint/suspicious/noExplicitAny: _
+    const moduleArgs: any = {};
+
+    // Emscripten waits for `receiveInstance` forever, so a failed instantiation rejects this.
+    let rejectInit: (error: unknown) => void = () => {};
+    const initFailed = new Promise<never>((_, reject) => {
+      rejectInit = reject;
+    });
+
+    if (wasmCache && !node && "caches" in globalThis) {
+      const url = loaderPath
+        ? new URL(loaderPath.replace(/\.js$/, ".wasm"), location.href).href
+        : new URL(`./${name}.wasm`, import.meta.url).href;
+
+      // biome-ignore lint/suspicious/noExplicitAny: _
+      moduleArgs.instantiateWasm = (imports: any, receiveInstance: any) => {
+        instantiateCachedWasm(url, wasmCache, imports)
+          .then(({ instance, module }) => receiveInstance(instance, module))
+          .catch(rejectInit);
+        return {};
+      };
+    }
+
+    Mod.export = await Promise.race([MainExport.default(moduleArgs), initFailed]);
+    Mod.loadedModules.clear();
+
+    // The pool pointers and string handles belong to the previous module's heap.
+    HeapView.pool = { ptr: 0, size: 0, used: 0 };
+    HeapView.retired.length = 0;
+    HeapView.pending.length = 0;
+    State.internedStrings.clear();
+    State.internedHandles.length = 0;
+  },
+
+  /**
+   * Whether the loader is a split build (`build.ts --split`) with side modules.
+   */
+  split: false,
+
+  /**
+   * The file name of the loader without extension, e.g. `loader-split-simd`.
+   */
+  name: "",
+
+  loadedModules: new Set<SideModule>(),
+
+  /**
+   * Loads side modules of a split build which are not loaded yet. Does nothing for the other
+   * builds, which have everything linked in.
+   */
+  async loadModules(modules: SideModule[]): Promise<void> {
+    if (!Mod.split) return;
+
+    for (const module of modules) {
+      if (Mod.loadedModules.has(module)) continue;
+
+      // Side modules share the ABI flags of their main module, see `build.ts`.
+      const url = new URL(`./side/${Mod.name}/${module}.wasm`, import.meta.url).href;
+      await Mod.export.loadDynamicLibrary(url, { loadAsync: true, global: true, nodelete: true });
+      Mod.loadedModules.add(module);
+    }
   },
 };
 
+/**
+ * The build variant of the emscripten loader, see the `build.ts` options.
+ */
+export interface LoaderVariant {
+  freetype: boolean;
+  extensions: boolean;
+  node: boolean;
+  split: boolean;
+  wasm: boolean;
+  simd: boolean;
+  pthread: boolean;
+}
+
+/**
+ * Whether the engine supports WASM SIMD, by validating a module using a `v128` instruction.
+ */
+const hasWasmSimd = (): boolean => {
+  return WebAssembly.validate(
+    new Uint8Array([
+      0, 97, 115, 109, 1, 0, 0, 0, 1, 5, 1, 96, 0, 1, 123, 3, 2, 1, 0, 10, 10, 1, 8, 0, 65, 0,
+      253, 15, 253, 98, 11,
+    ]),
+  );
+};
+
+/**
+ * Fetches the WASM, throwing on an error status instead of handing the error page to the compiler.
+ */
+async function fetchWasm(url: string): Promise<Response> {
+  const response = await fetch(url);
+  if (!response.ok) {
+    throw new Error(`jsimgui: Failed to fetch ${url}: ${response.status} ${response.statusText}`);
+  }
+  return response;
+}
+
+/**
+ * Instantiates the WASM from the Cache Storage, fetching and storing it on the first load. The
+ * response is compiled with `instantiateStreaming`, which also lets the browser reuse its cached
+ * machine code for the same response on repeat startups.
+ *
+ * If that fails, e.g. because the server doesn't send `application/wasm` or the cached file is
+ * stale, the cache entry is dropped and the WASM is fetched again and compiled from an
+ * `ArrayBuffer`. Errors of that attempt are thrown.
+ */
+async function instantiateCachedWasm(
+  url: string,
+  cacheName: string,
+  // biome-ignore lint/suspicious/noExplicitAny: _
+  imports: any,
+): Promise<WebAssembly.WebAssemblyInstantiatedSource> {
+  const cache = await caches.open(cacheName);
+
+  try {
+    let response = await cache.match(url);
+    if (!response) {
+      response = await fetchWasm(url);
+      await cache.put(url, response.clone());
+    }
+
+    return await WebAssembly.instantiateStreaming(response, imports);
+  } catch {
+    await cache.delete(url);
+  }
+
+  const response = await fetchWasm(url);
+  return WebAssembly.instantiate(await response.arrayBuffer(), imports);
+}
+
+/**
+ * Side modules of the split build (`build.ts --split`).
+ */
+export type SideModule = "demo" | "opengl3" | "wgpu" | "imnodes";
+
 /**
  * Base class for value structs (passed by value, no native pointer).
  */
@@ -75,829 +222,3095 @@ export class ReferenceStruct {
   }
 }
 
-// MARKER: Generated ImGui bindings will be inserted here.
+/**
+ * Typed arrays which can be passed to primitive pointer parameters (e.g. `float[3]`).
+ */
+export type HeapViewType = Float32Array | Float64Array | Int32Array | Uint32Array;
 
-export const ImGuiImplOpenGL3 = {
-  Init(): boolean {
-    return Mod.export.cImGui_ImplOpenGL3_Init();
-  },
+/**
+ * Constructors of {@linkcode HeapViewType}.
+ */
+export type HeapViewConstructor =
+  | Float32ArrayConstructor
+  | Float64ArrayConstructor
+  | Int32ArrayConstructor
+  | Uint32ArrayConstructor;
 
-  Shutdown(): void {
-    Mod.export.cImGui_ImplOpenGL3_Shutdown();
-  },
+/**
+ * Typed array living in the WASM heap. Passing its {@linkcode HeapArray.view} to functions like
+ * `ImGui.SliderFloat3` or `ImGui.ColorEdit4` lets the native code read and write the values in
+ * place, without any copying.
+ */
+export class HeapArray<T extends HeapViewType = HeapViewType> {
+  /**
+   * The address of the first element in the WASM heap.
+   */
+  ptr = 0;
 
-  NewFrame(): void {
-    Mod.export.cImGui_ImplOpenGL3_NewFrame();
-  },
+  /**
+   * The number of elements.
+   */
+  length = 0;
 
-  RenderDrawData(draw_data: ImDrawData): void {
-    Mod.export.cImGui_ImplOpenGL3_RenderDrawData(draw_data.ptr);
-  },
-};
+  type: HeapViewConstructor = Float32Array;
 
-export function loadTextureWebGL(
-  glContext: WebGLRenderingContext | WebGL2RenderingContext,
-  data?: HTMLImageElement | Uint8Array,
-  options: TextureOptions = {},
-): ImTextureRef {
-  const gl = glContext;
+  #view: T | null = null;
 
-  const processTexture = () => {
-    const texture = gl.createTexture();
+  /**
+   * Allocate a new typed array in the WASM heap.
+   *
+   * @param type The typed array constructor, e.g. `Float32Array`.
+   * @param length The number of elements.
+   */
+  static New<T extends HeapViewType>(type: HeapViewConstructor, length: number): HeapArray<T> {
+    const arr = new HeapArray<T>();
+    arr.type = type;
+    arr.length = length;
+    arr.ptr = Mod.export.heap_alloc(length * type.BYTES_PER_ELEMENT);
+    return arr;
+  }
 
-    gl.bindTexture(gl.TEXTURE_2D, texture);
-    gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_MIN_FILTER, gl.NEAREST);
-    gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_MAG_FILTER, gl.NEAREST);
-    gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_WRAP_S, gl.CLAMP_TO_EDGE);
-    gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_WRAP_T, gl.CLAMP_TO_EDGE);
+  /**
+   * The typed array view onto the WASM heap. Access the view through this getter instead of
+   * keeping it around, since the view is detached whenever the WASM memory grows.
+   */
+  get view(): T {
+    if (this.#view?.buffer !== Mod.export.HEAPU8.buffer) {
+      this.#view = new this.type(Mod.export.HEAPU8.buffer, this.ptr, this.length) as T;
+    }
+    return this.#view as T;
+  }
 
-    if (!data) {
-      const data = new Uint8Array([0, 0, 0, 0]);
-      gl.texImage2D(gl.TEXTURE_2D, 0, gl.RGBA, 1, 1, 0, gl.RGBA, gl.UNSIGNED_BYTE, data);
+  /**
+   * Free the array's native allocated memory.
+   */
+  Drop(): void {
+    Mod.export.heap_free(this.ptr);
+    this.ptr = 0;
+    this.#view = null;
+  }
+}
+
+/**
+ * Passes typed arrays to the `_View` variants of the generated bindings. Views onto the WASM heap
+ * (see {@linkcode HeapArray}) are passed in place. Everything else is copied into a pooled scratch
+ * buffer and copied back in {@linkcode HeapView.Flush} after the call.
+ */
+export const HeapView = {
+  pool: { ptr: 0, size: 0, used: 0 },
+  retired: [] as number[],
+  pending: [] as [ArrayLike<number> & { [i: number]: number }, number, HeapViewConstructor][],
+
+  /**
+   * Reserve `size` bytes in the scratch pool, growing it if needed. A replaced pool is kept alive
+   * until {@linkcode HeapView.Flush}, since earlier arguments of the same call may still use it.
+   */
+  Reserve(size: number): number {
+    const pool = HeapView.pool;
+    const offset = (pool.used + 7) & ~7;
+
+    if (offset + size > pool.size) {
+      if (pool.ptr) HeapView.retired.push(pool.ptr);
+      pool.size = Math.max(pool.size * 2, size, 256);
+      pool.ptr = Mod.export.heap_alloc(pool.size);
+      pool.used = size;
+      return pool.ptr;
     }
 
-    if (data instanceof HTMLImageElement) {
-      gl.texImage2D(gl.TEXTURE_2D, 0, gl.RGBA, gl.RGBA, gl.UNSIGNED_BYTE, data);
+    pool.used = offset + size;
+    return pool.ptr + offset;
+  },
+
+  /**
+   * Returns the WASM heap address to pass for a primitive pointer parameter.
+   *
+   * @param value The typed array, array or null to pass.
+   * @param type The element type the native function expects.
+   * @param writeBack Whether the native function may write to the values.
+   * @param length The number of elements the native function accesses, e.g. 3 for `float[3]`.
+   */
+  In(
+    value: HeapViewType | number[] | null,
+    type: HeapViewConstructor,
+    writeBack = true,
+    length = 0,
+  ): number {
+    if (value === null) {
+      return 0;
     }
 
-    if (data instanceof Uint8Array) {
-      const width = options.width ?? 1;
-      const height = options.height ?? 1;
-      gl.texImage2D(gl.TEXTURE_2D, 0, gl.RGBA, width, height, 0, gl.RGBA, gl.UNSIGNED_BYTE, data);
+    if (value.length < length) {
+      throw new Error(`jsimgui: Expected at least ${length} values, got ${value.length}.`);
     }
 
-    return texture;
-  };
+    if (value instanceof type && value.buffer === Mod.export.HEAPU8.buffer) {
+      return value.byteOffset;
+    }
 
-  const texture = options.processFn
-    ? (options.processFn(data, options) as WebGLTexture)
-    : processTexture();
+    const ptr = HeapView.Reserve(value.length * type.BYTES_PER_ELEMENT);
+    new type(Mod.export.HEAPU8.buffer, ptr, value.length).set(value);
 
-  const id = Mod.export.GL.getNewId(Mod.export.GL.textures);
-  Mod.export.GL.textures[id] = texture;
+    if (writeBack) {
+      HeapView.pending.push([value, ptr, type]);
+    }
 
-  if (options.ref) {
-    options.ref._TexID = id;
-    return options.ref;
-  }
+    return ptr;
+  },
 
-  return new ImTextureRef(id);
-}
+  /**
+   * Copies pooled values back to their arrays and resets the scratch pool. Called after each
+   * `_View` binding call.
+   */
+  Flush(): void {
+    for (const [value, ptr, type] of HeapView.pending) {
+      const src = new type(Mod.export.HEAPU8.buffer, ptr, value.length);
+      for (let i = 0; i < src.length; i++) {
+        value[i] = src[i];
+      }
+    }
 
-export const ImGuiImplWGPU = {
-  Init(device: GPUDevice): boolean {
-    const handle = Mod.export.WebGPU.importJsDevice(device);
-    return Mod.export.cImGui_ImplWGPU_Init(handle);
-  },
+    for (const ptr of HeapView.retired) {
+      Mod.export.heap_free(ptr);
+    }
 
-  Shutdown(): void {
-    Mod.export.cImGui_ImplWGPU_Shutdown();
+    HeapView.pending.length = 0;
+    HeapView.retired.length = 0;
+    HeapView.pool.used = 0;
   },
 
-  NewFrame(): void {
-    Mod.export.cImGui_ImplWGPU_NewFrame();
-  },
+  /**
+   * Returns `view` if it still covers `length` elements at `ptr` of the current WASM memory,
+   * otherwise a new view. For views onto native results which usually stay in place, so they
+   * aren't recreated on every call but still follow memory growth.
+   *
+   * @param view The view returned last time.
+   * @param type The typed array constructor, e.g. `Uint32Array`.
+   * @param ptr The WASM heap address of the result.
+   * @param length The number of elements of the result.
+   */
+  Cached<T extends HeapViewType | Uint8Array>(
+    view: T,
+    type: new (buffer: ArrayBufferLike, byteOffset: number, length: number) => T,
+    ptr: number,
+    length: number,
+  ): T {
+    const buffer = Mod.export.HEAPU8.buffer;
+    if (view.buffer === buffer && view.byteOffset === ptr && view.length === length) {
+      return view;
+    }
 
-  RenderDrawData(draw_data: ImDrawData, pass_encoder: GPURenderPassEncoder): void {
-    const handle = Mod.export.WebGPU.importJsRenderPassEncoder(pass_encoder);
-    Mod.export.cImGui_ImplWGPU_RenderDrawData(draw_data.ptr, handle);
+    return new type(buffer, ptr, length);
   },
 };
 
-export function loadTextureWebGPU(
-  device: GPUDevice,
-  data?: HTMLImageElement | Uint8Array,
-  options: TextureOptions = {},
-): ImTextureRef {
-  const width = data instanceof HTMLImageElement ? data.width : (options.width ?? 1);
-  const height = data instanceof HTMLImageElement ? data.height : (options.height ?? 1);
+/**
+ * Types of {@linkcode ColumnTable} and {@linkcode TableSorter} columns.
+ */
+export const TableColumnType = {
+  /** Numbers from a `HeapArray<Float64Array>`, formatted like `%.3f`. */
+  Float64: 0,
+  /** Integers from a `HeapArray<Int32Array>`, formatted like `%d`. */
+  Int32: 1,
+  /** Indices from a `HeapArray<Int32Array>` into a string table. */
+  String: 2,
+} as const;
 
-  const processTexture = () => {
-    const texture = device.createTexture({
-      usage: 0x02 | 0x04 | 0x10,
-      dimension: "2d",
-      size: { width, height, depthOrArrayLayers: 1 },
-      format: "rgba8unorm",
-      mipLevelCount: 1,
-      sampleCount: 1,
-    });
+export type TableColumnType = (typeof TableColumnType)[keyof typeof TableColumnType];
 
-    if (!data) {
-      const data = new Uint8Array([0, 0, 0, 0]);
-      device.queue.writeTexture(
-        { texture, mipLevel: 0, origin: { x: 0, y: 0, z: 0 }, aspect: "all" },
-        data,
-        {},
-        { width, height, depthOrArrayLayers: 1 },
-      );
-    }
+/**
+ * Descriptor of a {@linkcode ColumnTable} column.
+ */
+export interface TableColumn {
+  /**
+   * The header label.
+   */
+  label: string;
 
-    if (data instanceof HTMLImageElement) {
-      device.queue.copyExternalImageToTexture(
-        { source: data },
-        { texture, mipLevel: 0, origin: { x: 0, y: 0, z: 0 }, aspect: "all" },
-        { width: data.width, height: data.height, depthOrArrayLayers: 1 },
-      );
-    }
+  /**
+   * The type of the values.
+   */
+  type: TableColumnType;
 
-    if (data instanceof Uint8Array) {
-      device.queue.writeTexture(
-        { texture, mipLevel: 0, origin: { x: 0, y: 0, z: 0 }, aspect: "all" },
-        data.buffer,
-        {},
-        { width, height, depthOrArrayLayers: 1 },
-      );
-    }
+  /**
+   * The printf format of numeric cells, with exactly one conversion matching the type. Default is
+   * `%.3f` for `Float64` and `%d` for `Int32`.
+   */
+  format?: string;
 
-    const textureView = texture.createView({
-      format: "rgba8unorm",
-      dimension: "2d",
-      baseMipLevel: 0,
-      mipLevelCount: 1,
-      baseArrayLayer: 0,
-      arrayLayerCount: 1,
-      aspect: "all",
-    });
+  /**
+   * The fixed width in pixels (with `ImGui.TableColumnFlags.WidthFixed`) or stretch weight.
+   */
+  width?: number;
 
-    return [texture, textureView];
-  };
+  /**
+   * The `ImGui.TableColumnFlags` of the column.
+   */
+  flags?: ImGuiTableColumnFlags;
+}
 
-  const [texture, textureView] = options.processFn
-    ? (options.processFn(data, options) as [GPUTexture, GPUTextureView])
-    : processTexture();
+/**
+ * Table rendered natively from columns in the WASM heap. One {@linkcode ColumnTable.Render} call
+ * clips the rows and formats and draws every visible cell in C++, instead of a `TableNextRow`,
+ * `TableSetColumnIndex` and `Text` call plus a string per cell from JS.
+ *
+ * The table only keeps the addresses of the column arrays, keep them alive while it is rendered.
+ * With `ImGui.TableFlags.Sortable`, the rows are shown sorted by the table's sort specs, see
+ * {@linkcode TableSorter}.
+ *
+ * @example
+ * ```ts
+ * const prices = HeapArray.New<Float64Array>(Float64Array, 100_000);
+ * const table = ColumnTable.New([
+ *     { label: "Price", type: TableColumnType.Float64, format: "%.2f" },
+ * ]);
+ * table.SetColumn(0, prices);
+ * table.Rows = prices.length;
+ *
+ * // Every frame:
+ * table.Render("prices");
+ * ```
+ */
+export class ColumnTable extends ReferenceStruct {
+  /**
+   * Allocate a new table.
+   *
+   * @param columns The column descriptors.
+   */
+  static New(columns: TableColumn[]): ColumnTable {
+    const obj = new ColumnTable();
+    obj.ptr = new Mod.export.ColumnTable();
+
+    for (const column of columns) {
+      const format = column.format ?? (column.type === TableColumnType.Float64 ? "%.3f" : "%d");
+      const added = obj.ptr.AddColumn(
+        column.label,
+        column.type,
+        format,
+        column.flags ?? 0,
+        column.width ?? 0,
+      );
 
-  Mod.export.WebGPU.importJsTexture(texture);
-  const id = Mod.export.WebGPU.importJsTextureView(textureView);
+      if (!added) {
+        obj.Drop();
+        throw new Error(`jsimgui: Invalid format "${format}" for table column "${column.label}".`);
+      }
+    }
 
-  if (options.ref) {
-    options.ref._TexID = id;
-    return options.ref;
+    return obj;
   }
 
-  return new ImTextureRef(id);
-}
+  /**
+   * The number of rows. Columns shorter than this leave their remaining cells empty.
+   */
+  get Rows(): number {
+    return this.ptr.get_Rows();
+  }
+  set Rows(v: number) {
+    this.ptr.set_Rows(v);
+  }
 
-/**
- * Map of browser mouse button values to ImGui mouse button enums.
+  /**
+   * Whether to sort on another thread, see {@linkcode TableSorter.Async}.
+   */
+  set Async(v: boolean) {
+    this.ptr.set_Async(v);
+  }
+
+  /**
+   * Point a numeric column at its values.
+   *
+   * @param column The column index.
+   * @param values The values, a `Float64Array` or `Int32Array` array matching the column type.
+   */
+  SetColumn(column: number, values: HeapArray<Float64Array> | HeapArray<Int32Array>): void {
+    const type = values.type === Float64Array ? TableColumnType.Float64 : TableColumnType.Int32;
+    if (!this.ptr.SetColumnData(column, type, values.ptr, values.length)) {
+      throw new Error(`jsimgui: Table column ${column} doesn't take ${values.type.name} values.`);
+    }
+  }
+
+  /**
+   * Sort the rows again on the next render, after the column values were changed in place.
+   */
+  Invalidate(): void {
+    this.ptr.Invalidate();
+  }
+
+  /**
+   * Point a string column at its indices into a string table, which is copied into the WASM heap.
+   * Indices outside of the table leave the cell empty.
+   *
+   * @param column The column index.
+   * @param indices The index into `table` of each row.
+   * @param table The strings.
+   */
+  SetStringColumn(column: number, indices: HeapArray<Int32Array>, table: string[]): void {
+    const set =
+      indices.type === Int32Array &&
+      this.ptr.SetColumnData(column, TableColumnType.String, indices.ptr, indices.length) &&
+      this.ptr.SetStringTable(column, table);
+
+    if (!set) {
+      throw new Error(`jsimgui: Table column ${column} isn't a string column.`);
+    }
+  }
+
+  /**
+   * Render the table with a frozen header row, drawing only the visible rows. Sortable tables
+   * sort the rows when their sort specs change.
+   *
+   * @param id The table ID.
+   * @param flags The `ImGui.TableFlags`, scrolling by default.
+   * @param outerSize The outer size of the table, fills the window by default.
+   * @returns Whether the table is visible.
+   */
+  Render(
+    id: string,
+    flags: ImGuiTableFlags = ImGui.TableFlags.ScrollY |
+      ImGui.TableFlags.RowBg |
+      ImGui.TableFlags.BordersV |
+      ImGui.TableFlags.Resizable,
+    outerSize: ImVec2 = new ImVec2(0, 0),
+  ): boolean {
+    return this.ptr.Render(id, flags, outerSize);
+  }
+}
+
+/**
+ * Sorts the rows of a table natively by its `ImGuiTableSortSpecs`, for tables rendered from JS
+ * ({@linkcode ColumnTable} sorts by itself). The columns are typed arrays in the WASM heap,
+ * indexed like the table columns. {@linkcode TableSorter.Sort} returns the row permutation of a
+ * stable multi-key merge sort, which is cached until the specs change or are marked dirty.
+ *
+ * @example
+ * ```ts
+ * const sorter = TableSorter.New();
+ * sorter.SetColumn(0, ids);
+ * sorter.SetColumn(1, prices);
+ * sorter.Rows = ids.length;
+ *
+ * // Every frame, after the table columns are set up:
+ * const order = sorter.Sort();
+ * clipper.Begin(order.length);
+ * while (clipper.Step()) {
+ *     for (let i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+ *         const row = order[i];
+ *         // ...
+ *     }
+ * }
+ * ```
+ */
+export class TableSorter extends ReferenceStruct {
+  #view = new Uint32Array(0);
+
+  /**
+   * Allocate a new sorter.
+   */
+  static New(): TableSorter {
+    const obj = new TableSorter();
+    obj.ptr = new Mod.export.TableSorter();
+    return obj;
+  }
+
+  /**
+   * The number of rows. Rows past the end of a column sort last.
+   */
+  get Rows(): number {
+    return this.ptr.get_Rows();
+  }
+  set Rows(v: number) {
+    this.ptr.set_Rows(v);
+  }
+
+  /**
+   * Whether to sort on another thread, only with the pthreads loader (`build.ts --pthread`).
+   * {@linkcode TableSorter.Sort} then keeps returning the previous order until the sort is done.
+   * The sorted columns are copied when the sort starts, so they can be changed or dropped while
+   * {@linkcode TableSorter.Busy}.
+   */
+  get Async(): boolean {
+    return this.ptr.get_Async();
+  }
+  set Async(v: boolean) {
+    this.ptr.set_Async(v);
+  }
+
+  /**
+   * Whether an async sort is still running.
+   */
+  get Busy(): boolean {
+    return this.ptr.get_Busy();
+  }
+
+  /**
+   * Point a numeric column at its values.
+   *
+   * @param column The table column index.
+   * @param values The values.
+   */
+  SetColumn(column: number, values: HeapArray<Float64Array> | HeapArray<Int32Array>): void {
+    const type = values.type === Float64Array ? TableColumnType.Float64 : TableColumnType.Int32;
+    if (!this.ptr.SetColumnData(column, type, values.ptr, values.length)) {
+      throw new Error(`jsimgui: Invalid table column ${column}.`);
+    }
+  }
+
+  /**
+   * Point a string column at its indices into a string table, which is copied into the WASM heap.
+   * Rows are sorted by their strings, indices outside of the table sort last.
+   *
+   * @param column The table column index.
+   * @param indices The index into `table` of each row.
+   * @param table The strings.
+   */
+  SetStringColumn(column: number, indices: HeapArray<Int32Array>, table: string[]): void {
+    const set =
+      this.ptr.SetColumnData(column, TableColumnType.String, indices.ptr, indices.length) &&
+      this.ptr.SetStringTable(column, table);
+
+    if (!set) {
+      throw new Error(`jsimgui: Invalid table column ${column}.`);
+    }
+  }
+
+  /**
+   * Sort again on the next {@linkcode TableSorter.Sort}, after the column values were changed in
+   * place.
+   */
+  Invalidate(): void {
+    this.ptr.Invalidate();
+  }
+
+  /**
+   * Returns the row permutation for the sort specs, sorting only if they changed, and clears
+   * their `SpecsDirty`. Without sort specs the rows keep their order.
+   *
+   * The returned view onto the WASM heap is valid until the next call.
+   *
+   * @param specs The sort specs, defaults to those of the current table.
+   */
+  Sort(specs: ImGuiTableSortSpecs = ImGui.TableGetSortSpecs()): Uint32Array {
+    const ptr = this.ptr.Sort(specs?.ptr ?? null);
+    const length = this.ptr.get_Rows();
+
+    this.#view = HeapView.Cached(this.#view, Uint32Array, ptr, length);
+    return this.#view;
+  }
+}
+
+/**
+ * Filters a list of strings natively with the `ImGuiTextFilter` syntax: comma separated terms,
+ * a leading `-` excludes, matching is case-insensitive for ASCII. The strings are loaded once as a
+ * packed UTF-8 pool, each filter change scans it (vectorized in the SIMD build) instead of calling
+ * `String.includes` per item in JS.
+ *
+ * @example
+ * ```ts
+ * const index = TextFilterIndex.New();
+ * index.Load(items);
+ *
+ * // Every frame:
+ * ImGui.InputText("Filter", filter, 256);
+ * const matches = index.Filter(filter[0]);
+ * clipper.Begin(matches.length);
+ * while (clipper.Step()) {
+ *     for (let i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+ *         ImGui.Text(items[matches[i]]);
+ *     }
+ * }
+ * ```
+ */
+export class TextFilterIndex extends ReferenceStruct {
+  #view = new Uint32Array(0);
+
+  /**
+   * Allocate a new filter index.
+   */
+  static New(): TextFilterIndex {
+    const obj = new TextFilterIndex();
+    obj.ptr = new Mod.export.TextFilterIndex();
+    return obj;
+  }
+
+  /**
+   * The number of loaded strings.
+   */
+  get Count(): number {
+    return this.ptr.get_Count();
+  }
+
+  /**
+   * Load the strings to filter, replacing the previous ones. They are UTF-8 encoded straight into
+   * the WASM heap and copied into the index.
+   *
+   * @param items The strings.
+   */
+  Load(items: string[]): void {
+    // UTF-16 code units take at most 3 bytes in UTF-8.
+    const capacity = items.reduce((sum, item) => sum + item.length * 3, 0);
+    const data = Mod.export.heap_alloc(Math.max(capacity, 1));
+    const offsets = HeapArray.New<Uint32Array>(Uint32Array, items.length + 1);
+
+    try {
+      const encoder = new TextEncoder();
+      const pool = new Uint8Array(Mod.export.HEAPU8.buffer, data, capacity);
+      const starts = offsets.view;
+
+      let end = 0;
+      for (let i = 0; i < items.length; i++) {
+        starts[i] = end;
+        end += encoder.encodeInto(items[i], pool.subarray(end)).written;
+      }
+      starts[items.length] = end;
+
+      if (!this.ptr.Load(data, offsets.ptr, items.length)) {
+        throw new Error("jsimgui: Failed to load the text filter index.");
+      }
+    } finally {
+      Mod.export.heap_free(data);
+      offsets.Drop();
+    }
+  }
+
+  /**
+   * Returns the indices of the strings passing the filter, scanning only when the filter changed
+   * since the last call.
+   *
+   * The returned view onto the WASM heap is valid until the next call.
+   *
+   * @param filter The filter, e.g. `"apple,-pie"`.
+   */
+  Filter(filter: string): Uint32Array {
+    const ptr = this.ptr.Apply(filter);
+    const length = this.ptr.get_MatchCount();
+
+    this.#view = HeapView.Cached(this.#view, Uint32Array, ptr, length);
+    return this.#view;
+  }
+}
+
+/**
+ * Dear ImGui's text filter ("aaa,-bbb": comma separated terms, a leading `-` excludes), for
+ * filtering in JS item by item. Prefer {@linkcode TextFilterIndex} for long lists.
+ *
+ * @example
+ * ```ts
+ * const filter = ImGuiTextFilter.New();
+ *
+ * // Every frame:
+ * filter.Draw();
+ * for (const item of items) {
+ *     if (filter.PassFilter(item)) ImGui.Text(item);
+ * }
+ * ```
+ */
+export class ImGuiTextFilter extends ReferenceStruct {
+  /**
+   * Allocate a new text filter.
+   *
+   * @param filter The initial filter text.
+   */
+  static New(filter = ""): ImGuiTextFilter {
+    const obj = new ImGuiTextFilter();
+    obj.ptr = new Mod.export.ImGuiTextFilter(filter);
+    return obj;
+  }
+
+  /**
+   * The filter text, parsed again when set. Longer text than 255 bytes is truncated.
+   */
+  get InputBuf(): string {
+    return this.ptr.get_InputBuf();
+  }
+  set InputBuf(v: string) {
+    this.ptr.Set(v);
+  }
+
+  /**
+   * Draw an input text editing the filter.
+   *
+   * @param label The label.
+   * @param width The width, `0` for the default item width.
+   * @returns Whether the filter changed.
+   */
+  Draw(label = "Filter (inc,-exc)", width = 0): boolean {
+    return this.ptr.Draw(label, width);
+  }
+
+  /**
+   * Whether the filter has any term.
+   */
+  IsActive(): boolean {
+    return this.ptr.IsActive();
+  }
+
+  /**
+   * Whether the text passes the filter.
+   *
+   * @param text The text.
+   */
+  PassFilter(text: string): boolean {
+    return this.ptr.PassFilter(text);
+  }
+}
+
+/**
+ * Append-only log console living in the WASM heap. Appended text is UTF-8 encoded straight into
+ * the native buffer, which indexes the line starts and evicts the oldest lines over its limits.
+ * `Render` draws only the visible lines through an `ImGuiListClipper` in a single call, so neither
+ * appending nor drawing creates a JS string per line.
+ *
+ * @example
+ * ```ts
+ * const log = LogBuffer.New();
+ * worker.onmessage = (event) => log.Append(event.data); // Batches of "\n" terminated lines.
+ *
+ * // Every frame:
+ * ImGui.Begin("Log");
+ * log.Render("lines");
+ * ImGui.End();
+ * ```
+ */
+export class LogBuffer extends ReferenceStruct {
+  static #encoder = new TextEncoder();
+
+  /**
+   * Allocate a new log.
+   *
+   * @param maxLines The number of lines kept before the oldest ones are evicted.
+   * @param maxBytes The number of bytes kept before the oldest lines are evicted.
+   */
+  static New(maxLines = 100_000, maxBytes = 16 * 1024 * 1024): LogBuffer {
+    const obj = new LogBuffer();
+    obj.ptr = new Mod.export.LogBuffer(maxLines, maxBytes);
+    return obj;
+  }
+
+  /**
+   * The number of lines, not counting an empty last line after a trailing newline.
+   */
+  get LineCount(): number {
+    return this.ptr.get_LineCount();
+  }
+
+  /**
+   * The number of bytes of the kept lines.
+   */
+  get ByteCount(): number {
+    return this.ptr.get_ByteCount();
+  }
+
+  /**
+   * The text of a kept line without its line ending.
+   *
+   * @param index The line, `0` being the oldest kept one.
+   */
+  Line(index: number): string {
+    if (!Number.isInteger(index) || index < 0 || index >= this.LineCount) {
+      throw new Error(`jsimgui: Invalid log line ${index}.`);
+    }
+
+    return this.ptr.GetLine(index);
+  }
+
+  /**
+   * Append text, split into lines at `\n`. Text not ending in a newline is continued by the next
+   * append, until the line exceeds `maxBytes` and is split. Batch many lines into one call, each
+   * call crosses into WASM twice.
+   *
+   * @param text The text, or its UTF-8 bytes.
+   */
+  Append(text: string | Uint8Array): void {
+    if (typeof text === "string") {
+      // UTF-16 code units take at most 3 bytes in UTF-8.
+      const capacity = text.length * 3;
+      const ptr = this.ptr.Reserve(capacity);
+      const dest = Mod.export.HEAPU8.subarray(ptr, ptr + capacity);
+      this.ptr.Commit(LogBuffer.#encoder.encodeInto(text, dest).written);
+    } else {
+      const ptr = this.ptr.Reserve(text.length);
+      Mod.export.HEAPU8.set(text, ptr);
+      this.ptr.Commit(text.length);
+    }
+  }
+
+  /**
+   * Remove all lines.
+   */
+  Clear(): void {
+    this.ptr.Clear();
+  }
+
+  /**
+   * Draw the lines in a child window.
+   *
+   * @param id The child window id.
+   * @param size The child window size, `(0, 0)` fills the remaining space.
+   * @param autoScroll Keep the view at the newest line while it is scrolled to the bottom.
+   */
+  Render(id: string, size: ImVec2 = new ImVec2(0, 0), autoScroll = true): void {
+    this.ptr.Render(id, size, autoScroll);
+  }
+}
+
+/**
+ * Text buffer living in the WASM heap across frames for `ImGui.InputText`,
+ * `ImGui.InputTextMultiline` and `ImGui.InputTextWithHint`. It grows as the text does and, unlike
+ * a `[string]` buffer, isn't copied from and back to JS every frame. The text is only decoded when
+ * read after an edit.
+ *
+ * @example
+ * ```ts
+ * const config = TextBuffer.New(await file.text());
+ *
+ * // Every frame:
+ * if (ImGui.InputTextMultiline("##config", config, 0, new ImVec2(-1, -1))) {
+ *     validate(config.Text);
+ * }
+ * ```
+ */
+export class TextBuffer extends ReferenceStruct {
+  static #decoder = new TextDecoder();
+  #view = new Uint8Array(0);
+  #text = "";
+  #textVersion = 0;
+
+  /**
+   * Allocate a new text buffer.
+   *
+   * @param text The initial text.
+   */
+  static New(text = ""): TextBuffer {
+    const obj = new TextBuffer();
+    obj.ptr = new Mod.export.TextBuffer();
+    if (text) obj.Text = text;
+    return obj;
+  }
+
+  /**
+   * Incremented whenever the text changes, compare it to detect edits without reading the text.
+   */
+  get Version(): number {
+    return this.ptr.get_Version();
+  }
+
+  /**
+   * The length of the text in UTF-8 bytes.
+   */
+  get Length(): number {
+    return this.ptr.get_Length();
+  }
+
+  /**
+   * The UTF-8 text without a terminator, a view onto the WASM heap valid until the next edit.
+   */
+  get Bytes(): Uint8Array {
+    const ptr = this.ptr.get_Data();
+    const length = this.ptr.get_Length();
+
+    this.#view = HeapView.Cached(this.#view, Uint8Array, ptr, length);
+    return this.#view;
+  }
+
+  /**
+   * The text, decoded only if it changed since the last read.
+   */
+  get Text(): string {
+    const version = this.Version;
+    if (version !== this.#textVersion) {
+      const bytes = this.Bytes;
+      // TextDecoder rejects views onto a SharedArrayBuffer, decode a copy in pthread builds.
+      const source = bytes.buffer instanceof ArrayBuffer ? bytes : bytes.slice();
+      this.#text = TextBuffer.#decoder.decode(source);
+      this.#textVersion = version;
+    }
+
+    return this.#text;
+  }
+
+  set Text(text: string) {
+    this.ptr.Set(text);
+    this.#text = text;
+    this.#textVersion = this.Version;
+  }
+}
+
+/**
+ * Fixed capacity ring buffer of plot samples living in the WASM heap. Pass it to
+ * `ImGui.PlotLines`/`ImGui.PlotHistogram` instead of an array, so only newly pushed samples
+ * cross into WASM instead of the whole history every frame.
+ */
+export class PlotRingBuffer extends ReferenceStruct {
+  /**
+   * Allocate a new ring buffer.
+   *
+   * @param capacity The maximum number of samples kept, older samples are overwritten.
+   */
+  static New(capacity: number): PlotRingBuffer {
+    const obj = new PlotRingBuffer();
+    obj.ptr = new Mod.export.PlotRingBuffer(capacity);
+    return obj;
+  }
+
+  /**
+   * The number of samples currently stored.
+   */
+  get Size(): number {
+    return this.ptr.get_Size();
+  }
+
+  /**
+   * The maximum number of samples stored.
+   */
+  get Capacity(): number {
+    return this.ptr.get_Capacity();
+  }
+
+  /**
+   * Append samples, overwriting the oldest ones once the buffer is full.
+   *
+   * @param values The new samples.
+   */
+  Push(values: Float32Array | number[]): void {
+    this.ptr.Push(HeapView.In(values, Float32Array, false), values.length);
+    HeapView.Flush();
+  }
+
+  /**
+   * Remove all samples.
+   */
+  Clear(): void {
+    this.ptr.Clear();
+  }
+}
+
+// MARKER: Generated ImGui bindings will be inserted here.
+
+export const ImGuiImplOpenGL3 = {
+  Init(): boolean {
+    return Mod.export.cImGui_ImplOpenGL3_Init();
+  },
+
+  Shutdown(): void {
+    Mod.export.cImGui_ImplOpenGL3_Shutdown();
+  },
+
+  NewFrame(): void {
+    Mod.export.cImGui_ImplOpenGL3_NewFrame();
+  },
+
+  RenderDrawData(draw_data: ImDrawData): void {
+    Mod.export.cImGui_ImplOpenGL3_RenderDrawData(draw_data.ptr);
+  },
+};
+
+export function loadTextureWebGL(
+  glContext: WebGLRenderingContext | WebGL2RenderingContext,
+  data?: HTMLImageElement | Uint8Array,
+  options: TextureOptions = {},
+): ImTextureRef {
+  const gl = glContext;
+
+  const processTexture = () => {
+    const texture = gl.createTexture();
+
+    gl.bindTexture(gl.TEXTURE_2D, texture);
+    gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_MIN_FILTER, gl.NEAREST);
+    gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_MAG_FILTER, gl.NEAREST);
+    gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_WRAP_S, gl.CLAMP_TO_EDGE);
+    gl.texParameteri(gl.TEXTURE_2D, gl.TEXTURE_WRAP_T, gl.CLAMP_TO_EDGE);
+
+    if (!data) {
+      const data = new Uint8Array([0, 0, 0, 0]);
+      gl.texImage2D(gl.TEXTURE_2D, 0, gl.RGBA, 1, 1, 0, gl.RGBA, gl.UNSIGNED_BYTE, data);
+    }
+
+    if (data instanceof HTMLImageElement) {
+      gl.texImage2D(gl.TEXTURE_2D, 0, gl.RGBA, gl.RGBA, gl.UNSIGNED_BYTE, data);
+    }
+
+    if (data instanceof Uint8Array) {
+      const width = options.width ?? 1;
+      const height = options.height ?? 1;
+      gl.texImage2D(gl.TEXTURE_2D, 0, gl.RGBA, width, height, 0, gl.RGBA, gl.UNSIGNED_BYTE, data);
+    }
+
+    return texture;
+  };
+
+  const texture = options.processFn
+    ? (options.processFn(data, options) as WebGLTexture)
+    : processTexture();
+
+  const id = Mod.export.GL.getNewId(Mod.export.GL.textures);
+  Mod.export.GL.textures[id] = texture;
+
+  if (options.ref) {
+    options.ref._TexID = id;
+    return options.ref;
+  }
+
+  return new ImTextureRef(id);
+}
+
+export const ImGuiImplWGPU = {
+  Init(device: GPUDevice): boolean {
+    const handle = Mod.export.WebGPU.importJsDevice(device);
+    return Mod.export.cImGui_ImplWGPU_Init(handle);
+  },
+
+  Shutdown(): void {
+    Mod.export.cImGui_ImplWGPU_Shutdown();
+  },
+
+  NewFrame(): void {
+    Mod.export.cImGui_ImplWGPU_NewFrame();
+  },
+
+  RenderDrawData(draw_data: ImDrawData, pass_encoder: GPURenderPassEncoder): void {
+    const handle = Mod.export.WebGPU.importJsRenderPassEncoder(pass_encoder);
+    Mod.export.cImGui_ImplWGPU_RenderDrawData(draw_data.ptr, handle);
+  },
+};
+
+/**
+ * Totals counted by {@linkcode ImGuiImplNull} since the last reset.
+ */
+export interface NullRenderStats {
+  frames: number;
+  vertices: number;
+  indices: number;
+  drawCalls: number;
+
+  /**
+   * Draw commands referencing indices, vertices or textures which don't exist.
+   */
+  errors: number;
+}
+
+/**
+ * Renderer backend which doesn't draw anything. It validates the draw data and counts the
+ * vertices, indices and draw calls instead, for measuring the CPU cost of frames without a GPU.
+ */
+export const ImGuiImplNull = {
+  Init(): boolean {
+    return Mod.export.cImGui_ImplNull_Init();
+  },
+
+  Shutdown(): void {
+    Mod.export.cImGui_ImplNull_Shutdown();
+  },
+
+  NewFrame(): void {
+    Mod.export.cImGui_ImplNull_NewFrame();
+  },
+
+  RenderDrawData(draw_data: ImDrawData): void {
+    Mod.export.cImGui_ImplNull_RenderDrawData(draw_data.ptr);
+  },
+
+  GetStats(): NullRenderStats {
+    return Mod.export.cImGui_ImplNull_GetStats();
+  },
+
+  ResetStats(): void {
+    Mod.export.cImGui_ImplNull_ResetStats();
+  },
+};
+
+export function loadTextureWebGPU(
+  device: GPUDevice,
+  data?: HTMLImageElement | Uint8Array,
+  options: TextureOptions = {},
+): ImTextureRef {
+  const width = data instanceof HTMLImageElement ? data.width : (options.width ?? 1);
+  const height = data instanceof HTMLImageElement ? data.height : (options.height ?? 1);
+
+  const processTexture = () => {
+    const texture = device.createTexture({
+      usage: 0x02 | 0x04 | 0x10,
+      dimension: "2d",
+      size: { width, height, depthOrArrayLayers: 1 },
+      format: "rgba8unorm",
+      mipLevelCount: 1,
+      sampleCount: 1,
+    });
+
+    if (!data) {
+      const data = new Uint8Array([0, 0, 0, 0]);
+      device.queue.writeTexture(
+        { texture, mipLevel: 0, origin: { x: 0, y: 0, z: 0 }, aspect: "all" },
+        data,
+        {},
+        { width, height, depthOrArrayLayers: 1 },
+      );
+    }
+
+    if (data instanceof HTMLImageElement) {
+      device.queue.copyExternalImageToTexture(
+        { source: data },
+        { texture, mipLevel: 0, origin: { x: 0, y: 0, z: 0 }, aspect: "all" },
+        { width: data.width, height: data.height, depthOrArrayLayers: 1 },
+      );
+    }
+
+    if (data instanceof Uint8Array) {
+      device.queue.writeTexture(
+        { texture, mipLevel: 0, origin: { x: 0, y: 0, z: 0 }, aspect: "all" },
+        data.buffer,
+        {},
+        { width, height, depthOrArrayLayers: 1 },
+      );
+    }
+
+    const textureView = texture.createView({
+      format: "rgba8unorm",
+      dimension: "2d",
+      baseMipLevel: 0,
+      mipLevelCount: 1,
+      baseArrayLayer: 0,
+      arrayLayerCount: 1,
+      aspect: "all",
+    });
+
+    return [texture, textureView];
+  };
+
+  const [texture, textureView] = options.processFn
+    ? (options.processFn(data, options) as [GPUTexture, GPUTextureView])
+    : processTexture();
+
+  Mod.export.WebGPU.importJsTexture(texture);
+  const id = Mod.export.WebGPU.importJsTextureView(textureView);
+
+  if (options.ref) {
+    options.ref._TexID = id;
+    return options.ref;
+  }
+
+  return new ImTextureRef(id);
+}
+
+/**
+ * Map of browser mouse button values to ImGui mouse button enums.
  * For reference, see {@link https://developer.mozilla.org/en-US/docs/Web/API/MouseEvent/button}.
  */
-const MOUSE_BUTTON_MAP = {
-  0: ImGui.MouseButton.Left,
-  1: ImGui.MouseButton.Middle,
-  2: ImGui.MouseButton.Right,
+const MOUSE_BUTTON_MAP = {
+  0: ImGui.MouseButton.Left,
+  1: ImGui.MouseButton.Middle,
+  2: ImGui.MouseButton.Right,
+} as const;
+
+/**
+ * Map of ImGui mouse cursor enums to CSS cursor styles.
+ * For reference, see {@link https://developer.mozilla.org/en-US/docs/Web/CSS/cursor}.
+ */
+const MOUSE_CURSOR_MAP = {
+  [ImGui.MouseCursor.None]: "none",
+  [ImGui.MouseCursor.Arrow]: "default",
+  [ImGui.MouseCursor.TextInput]: "text",
+  [ImGui.MouseCursor.Hand]: "pointer",
+  [ImGui.MouseCursor.ResizeAll]: "all-scroll",
+  [ImGui.MouseCursor.ResizeNS]: "ns-resize",
+  [ImGui.MouseCursor.ResizeEW]: "ew-resize",
+  [ImGui.MouseCursor.ResizeNESW]: "nesw-resize",
+  [ImGui.MouseCursor.ResizeNWSE]: "nwse-resize",
+  [ImGui.MouseCursor.NotAllowed]: "not-allowed",
+} as const;
+
+/**
+ * Map of browser keyboard key values to ImGui key enums.
+ * For reference, see {@link https://developer.mozilla.org/en-US/docs/Web/API/KeyboardEvent/key}.
+ */
+const KEYBOARD_MAP = {
+  "0": ImGui.Key._0,
+  "1": ImGui.Key._1,
+  "2": ImGui.Key._2,
+  "3": ImGui.Key._3,
+  "4": ImGui.Key._4,
+  "5": ImGui.Key._5,
+  "6": ImGui.Key._6,
+  "7": ImGui.Key._7,
+  "8": ImGui.Key._8,
+  "9": ImGui.Key._9,
+
+  Numpad0: ImGui.Key._Keypad0,
+  Numpad1: ImGui.Key._Keypad1,
+  Numpad2: ImGui.Key._Keypad2,
+  Numpad3: ImGui.Key._Keypad3,
+  Numpad4: ImGui.Key._Keypad4,
+  Numpad5: ImGui.Key._Keypad5,
+  Numpad6: ImGui.Key._Keypad6,
+  Numpad7: ImGui.Key._Keypad7,
+  Numpad8: ImGui.Key._Keypad8,
+  Numpad9: ImGui.Key._Keypad9,
+  NumpadDecimal: ImGui.Key._KeypadDecimal,
+  NumpadDivide: ImGui.Key._KeypadDivide,
+  NumpadMultiply: ImGui.Key._KeypadMultiply,
+  NumpadSubtract: ImGui.Key._KeypadSubtract,
+  NumpadAdd: ImGui.Key._KeypadAdd,
+  NumpadEnter: ImGui.Key._KeypadEnter,
+  NumpadEqual: ImGui.Key._KeypadEqual,
+
+  F1: ImGui.Key._F1,
+  F2: ImGui.Key._F2,
+  F3: ImGui.Key._F3,
+  F4: ImGui.Key._F4,
+  F5: ImGui.Key._F5,
+  F6: ImGui.Key._F6,
+  F7: ImGui.Key._F7,
+  F8: ImGui.Key._F8,
+  F9: ImGui.Key._F9,
+  F10: ImGui.Key._F10,
+  F11: ImGui.Key._F11,
+  F12: ImGui.Key._F12,
+  F13: ImGui.Key._F13,
+  F14: ImGui.Key._F14,
+  F15: ImGui.Key._F15,
+  F16: ImGui.Key._F16,
+  F17: ImGui.Key._F17,
+  F18: ImGui.Key._F18,
+  F19: ImGui.Key._F19,
+  F20: ImGui.Key._F20,
+  F21: ImGui.Key._F21,
+  F22: ImGui.Key._F22,
+  F23: ImGui.Key._F23,
+  F24: ImGui.Key._F24,
+
+  a: ImGui.Key._A,
+  b: ImGui.Key._B,
+  c: ImGui.Key._C,
+  d: ImGui.Key._D,
+  e: ImGui.Key._E,
+  f: ImGui.Key._F,
+  g: ImGui.Key._G,
+  h: ImGui.Key._H,
+  i: ImGui.Key._I,
+  j: ImGui.Key._J,
+  k: ImGui.Key._K,
+  l: ImGui.Key._L,
+  m: ImGui.Key._M,
+  n: ImGui.Key._N,
+  o: ImGui.Key._O,
+  p: ImGui.Key._P,
+  q: ImGui.Key._Q,
+  r: ImGui.Key._R,
+  s: ImGui.Key._S,
+  t: ImGui.Key._T,
+  u: ImGui.Key._U,
+  v: ImGui.Key._V,
+  w: ImGui.Key._W,
+  x: ImGui.Key._X,
+  y: ImGui.Key._Y,
+  z: ImGui.Key._Z,
+  A: ImGui.Key._A,
+  B: ImGui.Key._B,
+  C: ImGui.Key._C,
+  D: ImGui.Key._D,
+  E: ImGui.Key._E,
+  F: ImGui.Key._F,
+  G: ImGui.Key._G,
+  H: ImGui.Key._H,
+  I: ImGui.Key._I,
+  J: ImGui.Key._J,
+  K: ImGui.Key._K,
+  L: ImGui.Key._L,
+  M: ImGui.Key._M,
+  N: ImGui.Key._N,
+  O: ImGui.Key._O,
+  P: ImGui.Key._P,
+  Q: ImGui.Key._Q,
+  R: ImGui.Key._R,
+  S: ImGui.Key._S,
+  T: ImGui.Key._T,
+  U: ImGui.Key._U,
+  V: ImGui.Key._V,
+  W: ImGui.Key._W,
+  X: ImGui.Key._X,
+  Y: ImGui.Key._Y,
+  Z: ImGui.Key._Z,
+  "'": ImGui.Key._Apostrophe,
+  ",": ImGui.Key._Comma,
+  "-": ImGui.Key._Minus,
+  ".": ImGui.Key._Period,
+  "/": ImGui.Key._Slash,
+  ";": ImGui.Key._Semicolon,
+  "=": ImGui.Key._Equal,
+  "[": ImGui.Key._LeftBracket,
+  "\\": ImGui.Key._Backslash,
+  "]": ImGui.Key._RightBracket,
+  "`": ImGui.Key._GraveAccent,
+
+  CapsLock: ImGui.Key._CapsLock,
+  ScrollLock: ImGui.Key._ScrollLock,
+  NumLock: ImGui.Key._NumLock,
+  PrintScreen: ImGui.Key._PrintScreen,
+  Pause: ImGui.Key._Pause,
+
+  Tab: ImGui.Key._Tab,
+  ArrowLeft: ImGui.Key._LeftArrow,
+  ArrowRight: ImGui.Key._RightArrow,
+  ArrowUp: ImGui.Key._UpArrow,
+  ArrowDown: ImGui.Key._DownArrow,
+  PageUp: ImGui.Key._PageUp,
+  PageDown: ImGui.Key._PageDown,
+  Home: ImGui.Key._Home,
+  End: ImGui.Key._End,
+  Insert: ImGui.Key._Insert,
+  Delete: ImGui.Key._Delete,
+  Backspace: ImGui.Key._Backspace,
+  " ": ImGui.Key._Space,
+  Enter: ImGui.Key._Enter,
+  Escape: ImGui.Key._Escape,
+
+  Control: ImGui.Key._LeftCtrl,
+  Shift: ImGui.Key._LeftShift,
+  Alt: ImGui.Key._LeftAlt,
+  Super: ImGui.Key._LeftSuper,
+  Meta: ImGui.Key._LeftSuper,
+} as const;
+
+/**
+ * Map of browser keyboard modifier key values to ImGui key modifier enums.
+ * For reference, see {@link https://developer.mozilla.org/en-US/docs/Web/API/KeyboardEvent/key}.
+ */
+const KEYBOARD_MODIFIER_MAP = {
+  Control: ImGui.Key.ImGuiMod_Ctrl,
+  Shift: ImGui.Key.ImGuiMod_Shift,
+  Alt: ImGui.Key.ImGuiMod_Alt,
+  Super: ImGui.Key.ImGuiMod_Super,
+  Meta: ImGui.Key.ImGuiMod_Super,
+} as const;
+
+const metaKeyInfo = {
+  isDown: false,
+};
+
+/**
+ * The part of {@linkcode ImGuiIO} fed by the browser input handlers. This is the
+ * {@linkcode InputRingBuffer} in the WASM heap, or an {@linkcode InputEventQueue} when Dear ImGui
+ * runs in a worker.
+ */
+type InputSink = Pick<
+  ImGuiIO,
+  | "AddMousePosEvent"
+  | "AddMouseButtonEvent"
+  | "AddMouseWheelEvent"
+  | "AddKeyEvent"
+  | "AddInputCharactersUTF8"
+  | "AddFocusEvent"
+>;
+
+/**
+ * State of Dear ImGui the browser input handlers react to.
+ */
+interface InputFeedback {
+  mouseCursor(): ImGuiMouseCursor;
+  wantTextInput(): boolean;
+}
+
+/**
+ * Forwards keyboard events to Dear ImGui. This is both used for normal keyboard events as well as
+ * for the virtual keyboard, see {@linkcode setupKeyboardIO} and {@linkcode setupTouchIO}.
+ *
+ * @param event The keyboard event to handle.
+ * @param keyDown Whether the key is being pressed or released.
+ * @param io The {@linkcode ImGuiIO} object to forward the event to.
+ */
+const handleKeyboardEvent = (event: KeyboardEvent, keyDown: boolean, io: InputSink) => {
+  if (!Object.hasOwn(KEYBOARD_MAP, event.key)) {
+    return;
+  }
+
+  if (event.key === "Meta") {
+    metaKeyInfo.isDown = keyDown;
+  }
+
+  io.AddKeyEvent(KEYBOARD_MAP[event.key as keyof typeof KEYBOARD_MAP], keyDown);
+
+  // NOTE: We lift the key when the meta key is pressed, because on macOS the browsers
+  // 'keyup' events are not fired for other keys when meta key is held down.
+  // see: https://stackoverflow.com/q/11818637.
+  if (metaKeyInfo.isDown) {
+    io.AddKeyEvent(KEYBOARD_MAP[event.key as keyof typeof KEYBOARD_MAP], false);
+  }
+
+  const modifier = KEYBOARD_MODIFIER_MAP[event.key as keyof typeof KEYBOARD_MODIFIER_MAP];
+  if (modifier) {
+    io.AddKeyEvent(modifier, keyDown);
+  }
+
+  if (event.key.length === 1 && keyDown) {
+    io.AddInputCharactersUTF8(event.key);
+  }
+};
+
+const setDisplayProperties = (canvas: HTMLCanvasElement) => {
+  const io = ImGuiImplWeb.GetIOFields();
+  io.Set(IOField.DisplayWidth, Math.floor(canvas.clientWidth));
+  io.Set(IOField.DisplayHeight, Math.floor(canvas.clientHeight));
+};
+
+/**
+ * Handles mouse button events.
+ *
+ * @param event The mouse event to handle.
+ * @param isDown Whether the button is being pressed or released.
+ * @param io The {@linkcode ImGuiIO} object to forward the event to.
+ */
+const handleMouseButtonEvent = (event: MouseEvent, isDown: boolean, io: InputSink) => {
+  if (!Object.hasOwn(MOUSE_BUTTON_MAP, event.button)) {
+    return;
+  }
+
+  io.AddMouseButtonEvent(MOUSE_BUTTON_MAP[event.button as keyof typeof MOUSE_BUTTON_MAP], isDown);
+};
+
+/**
+ * Sets up mouse key, wheel input and movement. Also handles cursor style changes.
+ *
+ * @param canvas The canvas element to set up.
+ * @param io The input sink to forward the events to.
+ * @param feedback The state of Dear ImGui for the cursor style.
+ * @param signal Removes the event listeners when aborted.
+ */
+const setupMouseIO = (
+  canvas: HTMLCanvasElement,
+  io: InputSink,
+  feedback: InputFeedback,
+  signal?: AbortSignal,
+) => {
+  const scrollSpeed = 0.01;
+
+  canvas.addEventListener(
+    "pointermove",
+    (e) => {
+      const rect = canvas.getBoundingClientRect();
+      io.AddMousePosEvent(e.clientX - rect.left, e.clientY - rect.top);
+
+      canvas.style.cursor = MOUSE_CURSOR_MAP[feedback.mouseCursor()];
+    },
+    { signal },
+  );
+
+  canvas.addEventListener("pointerdown", (e) => handleMouseButtonEvent(e, true, io), { signal });
+  canvas.addEventListener("pointerup", (e) => handleMouseButtonEvent(e, false, io), { signal });
+  canvas.addEventListener(
+    "wheel",
+    (e) => io.AddMouseWheelEvent(-e.deltaX * scrollSpeed, -e.deltaY * scrollSpeed),
+    { signal },
+  );
+};
+
+/**
+ * Sets up keyboard input handling. Browser keyboard events are handled by
+ * {@linkcode handleKeyboardEvent}.
+ *
+ * @param canvas The canvas element to set up.
+ * @param io The input sink to forward the events to.
+ * @param signal Removes the event listeners when aborted.
+ */
+const setupKeyboardIO = (canvas: HTMLCanvasElement, io: InputSink, signal?: AbortSignal) => {
+  // TODO: Fix too fast repeated inputs (Backspace, Delete...).
+  canvas.addEventListener("keydown", (e) => handleKeyboardEvent(e, true, io), { signal });
+  canvas.addEventListener("keyup", (e) => handleKeyboardEvent(e, false, io), { signal });
+};
+
+/**
+ * Sets up touch input handling as well as showing the virtual keyboard. Note the following:
+ *
+ * - Single-finger touches are treated as mouse left clicks.
+ * - Two-finger touches are treated as mouse scrolls.
+ *
+ * @param canvas The canvas element to set up.
+ * @param io The input sink to forward the events to.
+ * @param feedback The state of Dear ImGui for showing the virtual keyboard.
+ * @param signal Removes the event listeners when aborted.
+ */
+const setupTouchIO = (
+  canvas: HTMLCanvasElement,
+  io: InputSink,
+  feedback: InputFeedback,
+  signal?: AbortSignal,
+) => {
+  const scrollSpeed = 0.02;
+  let lastPos = { x: 0, y: 0 };
+
+  const handleTouchEvent = (event: TouchEvent, isButtonDown?: boolean) => {
+    event.preventDefault();
+    const rect = canvas.getBoundingClientRect();
+
+    if (event.touches.length === 2) {
+      const touch1 = event.touches[0];
+      const touch2 = event.touches[1];
+
+      const currentPos = {
+        x: (touch1.clientX + touch2.clientX) / 2,
+        y: (touch1.clientY + touch2.clientY) / 2,
+      };
+
+      if (lastPos.x > 0 && lastPos.y > 0) {
+        const deltaX = (lastPos.x - currentPos.x) * scrollSpeed;
+        const deltaY = (lastPos.y - currentPos.y) * scrollSpeed;
+        io.AddMouseWheelEvent(-deltaX, -deltaY);
+      }
+
+      lastPos = currentPos;
+      return;
+    }
+
+    lastPos = { x: 0, y: 0 };
+    const touch = event.touches[0];
+
+    if (touch) {
+      io.AddMousePosEvent(touch.clientX - rect.left, touch.clientY - rect.top);
+    }
+
+    if (typeof isButtonDown === "boolean") {
+      io.AddMouseButtonEvent(ImGui.MouseButton.Left, isButtonDown);
+    }
+  };
+
+  // Since the Virtual Keyboard API isn't widely supported yet, we use an invisible
+  // <input> element to show the on-screen keyboard and handle the text input.
+  // See: https://developer.mozilla.org/en-US/docs/Web/API/VirtualKeyboard_API
+  const input = document.createElement("input");
+  input.style.position = "absolute";
+  input.style.opacity = "0";
+  input.style.pointerEvents = "none";
+
+  const keyDownHandler = (e: KeyboardEvent) => handleKeyboardEvent(e, true, io);
+  const keyUpHandler = (e: KeyboardEvent) => handleKeyboardEvent(e, false, io);
+  const blurHandler = () => {
+    input.removeEventListener("keydown", keyDownHandler);
+    input.removeEventListener("keyup", keyUpHandler);
+    input.remove();
+  };
+
+  const handleTextInput = () => {
+    if (feedback.wantTextInput()) {
+      document.body.appendChild(input);
+      input.focus();
+
+      input.addEventListener("blur", blurHandler);
+      input.addEventListener("keydown", keyDownHandler);
+      input.addEventListener("keyup", (e) => {
+        keyUpHandler(e);
+
+        // Exits single-line input fields when pressing Enter.
+        if (!feedback.wantTextInput()) {
+          blurHandler();
+        }
+      });
+    } else {
+      blurHandler();
+    }
+  };
+
+  canvas.addEventListener("touchstart", (e) => handleTouchEvent(e, true), { signal });
+  canvas.addEventListener("touchmove", (e) => handleTouchEvent(e), { signal });
+
+  canvas.addEventListener(
+    "touchend",
+    (e) => {
+      lastPos = { x: 0, y: 0 };
+      handleTouchEvent(e, false);
+      handleTextInput();
+    },
+    { signal },
+  );
+
+  canvas.addEventListener(
+    "touchcancel",
+    (e) => {
+      lastPos = { x: 0, y: 0 };
+      handleTouchEvent(e, false);
+    },
+    { signal },
+  );
+
+  signal?.addEventListener("abort", blurHandler);
+};
+
+/**
+ * Sets up the clipboard functionality to work between the browser and Dear ImGui.
+ */
+const setupClipboardIO = () => {
+  const getClipboard = (): string => {
+    return State.clipboardData;
+  };
+
+  const setClipboard = (text: string) => {
+    navigator.clipboard.writeText(text);
+    State.clipboardData = text;
+  };
+
+  Mod.export.SetupClipboardFunctions(getClipboard, setClipboard);
+
+  document.addEventListener("paste", (e) => {
+    State.clipboardData = e.clipboardData?.getData("text/plain") ?? "";
+  });
+};
+
+/**
+ * Events which feed input into Dear ImGui and wake up the lazy render loop.
+ */
+const INPUT_EVENT_TYPES = [
+  "pointermove",
+  "pointerdown",
+  "pointerup",
+  "wheel",
+  "keydown",
+  "keyup",
+  "touchstart",
+  "touchmove",
+  "touchend",
+  "touchcancel",
+  "focus",
+  "blur",
+];
+
+/**
+ * Sets up Dear ImGui for the browser. This includes:
+ * - Setting up the canvas and resize events.
+ * - Setting up mouse input, movement and cursor handling.
+ * - Setting up keyboard input handling.
+ * - Setting up touch input handling.
+ *
+ * This function is called by {@linkcode ImGuiImplWeb.Init}.
+ *
+ * @param canvas The canvas element to set up.
+ */
+const setupBrowserIO = (canvas: HTMLCanvasElement) => {
+  const io = ImGui.GetIO();
+  io.BackendFlags = ImGui.BackendFlags.HasMouseCursors;
+
+  // Swap super and ctrl keys on macOS.
+  if (navigator.userAgent.includes("Mac")) {
+    io.ConfigMacOSXBehaviors = true;
+  }
+
+  setDisplayProperties(canvas);
+
+  const feedback = {
+    mouseCursor: () => ImGui.GetMouseCursor(),
+    wantTextInput: () => ImGuiImplWeb.GetIOFields().Get(IOField.WantTextInput) !== 0,
+  };
+  State.inputRing = new InputRingBuffer();
+  setupCanvasInput(canvas, State.inputRing, feedback, () => State.wakeFn?.());
+  setupClipboardIO();
+
+  Mod.export.SetupIniSettings();
+};
+
+/**
+ * Sets up the input event listeners of the canvas, shared by {@linkcode setupBrowserIO} and the
+ * main thread side of {@linkcode ImGuiImplWeb.StartWorker}.
+ *
+ * @param canvas The canvas element to set up.
+ * @param io The input sink to forward the events to.
+ * @param feedback The state of Dear ImGui the handlers react to.
+ * @param wake Called on every input, to wake up the lazy render loop (see ImGuiImplWeb.RunLazy).
+ * @param signal Removes the event listeners when aborted.
+ */
+const setupCanvasInput = (
+  canvas: HTMLCanvasElement,
+  io: InputSink,
+  feedback: InputFeedback,
+  wake: () => void,
+  signal?: AbortSignal,
+) => {
+  canvas.tabIndex = 1;
+  canvas.addEventListener("contextmenu", (e) => e.preventDefault(), { signal });
+  canvas.addEventListener("focus", () => io.AddFocusEvent(true), { signal });
+  canvas.addEventListener("blur", () => io.AddFocusEvent(false), { signal });
+
+  setupMouseIO(canvas, io, feedback, signal);
+  setupKeyboardIO(canvas, io, signal);
+  setupTouchIO(canvas, io, feedback, signal);
+
+  for (const type of INPUT_EVENT_TYPES) {
+    canvas.addEventListener(type, wake, { passive: true, signal });
+  }
+  globalThis.addEventListener("resize", wake, { signal });
+  document.addEventListener("paste", wake, { signal });
+};
+
+/**
+ * Types of the events in an {@linkcode InputEventQueue} and {@linkcode InputRingBuffer}. Keep in
+ * sync with `input_event_type` in imgui.cpp.
+ */
+const InputEventType = {
+  MousePos: 0,
+  MouseButton: 1,
+  MouseWheel: 2,
+  Key: 3,
+  Char: 4,
+  Focus: 5,
 } as const;
 
 /**
- * Map of ImGui mouse cursor enums to CSS cursor styles.
- * For reference, see {@link https://developer.mozilla.org/en-US/docs/Web/CSS/cursor}.
+ * Implements the {@linkcode InputSink} methods by packing each event into a record of one type
+ * word and three float payload words.
+ */
+abstract class InputEventWriter implements InputSink {
+  protected abstract push(type: number, a: number, b?: number, c?: number): void;
+
+  AddMousePosEvent(x: number, y: number): void {
+    this.push(InputEventType.MousePos, x, y);
+  }
+  AddMouseButtonEvent(button: number, down: boolean): void {
+    this.push(InputEventType.MouseButton, button, down ? 1 : 0);
+  }
+  AddMouseWheelEvent(wheel_x: number, wheel_y: number): void {
+    this.push(InputEventType.MouseWheel, wheel_x, wheel_y);
+  }
+  AddKeyEvent(key: ImGuiKey, down: boolean): void {
+    this.push(InputEventType.Key, key, down ? 1 : 0);
+  }
+  AddInputCharactersUTF8(str: string): void {
+    for (const char of str) {
+      this.push(InputEventType.Char, char.codePointAt(0) as number);
+    }
+  }
+  AddFocusEvent(focused: boolean): void {
+    this.push(InputEventType.Focus, focused ? 1 : 0);
+  }
+}
+
+/**
+ * Ring buffer of input events in the WASM heap (`input_ring` in imgui.cpp). The browser input
+ * handlers write into it without calling into WASM, and {@linkcode ImGuiImplWeb.BeginRender}
+ * replays the events natively in one call, coalescing runs of mouse moves. A full ring is drained
+ * early instead of dropping events.
+ */
+class InputRingBuffer extends InputEventWriter {
+  static readonly #HEAD = 0;
+  static readonly #TAIL = 1;
+  static readonly #CAPACITY = 2;
+  static readonly #HEADER_WORDS = 4;
+  static readonly #RECORD_WORDS = 4;
+
+  readonly ptr: number;
+  readonly capacity: number;
+  #ints = new Int32Array(0);
+  #floats = new Float32Array(0);
+
+  constructor() {
+    super();
+    this.ptr = Mod.export.get_input_ring();
+    this.#updateViews();
+    this.capacity = this.#ints[(this.ptr >> 2) + InputRingBuffer.#CAPACITY];
+  }
+
+  override push(type: number, a: number, b = 0, c = 0): void {
+    this.#updateViews();
+    const base = this.ptr >> 2;
+
+    let tail = this.#ints[base + InputRingBuffer.#TAIL];
+    if (((tail - Atomics.load(this.#ints, base + InputRingBuffer.#HEAD)) | 0) >= this.capacity) {
+      this.drain();
+      this.#updateViews();
+      tail = this.#ints[base + InputRingBuffer.#TAIL];
+    }
+
+    const slot = tail & (this.capacity - 1);
+    const i = base + InputRingBuffer.#HEADER_WORDS + slot * InputRingBuffer.#RECORD_WORDS;
+    this.#ints[i] = type;
+    this.#floats[i + 1] = a;
+    this.#floats[i + 2] = b;
+    this.#floats[i + 3] = c;
+
+    // Publishes the record to the native drain.
+    Atomics.store(this.#ints, base + InputRingBuffer.#TAIL, (tail + 1) | 0);
+  }
+
+  /**
+   * Replays the queued events into the `ImGuiIO` natively. Returns the number of events.
+   */
+  drain(): number {
+    return Mod.export.drain_input_events();
+  }
+
+  #updateViews(): void {
+    const buffer = Mod.export.HEAPU8.buffer;
+    if (this.#ints.buffer !== buffer) {
+      this.#ints = new Int32Array(buffer);
+      this.#floats = new Float32Array(buffer);
+    }
+  }
+}
+
+/**
+ * Single-producer single-consumer queue of input events in a `SharedArrayBuffer`, used when Dear
+ * ImGui runs in a worker (see {@linkcode ImGuiImplWeb.StartWorker}). The main thread pushes the
+ * browser input without blocking, the worker moves it into its {@linkcode InputRingBuffer} in
+ * {@linkcode ImGuiImplWeb.BeginRender}. The header also carries the display size from the main
+ * thread and the mouse cursor and text input state back from the worker.
+ *
+ * Events are records of one type word and three float payload words. When the worker falls behind
+ * by a full queue, new events are dropped and counted.
+ *
+ * A worker running {@linkcode ImGuiImplWeb.RunLazy} marks the queue idle before it sleeps, and the
+ * main thread only posts a wake message for the first event after that, not for every event.
+ */
+export class InputEventQueue extends InputEventWriter implements InputFeedback {
+  static readonly #HEAD = 0;
+  static readonly #TAIL = 1;
+  static readonly #DROPPED = 2;
+  static readonly #DISPLAY_WIDTH = 3;
+  static readonly #DISPLAY_HEIGHT = 4;
+  static readonly #MOUSE_CURSOR = 5;
+  static readonly #WANT_TEXT_INPUT = 6;
+  static readonly #IDLE = 7;
+  static readonly #HEADER_WORDS = 8;
+  static readonly #RECORD_WORDS = 4;
+
+  readonly buffer: SharedArrayBuffer;
+  readonly capacity: number;
+  #ints: Int32Array;
+  #floats: Float32Array;
+
+  /**
+   * @param source The capacity in events of a new queue (a power of two), or the buffer of an
+   * existing queue, e.g. received by the worker.
+   */
+  constructor(source: number | SharedArrayBuffer) {
+    super();
+
+    if (typeof source === "number" && (source <= 0 || (source & (source - 1)) !== 0)) {
+      throw new Error("jsimgui: The input queue capacity must be a power of two.");
+    }
+
+    this.buffer =
+      typeof source === "number"
+        ? new SharedArrayBuffer(
+            (InputEventQueue.#HEADER_WORDS + source * InputEventQueue.#RECORD_WORDS) * 4,
+          )
+        : source;
+    this.capacity =
+      (this.buffer.byteLength / 4 - InputEventQueue.#HEADER_WORDS) / InputEventQueue.#RECORD_WORDS;
+    this.#ints = new Int32Array(this.buffer);
+    this.#floats = new Float32Array(this.buffer);
+  }
+
+  /**
+   * The number of events dropped because the queue was full.
+   */
+  get dropped(): number {
+    return Atomics.load(this.#ints, InputEventQueue.#DROPPED);
+  }
+
+  #recordIndex(position: number): number {
+    const slot = position & (this.capacity - 1);
+    return InputEventQueue.#HEADER_WORDS + slot * InputEventQueue.#RECORD_WORDS;
+  }
+
+  protected override push(type: number, a: number, b = 0, c = 0): void {
+    const tail = Atomics.load(this.#ints, InputEventQueue.#TAIL);
+    const head = Atomics.load(this.#ints, InputEventQueue.#HEAD);
+    if (((tail - head) | 0) >= this.capacity) {
+      Atomics.add(this.#ints, InputEventQueue.#DROPPED, 1);
+      return;
+    }
+
+    const i = this.#recordIndex(tail);
+    this.#ints[i] = type;
+    this.#floats[i + 1] = a;
+    this.#floats[i + 2] = b;
+    this.#floats[i + 3] = c;
+
+    // Publishes the record to the consumer.
+    Atomics.store(this.#ints, InputEventQueue.#TAIL, (tail + 1) | 0);
+  }
+
+  /**
+   * Moves the queued events into the given {@linkcode InputRingBuffer}, which replays them in
+   * the same frame. Called by the worker.
+   */
+  drain(ring: InputRingBuffer): void {
+    let head = Atomics.load(this.#ints, InputEventQueue.#HEAD);
+    const tail = Atomics.load(this.#ints, InputEventQueue.#TAIL);
+
+    for (; head !== tail; head = (head + 1) | 0) {
+      const i = this.#recordIndex(head);
+      ring.push(this.#ints[i], this.#floats[i + 1], this.#floats[i + 2], this.#floats[i + 3]);
+    }
+
+    // Releases the records to the producer.
+    Atomics.store(this.#ints, InputEventQueue.#HEAD, head);
+  }
+
+  /**
+   * Marks the worker as idle, before its lazy render loop sleeps. Called by the worker.
+   *
+   * @returns Whether events were pushed meanwhile, which the worker renders instead of sleeping.
+   * Either this sees the new events or {@linkcode InputEventQueue.claimWake} sees the idle flag.
+   */
+  markIdle(): boolean {
+    Atomics.store(this.#ints, InputEventQueue.#IDLE, 1);
+    const tail = Atomics.load(this.#ints, InputEventQueue.#TAIL);
+    return tail !== Atomics.load(this.#ints, InputEventQueue.#HEAD);
+  }
+
+  /**
+   * Marks the worker as rendering again. Called by the worker.
+   */
+  markBusy(): void {
+    Atomics.store(this.#ints, InputEventQueue.#IDLE, 0);
+  }
+
+  /**
+   * Clears the idle flag of the worker. Called by the main thread after pushing events.
+   *
+   * @returns Whether the worker was idle, so the caller is the one to wake it up.
+   */
+  claimWake(): boolean {
+    return Atomics.compareExchange(this.#ints, InputEventQueue.#IDLE, 1, 0) === 1;
+  }
+
+  setDisplaySize(width: number, height: number): void {
+    Atomics.store(this.#ints, InputEventQueue.#DISPLAY_WIDTH, width);
+    Atomics.store(this.#ints, InputEventQueue.#DISPLAY_HEIGHT, height);
+  }
+  getDisplaySize(): [number, number] {
+    return [
+      Atomics.load(this.#ints, InputEventQueue.#DISPLAY_WIDTH),
+      Atomics.load(this.#ints, InputEventQueue.#DISPLAY_HEIGHT),
+    ];
+  }
+
+  setFeedback(mouseCursor: ImGuiMouseCursor, wantTextInput: boolean): void {
+    Atomics.store(this.#ints, InputEventQueue.#MOUSE_CURSOR, mouseCursor);
+    Atomics.store(this.#ints, InputEventQueue.#WANT_TEXT_INPUT, wantTextInput ? 1 : 0);
+  }
+  mouseCursor(): ImGuiMouseCursor {
+    return Atomics.load(this.#ints, InputEventQueue.#MOUSE_CURSOR);
+  }
+  wantTextInput(): boolean {
+    return Atomics.load(this.#ints, InputEventQueue.#WANT_TEXT_INPUT) !== 0;
+  }
+}
+
+/**
+ * Sets up Dear ImGui in a worker, with input from the {@linkcode InputEventQueue} filled by the
+ * main thread and the clipboard forwarded through messages.
+ *
+ * This function is called by {@linkcode ImGuiImplWeb.InitInWorker}.
+ */
+const setupWorkerIO = () => {
+  const io = ImGui.GetIO();
+  io.BackendFlags = ImGui.BackendFlags.HasMouseCursors;
+  State.inputRing = new InputRingBuffer();
+
+  if (navigator.userAgent.includes("Mac")) {
+    io.ConfigMacOSXBehaviors = true;
+  }
+
+  const getClipboard = (): string => {
+    return State.clipboardData;
+  };
+
+  const setClipboard = (text: string) => {
+    State.clipboardData = text;
+    globalThis.postMessage({ type: "jsimgui:copy", text });
+  };
+
+  Mod.export.SetupClipboardFunctions(getClipboard, setClipboard);
+  Mod.export.SetupIniSettings();
+};
+
+/**
+ * Fields of {@linkcode ImGuiIOFields}, also the order of its packed
+ * {@linkcode ImGuiIOFields.Read} and {@linkcode ImGuiIOFields.Write}. Keep in sync with
+ * `io_field_layout` in imgui.cpp.
  */
-const MOUSE_CURSOR_MAP = {
-  [ImGui.MouseCursor.None]: "none",
-  [ImGui.MouseCursor.Arrow]: "default",
-  [ImGui.MouseCursor.TextInput]: "text",
-  [ImGui.MouseCursor.Hand]: "pointer",
-  [ImGui.MouseCursor.ResizeAll]: "all-scroll",
-  [ImGui.MouseCursor.ResizeNS]: "ns-resize",
-  [ImGui.MouseCursor.ResizeEW]: "ew-resize",
-  [ImGui.MouseCursor.ResizeNESW]: "nesw-resize",
-  [ImGui.MouseCursor.ResizeNWSE]: "nwse-resize",
-  [ImGui.MouseCursor.NotAllowed]: "not-allowed",
+export const IOField = {
+  DisplayWidth: 0,
+  DisplayHeight: 1,
+  DeltaTime: 2,
+  MouseX: 3,
+  MouseY: 4,
+  Framerate: 5,
+  WantCaptureMouse: 6,
+  WantCaptureKeyboard: 7,
+  WantTextInput: 8,
+  WantSetMousePos: 9,
+  WantSaveIniSettings: 10,
 } as const;
 
+export type IOField = (typeof IOField)[keyof typeof IOField];
+
 /**
- * Map of browser keyboard key values to ImGui key enums.
- * For reference, see {@link https://developer.mozilla.org/en-US/docs/Web/API/KeyboardEvent/key}.
+ * The {@linkcode ImGuiIO} fields used every frame, read and written in place through typed array
+ * views onto the WASM heap. Unlike the embind accessors of `ImGui.GetIO()`, which return a new
+ * `ImVec2` for `DisplaySize` or `MousePos`, nothing is allocated. Get it with
+ * {@linkcode ImGuiImplWeb.GetIOFields}.
+ *
+ * @example
+ * ```ts
+ * const io = ImGuiImplWeb.GetIOFields();
+ * io.Set(IOField.DisplayWidth, canvas.clientWidth);
+ * if (io.Get(IOField.WantCaptureMouse)) { ... }
+ * ```
  */
-const KEYBOARD_MAP = {
-  "0": ImGui.Key._0,
-  "1": ImGui.Key._1,
-  "2": ImGui.Key._2,
-  "3": ImGui.Key._3,
-  "4": ImGui.Key._4,
-  "5": ImGui.Key._5,
-  "6": ImGui.Key._6,
-  "7": ImGui.Key._7,
-  "8": ImGui.Key._8,
-  "9": ImGui.Key._9,
+export class ImGuiIOFields {
+  static readonly #COUNT = 11;
 
-  Numpad0: ImGui.Key._Keypad0,
-  Numpad1: ImGui.Key._Keypad1,
-  Numpad2: ImGui.Key._Keypad2,
-  Numpad3: ImGui.Key._Keypad3,
-  Numpad4: ImGui.Key._Keypad4,
-  Numpad5: ImGui.Key._Keypad5,
-  Numpad6: ImGui.Key._Keypad6,
-  Numpad7: ImGui.Key._Keypad7,
-  Numpad8: ImGui.Key._Keypad8,
-  Numpad9: ImGui.Key._Keypad9,
-  NumpadDecimal: ImGui.Key._KeypadDecimal,
-  NumpadDivide: ImGui.Key._KeypadDivide,
-  NumpadMultiply: ImGui.Key._KeypadMultiply,
-  NumpadSubtract: ImGui.Key._KeypadSubtract,
-  NumpadAdd: ImGui.Key._KeypadAdd,
-  NumpadEnter: ImGui.Key._KeypadEnter,
-  NumpadEqual: ImGui.Key._KeypadEqual,
+  /**
+   * The byte address of each {@linkcode IOField} in the WASM heap.
+   */
+  readonly addresses: Int32Array;
+
+  #f32 = new Float32Array(0);
+  #u8 = new Uint8Array(0);
+
+  constructor() {
+    const layout = new Int32Array(
+      Mod.export.HEAPU8.buffer,
+      Mod.export.get_io_field_layout(),
+      ImGuiIOFields.#COUNT,
+    );
+    this.addresses = layout.slice();
+  }
 
-  F1: ImGui.Key._F1,
-  F2: ImGui.Key._F2,
-  F3: ImGui.Key._F3,
-  F4: ImGui.Key._F4,
-  F5: ImGui.Key._F5,
-  F6: ImGui.Key._F6,
-  F7: ImGui.Key._F7,
-  F8: ImGui.Key._F8,
-  F9: ImGui.Key._F9,
-  F10: ImGui.Key._F10,
-  F11: ImGui.Key._F11,
-  F12: ImGui.Key._F12,
-  F13: ImGui.Key._F13,
-  F14: ImGui.Key._F14,
-  F15: ImGui.Key._F15,
-  F16: ImGui.Key._F16,
-  F17: ImGui.Key._F17,
-  F18: ImGui.Key._F18,
-  F19: ImGui.Key._F19,
-  F20: ImGui.Key._F20,
-  F21: ImGui.Key._F21,
-  F22: ImGui.Key._F22,
-  F23: ImGui.Key._F23,
-  F24: ImGui.Key._F24,
+  /**
+   * Returns a field, the `Want*` flags as 0 or 1.
+   */
+  Get(field: IOField): number {
+    this.#updateViews();
+    const address = this.addresses[field];
+    return field < IOField.WantCaptureMouse ? this.#f32[address >> 2] : this.#u8[address];
+  }
 
-  a: ImGui.Key._A,
-  b: ImGui.Key._B,
-  c: ImGui.Key._C,
-  d: ImGui.Key._D,
-  e: ImGui.Key._E,
-  f: ImGui.Key._F,
-  g: ImGui.Key._G,
-  h: ImGui.Key._H,
-  i: ImGui.Key._I,
-  j: ImGui.Key._J,
-  k: ImGui.Key._K,
-  l: ImGui.Key._L,
-  m: ImGui.Key._M,
-  n: ImGui.Key._N,
-  o: ImGui.Key._O,
-  p: ImGui.Key._P,
-  q: ImGui.Key._Q,
-  r: ImGui.Key._R,
-  s: ImGui.Key._S,
-  t: ImGui.Key._T,
-  u: ImGui.Key._U,
-  v: ImGui.Key._V,
-  w: ImGui.Key._W,
-  x: ImGui.Key._X,
-  y: ImGui.Key._Y,
-  z: ImGui.Key._Z,
-  A: ImGui.Key._A,
-  B: ImGui.Key._B,
-  C: ImGui.Key._C,
-  D: ImGui.Key._D,
-  E: ImGui.Key._E,
-  F: ImGui.Key._F,
-  G: ImGui.Key._G,
-  H: ImGui.Key._H,
-  I: ImGui.Key._I,
-  J: ImGui.Key._J,
-  K: ImGui.Key._K,
-  L: ImGui.Key._L,
-  M: ImGui.Key._M,
-  N: ImGui.Key._N,
-  O: ImGui.Key._O,
-  P: ImGui.Key._P,
-  Q: ImGui.Key._Q,
-  R: ImGui.Key._R,
-  S: ImGui.Key._S,
-  T: ImGui.Key._T,
-  U: ImGui.Key._U,
-  V: ImGui.Key._V,
-  W: ImGui.Key._W,
-  X: ImGui.Key._X,
-  Y: ImGui.Key._Y,
-  Z: ImGui.Key._Z,
-  "'": ImGui.Key._Apostrophe,
-  ",": ImGui.Key._Comma,
-  "-": ImGui.Key._Minus,
-  ".": ImGui.Key._Period,
-  "/": ImGui.Key._Slash,
-  ";": ImGui.Key._Semicolon,
-  "=": ImGui.Key._Equal,
-  "[": ImGui.Key._LeftBracket,
-  "\\": ImGui.Key._Backslash,
-  "]": ImGui.Key._RightBracket,
-  "`": ImGui.Key._GraveAccent,
+  /**
+   * Sets a field, the `Want*` flags to whether the value is non-zero.
+   */
+  Set(field: IOField, value: number): void {
+    this.#updateViews();
+    const address = this.addresses[field];
+    if (field < IOField.WantCaptureMouse) {
+      this.#f32[address >> 2] = value;
+    } else {
+      this.#u8[address] = value !== 0 ? 1 : 0;
+    }
+  }
+
+  /**
+   * Reads all fields into a packed array, indexed by {@linkcode IOField}.
+   *
+   * @param out The array to fill, reuse it to avoid allocating.
+   */
+  Read(out = new Float32Array(ImGuiIOFields.#COUNT)): Float32Array {
+    for (let field = 0; field < ImGuiIOFields.#COUNT; field++) {
+      out[field] = this.Get(field as IOField);
+    }
+    return out;
+  }
+
+  /**
+   * Writes all fields from a packed array, indexed by {@linkcode IOField}.
+   */
+  Write(values: ArrayLike<number>): void {
+    for (let field = 0; field < ImGuiIOFields.#COUNT; field++) {
+      this.Set(field as IOField, values[field]);
+    }
+  }
+
+  #updateViews(): void {
+    const buffer = Mod.export.HEAPU8.buffer;
+    if (this.#u8.buffer !== buffer) {
+      this.#f32 = new Float32Array(buffer);
+      this.#u8 = new Uint8Array(buffer);
+    }
+  }
+}
+
+/**
+ * Wrappers of the structs owned by the current Dear ImGui context. `ImGui.GetIO()`,
+ * `ImGui.GetPlatformIO()` and `ImGui.GetStyle()` return them instead of wrapping a new embind
+ * handle on every call. They are recreated when the current context changes.
+ */
+const ContextStructs = {
+  context: 0,
+  io: null as ImGuiIO | null,
+  ioFields: null as ImGuiIOFields | null,
+  platformIO: null as ImGuiPlatformIO | null,
+  style: null as ImGuiStyle | null,
+
+  /**
+   * Returns the wrappers of the current context, cleared if it changed since the last call.
+   */
+  Current(): typeof ContextStructs {
+    const context = Mod.export.get_current_context_address();
+    if (context !== ContextStructs.context) {
+      ContextStructs.context = context;
+      ContextStructs.io = null;
+      ContextStructs.ioFields = null;
+      ContextStructs.platformIO = null;
+      ContextStructs.style = null;
+    }
+    return ContextStructs;
+  },
+};
+
+/**
+ * Object containing some state information for jsimgui. Users most likely don't need to worry
+ * about this.
+ */
+export const State = {
+  canvas: null as HTMLCanvasElement | OffscreenCanvas | null,
+  device: null as GPUDevice | null,
+  backend: null as "webgl" | "webgl2" | "webgpu" | "null" | null,
+
+  beginRenderFn: null as (() => void) | null,
+  endRenderFn: null as ((passEncoder?: GPURenderPassEncoder) => void) | null,
+
+  clipboardData: "" as string,
+
+  wakeFn: null as (() => void) | null,
+
+  inputQueue: null as InputEventQueue | null,
+  inputRing: null as InputRingBuffer | null,
+
+  internedStrings: new Map<string, ImStrHandle>(),
+  internedHandles: [] as string[],
+
+  saveIniSettingsFn: null as ((iniData: string) => void) | null,
+  loadIniSettingsFn: null as (() => string) | null,
+};
+
+/**
+ * Options for loading a texture.
+ */
+export interface TextureOptions {
+  /**
+   * The texture reference to update. Only required if you want to update an existing texture.
+   */
+  ref?: ImTextureRef;
+
+  /**
+   * The width of the texture. This needs to be specified if the texture is loaded
+   * from a `Uint8Array`.
+   */
+  width?: number;
+
+  /**
+   * The height of the texture. This needs to be specified if the texture is loaded
+   * from a `Uint8Array`.
+   */
+  height?: number;
+
+  /**
+   * Custom load function to use for loading the texture/image. You can use this if you require
+   * additional processing. Note that you will need to write backend-specific code for this.
+   *
+   * @param data The image data to load.
+   * @param options The options for loading the texture.
+   * @returns The ImTextureID of the loaded image.
+   */
+  processFn?: (
+    data?: HTMLImageElement | Uint8Array,
+    options?: TextureOptions,
+  ) => WebGLTexture | [GPUTexture, GPUTextureView];
+}
+
+/**
+ * Object containing memory information of the WASM heap, mallinfo and stack.
+ */
+interface MemoryInfo {
+  heap: {
+    size: number;
+    max: number;
+    sbrk_ptr: number;
+  };
+  mall: {
+    arena: number;
+    ordblks: number;
+    smblks: number;
+    hblks: number;
+    hblkhd: number;
+    usmblks: number;
+    fsmblks: number;
+    uordblks: number;
+    fordblks: number;
+    keepcost: number;
+  };
+  stack: {
+    base: number;
+    end: number;
+    current: number;
+    free: number;
+  };
+  /**
+   * The arena of the per-call binding temporaries. `peak` is the most bytes a single call used,
+   * `mallocs` only increases while the arena grows, it stays the same for steady-state frames.
+   */
+  arena: {
+    capacity: number;
+    used: number;
+    peak: number;
+    mallocs: number;
+  };
+  /**
+   * The heap allocations of Dear ImGui and of the bindings. `peak` is the high-water mark of the
+   * `live` bytes since the last {@linkcode ImGuiImplWeb.ResetMemoryPeak}. Only `counted` in
+   * instrumented builds (`build.ts --instrument`), which replace the allocator, zero otherwise.
+   */
+  alloc: {
+    counted: boolean;
+    allocs: number;
+    frees: number;
+    live: number;
+    peak: number;
+  };
+}
 
-  CapsLock: ImGui.Key._CapsLock,
-  ScrollLock: ImGui.Key._ScrollLock,
-  NumLock: ImGui.Key._NumLock,
-  PrintScreen: ImGui.Key._PrintScreen,
-  Pause: ImGui.Key._Pause,
+/**
+ * Call count and cumulative time of a binding, see {@linkcode ImGuiImplWeb.GetBindingStats}.
+ */
+export interface BindingStats {
+  /**
+   * The name of the binding, e.g. `ImGui_Text` or `ImGui_SliderFloat_View`.
+   */
+  name: string;
+  calls: number;
+  /**
+   * Cumulative time in milliseconds, only measured while {@linkcode ImGuiImplWeb.SetBindingTiming}
+   * is enabled.
+   */
+  time: number;
+}
 
-  Tab: ImGui.Key._Tab,
-  ArrowLeft: ImGui.Key._LeftArrow,
-  ArrowRight: ImGui.Key._RightArrow,
-  ArrowUp: ImGui.Key._UpArrow,
-  ArrowDown: ImGui.Key._DownArrow,
-  PageUp: ImGui.Key._PageUp,
-  PageDown: ImGui.Key._PageDown,
-  Home: ImGui.Key._Home,
-  End: ImGui.Key._End,
-  Insert: ImGui.Key._Insert,
-  Delete: ImGui.Key._Delete,
-  Backspace: ImGui.Key._Backspace,
-  " ": ImGui.Key._Space,
-  Enter: ImGui.Key._Enter,
-  Escape: ImGui.Key._Escape,
+/**
+ * Initialization options for jsimgui used in {@linkcode ImGuiImplWeb.Init}.
+ */
+export interface InitOptions {
+  /**
+   * The canvas element to render Dear ImGui on. Without a canvas, jsimgui runs headless with the
+   * `null` backend, e.g. under Node.js for tests and benchmarks.
+   */
+  canvas?: HTMLCanvasElement | OffscreenCanvas;
 
-  Control: ImGui.Key._LeftCtrl,
-  Shift: ImGui.Key._LeftShift,
-  Alt: ImGui.Key._LeftAlt,
-  Super: ImGui.Key._LeftSuper,
-  Meta: ImGui.Key._LeftSuper,
-} as const;
+  /**
+   * The display size used when running headless without a canvas.
+   *
+   * Default is `1280x720`.
+   */
+  displaySize?: ImVec2;
+
+  /**
+   * The WebGPU device used for rendering. This is only required when using the WebGPU backend.
+   */
+  device?: GPUDevice;
+
+  /**
+   * Specify the rendering backend to use. If not specified, will be inferred from the canvas or
+   * from {@linkcode device}. The `null` backend renders nothing, see {@linkcode ImGuiImplNull}.
+   */
+  backend?: "webgl" | "webgl2" | "webgpu" | "null";
+
+  /**
+   * The font loader and rasterizer to use for loading fonts. Can be one of the following:
+   *
+   * - `truetype` (stb_truetype) is the default option.
+   * - `freetype` (FreeType) is an alternative option which supports more features than `truetype`
+   * but this also loads an increased WASM file (+500kb).
+   *
+   * Default is `truetype`.
+   */
+  fontLoader?: "truetype" | "freetype";
+
+  /**
+   * Whether to enable Dear ImGui extensions (imnodes, implot, ...).
+   */
+  extensions?: boolean;
+
+  /**
+   * Whether to load the split build (`build.ts --split`). Its core module leaves out the demo
+   * window, the backends and the extensions, which are loaded as side modules only when the chosen
+   * backend and options need them.
+   *
+   * Default is `false`.
+   */
+  split?: boolean;
+
+  /**
+   * Whether to load the loader with a standalone `.wasm` file (`build.ts --wasm`) instead of the
+   * WASM inlined as base64. The `.wasm` is smaller to download and compiled while it streams in.
+   *
+   * Default is `false`.
+   */
+  wasm?: boolean;
+
+  /**
+   * Whether to load the pthreads loader (`build.ts --pthread`), whose memory is a
+   * `SharedArrayBuffer`. Used by the async sorts of {@linkcode TableSorter}.
+   *
+   * Default is `false`.
+   */
+  pthread?: boolean;
+
+  /**
+   * Whether to load the SIMD loader (`build.ts --simd`), which vectorizes the string scan of
+   * {@linkcode TextFilterIndex}. Falls back to the regular loader on engines without WASM SIMD.
+   *
+   * Default is `false`.
+   */
+  simd?: boolean;
+
+  /**
+   * Name of a Cache Storage cache to keep the `.wasm` in, for the loaders with a standalone `.wasm`
+   * file. Repeat startups then skip the download and the browser can reuse its compiled code.
+   * Entries are keyed by URL, so change the name when updating jsimgui, e.g. `"jsimgui-0.13.0"`.
+   */
+  wasmCache?: string;
+
+  /**
+   * Whether to load the demo window (`ImGui.ShowDemoWindow` etc.) with the split build. The other
+   * builds always include it.
+   *
+   * Default is `false`.
+   */
+  enableDemos?: boolean;
+
+  /**
+   * Custom path to the emscripten loader script. If not provided, will be constructed
+   * automatically. If you use jsimgui via a package manager or CDN, you will most likely not
+   * need to worry about this.
+   */
+  loaderPath?: string;
+
+  /**
+   * Whether to hash the draw data to find what changed since the last hashed frame. If nothing
+   * changed, {@linkcode ImGuiImplWeb.DrawDataChanged} returns `false`, so custom renderers can skip
+   * re-uploading their buffers. A frame is only hashed when its changes are asked for, through
+   * {@linkcode ImGuiImplWeb.DrawDataChanged}, a draw data view or {@linkcode ImGuiImplWeb.RunLazy}.
+   * {@linkcode ImGuiImplWeb.EndRender} always renders, as hosts clear the canvas every frame and
+   * the backends process texture updates while rendering. The bundled backends upload the whole
+   * frame either way.
+   *
+   * Default is `false`.
+   */
+  diffDrawData?: boolean;
+}
 
 /**
- * Map of browser keyboard modifier key values to ImGui key modifier enums.
- * For reference, see {@link https://developer.mozilla.org/en-US/docs/Web/API/KeyboardEvent/key}.
+ * This infers the backend to use for the given configuration.
+ *
+ * @param canvas The canvas element to infer the backend from.
+ * @param device The WebGPU device to use. This overrides the backend to WebGPU.
+ * @param backend The backend to use. This will explicitly use this backend.
+ * @returns The backend to use.
  */
-const KEYBOARD_MODIFIER_MAP = {
-  Control: ImGui.Key.ImGuiMod_Ctrl,
-  Shift: ImGui.Key.ImGuiMod_Shift,
-  Alt: ImGui.Key.ImGuiMod_Alt,
-  Super: ImGui.Key.ImGuiMod_Super,
-  Meta: ImGui.Key.ImGuiMod_Super,
-} as const;
+const getUsedBackend = (
+  canvas: HTMLCanvasElement | OffscreenCanvas,
+  device?: GPUDevice,
+  backend?: "webgl" | "webgl2" | "webgpu" | "null",
+): "webgl" | "webgl2" | "webgpu" | "null" => {
+  if (backend) return backend;
+  if (device) return "webgpu";
 
-const metaKeyInfo = {
-  isDown: false,
+  const ctx =
+    canvas.getContext("webgl2") ||
+    canvas.getContext("webgl") ||
+    canvas.getContext("webgpu") ||
+    canvas.getContext("2d") ||
+    canvas.getContext("bitmaprenderer");
+
+  if (ctx instanceof WebGLRenderingContext) return "webgl";
+  if (ctx instanceof WebGL2RenderingContext) return "webgl2";
+  if (ctx instanceof GPUCanvasContext) return "webgpu";
+
+  if (ctx instanceof CanvasRenderingContext2D) {
+    throw new Error("jsimgui: 2D canvas context is not supported.");
+  }
+  if (ctx instanceof ImageBitmapRenderingContext) {
+    throw new Error("jsimgui: ImageBitmapRenderingContext is not supported.");
+  }
+
+  return "webgl2";
 };
 
 /**
- * Forwards keyboard events to Dear ImGui. This is both used for normal keyboard events as well as
- * for the virtual keyboard, see {@linkcode setupKeyboardIO} and {@linkcode setupTouchIO}.
+ * This initializes the WebGL/WebGL2 backend.
  *
- * @param event The keyboard event to handle.
- * @param keyDown Whether the key is being pressed or released.
- * @param io The {@linkcode ImGuiIO} object to forward the event to.
+ * @param canvas The canvas element to initialize the WebGL/WebGL2 backend on.
  */
-const handleKeyboardEvent = (event: KeyboardEvent, keyDown: boolean, io: ImGuiIO) => {
-  if (!Object.hasOwn(KEYBOARD_MAP, event.key)) {
-    return;
-  }
-
-  if (event.key === "Meta") {
-    metaKeyInfo.isDown = keyDown;
+const initWebGL = (canvas: HTMLCanvasElement | OffscreenCanvas) => {
+  const ctx = canvas.getContext("webgl2") || canvas.getContext("webgl");
+  if (!ctx) {
+    throw new Error("jsimgui: Could not create WebGL/WebGL2 context.");
   }
 
-  io.AddKeyEvent(KEYBOARD_MAP[event.key as keyof typeof KEYBOARD_MAP], keyDown);
+  const handle = Mod.export.GL.registerContext(
+    ctx,
+    ctx.getContextAttributes() as WebGLContextAttributes,
+  ) as number;
 
-  // NOTE: We lift the key when the meta key is pressed, because on macOS the browsers
-  // 'keyup' events are not fired for other keys when meta key is held down.
-  // see: https://stackoverflow.com/q/11818637.
-  if (metaKeyInfo.isDown) {
-    io.AddKeyEvent(KEYBOARD_MAP[event.key as keyof typeof KEYBOARD_MAP], false);
-  }
+  Mod.export.GL.makeContextCurrent(handle);
+  ImGuiImplOpenGL3.Init();
 
-  const modifier = KEYBOARD_MODIFIER_MAP[event.key as keyof typeof KEYBOARD_MODIFIER_MAP];
-  if (modifier) {
-    io.AddKeyEvent(modifier, keyDown);
-  }
+  State.beginRenderFn = () => {
+    ImGuiImplOpenGL3.NewFrame();
+  };
 
-  if (event.key.length === 1 && keyDown) {
-    io.AddInputCharactersUTF8(event.key);
-  }
-};
+  State.endRenderFn = () => {
+    ImGuiImplOpenGL3.RenderDrawData(ImGui.GetDrawData());
+  };
 
-const setDisplayProperties = (canvas: HTMLCanvasElement) => {
-  const io = ImGui.GetIO();
-  const width = Math.floor(canvas.clientWidth);
-  const height = Math.floor(canvas.clientHeight);
-  io.DisplaySize = new ImVec2(width, height);
+  State.canvas = canvas;
 };
 
 /**
- * Handles mouse button events.
+ * This initializes the WebGPU backend.
  *
- * @param event The mouse event to handle.
- * @param isDown Whether the button is being pressed or released.
- * @param io The {@linkcode ImGuiIO} object to forward the event to.
+ * @param canvas The canvas element to initialize the WebGPU backend on.
+ * @param device The WebGPU device to use.
  */
-const handleMouseButtonEvent = (event: MouseEvent, isDown: boolean, io: ImGuiIO) => {
-  if (!Object.hasOwn(MOUSE_BUTTON_MAP, event.button)) {
-    return;
+const initWebGPU = (
+  canvas: HTMLCanvasElement | OffscreenCanvas,
+  device: GPUDevice | undefined,
+) => {
+  if (!device) {
+    throw new Error("jsimgui: WebGPU device is not provided.");
   }
 
-  io.AddMouseButtonEvent(MOUSE_BUTTON_MAP[event.button as keyof typeof MOUSE_BUTTON_MAP], isDown);
+  ImGuiImplWGPU.Init(device);
+
+  State.beginRenderFn = () => {
+    ImGuiImplWGPU.NewFrame();
+  };
+
+  State.endRenderFn = (passEncoder?: GPURenderPassEncoder) => {
+    ImGuiImplWGPU.RenderDrawData(ImGui.GetDrawData(), passEncoder as GPURenderPassEncoder);
+  };
+
+  State.canvas = canvas;
+  State.device = device;
 };
 
 /**
- * Sets up mouse key, wheel input and movement. Also handles cursor style changes.
+ * This initializes the null backend, which renders nothing.
  *
- * @param canvas The canvas element to set up.
+ * @param canvas The canvas element used for the display size and input, if any.
  */
-const setupMouseIO = (canvas: HTMLCanvasElement) => {
-  const io = ImGui.GetIO();
-  const scrollSpeed = 0.01;
+const initNull = (canvas?: HTMLCanvasElement | OffscreenCanvas) => {
+  ImGuiImplNull.Init();
+
+  State.beginRenderFn = () => {
+    ImGuiImplNull.NewFrame();
+  };
+
+  State.endRenderFn = () => {
+    ImGuiImplNull.RenderDrawData(ImGui.GetDrawData());
+  };
+
+  State.canvas = canvas ?? null;
+};
+
+/**
+ * Whether jsimgui runs under Node.js instead of a browser.
+ */
+const isNode = (): boolean => {
+  const process = (globalThis as { process?: { versions?: { node?: string } } }).process;
+  return typeof process?.versions?.node === "string";
+};
+
+/**
+ * Number of 32-bit words per draw command in {@linkcode ImDrawListView.CmdBuffer}.
+ */
+export const IMDRAWCMD_STRIDE = 8;
+
+/**
+ * Views onto the buffers of a single `ImDrawList` in the WASM heap.
+ */
+export interface ImDrawListView {
+  /**
+   * Interleaved vertices of 5 floats each: pos.x, pos.y, uv.x, uv.y and the packed color.
+   */
+  VtxBuffer: Float32Array;
+
+  /**
+   * The same vertices as bytes, the RGBA color of a vertex starts at byte offset 16 (stride 20).
+   */
+  VtxBytes: Uint8Array;
+
+  /**
+   * The 16-bit vertex indices.
+   */
+  IdxBuffer: Uint16Array;
+
+  /**
+   * The draw commands, {@linkcode IMDRAWCMD_STRIDE} words each: ClipRect (4 floats), texture id,
+   * ElemCount, IdxOffset and VtxOffset. Read the clip rect through
+   * {@linkcode ImDrawListView.CmdFloats}. Commands with a user callback have an ElemCount of 0.
+   */
+  CmdBuffer: Int32Array;
+
+  /**
+   * The draw commands as floats, for reading the clip rect.
+   */
+  CmdFloats: Float32Array;
+
+  /**
+   * Whether the content changed since the last frame. Always `true` unless
+   * {@linkcode InitOptions.diffDrawData} is enabled, the GPU buffers of unchanged lists can be
+   * kept as they are.
+   */
+  Changed: boolean;
+}
+
+/**
+ * Views onto the draw data of a frame in the WASM heap, see
+ * {@linkcode ImGuiImplWeb.GetDrawDataView}.
+ */
+export interface ImDrawDataView {
+  DisplayPos: ImVec2;
+  DisplaySize: ImVec2;
+  FramebufferScale: ImVec2;
+  TotalVtxCount: number;
+  TotalIdxCount: number;
+  CmdLists: ImDrawListView[];
+}
 
-  canvas.addEventListener("pointermove", (e) => {
-    const rect = canvas.getBoundingClientRect();
-    io.AddMousePosEvent(e.clientX - rect.left, e.clientY - rect.top);
+/**
+ * Views onto all draw lists of a frame merged into single buffers, see
+ * {@linkcode ImGuiImplWeb.GetMergedDrawDataView}. The offsets of the commands refer to the merged
+ * buffers. If the frame has no more than 65536 vertices, the indices are already rebased and all
+ * VtxOffsets are 0.
+ */
+export interface ImMergedDrawDataView extends ImDrawListView {
+  DisplayPos: ImVec2;
+  DisplaySize: ImVec2;
+  FramebufferScale: ImVec2;
+  TotalVtxCount: number;
+  TotalIdxCount: number;
+}
 
-    canvas.style.cursor = MOUSE_CURSOR_MAP[ImGui.GetMouseCursor()];
-  });
+/**
+ * Opcodes of the command buffer. Keep in sync with `command_op` in imgui.cpp.
+ */
+const CommandOp = {
+  Begin: 1,
+  End: 2,
+  BeginChild: 3,
+  EndChild: 4,
+  Text: 5,
+  TextColored: 6,
+  TextDisabled: 7,
+  TextWrapped: 8,
+  LabelText: 9,
+  BulletText: 10,
+  SeparatorText: 11,
+  Button: 12,
+  SmallButton: 13,
+  Checkbox: 14,
+  RadioButton: 15,
+  SliderFloat: 16,
+  SliderInt: 17,
+  DragFloat: 18,
+  DragInt: 19,
+  Selectable: 20,
+  TreeNode: 21,
+  TreePop: 22,
+  CollapsingHeader: 23,
+  Separator: 24,
+  SameLine: 25,
+  NewLine: 26,
+  Spacing: 27,
+  Dummy: 28,
+  Indent: 29,
+  Unindent: 30,
+  PushID: 31,
+  PopID: 32,
+  SetNextItemWidth: 33,
+  PushStyleColor: 34,
+  PopStyleColor: 35,
+  IsItemHovered: 36,
+  IsItemClicked: 37,
+  BeginTable: 38,
+  EndTable: 39,
+  TableNextRow: 40,
+  TableNextColumn: 41,
+  TableSetColumnIndex: 42,
+  TableSetupColumn: 43,
+  TableHeadersRow: 44,
+  ProgressBar: 45,
+  BeginMenuBar: 46,
+  EndMenuBar: 47,
+  BeginMenu: 48,
+  EndMenu: 49,
+  MenuItem: 50,
+} as const;
 
-  canvas.addEventListener("pointerdown", (e) => handleMouseButtonEvent(e, true, io));
-  canvas.addEventListener("pointerup", (e) => handleMouseButtonEvent(e, false, io));
-  canvas.addEventListener("wheel", (e) =>
-    io.AddMouseWheelEvent(-e.deltaX * scrollSpeed, -e.deltaY * scrollSpeed),
-  );
-};
+const textEncoder = new TextEncoder();
 
 /**
- * Sets up keyboard input handling. Browser keyboard events are handled by
- * {@linkcode handleKeyboardEvent}.
- *
- * @param canvas The canvas element to set up.
+ * Handle of a string interned with {@linkcode ImGuiImplWeb.Intern}.
  */
-const setupKeyboardIO = (canvas: HTMLCanvasElement) => {
-  const io = ImGui.GetIO();
-
-  // Swap super and ctrl keys on macOS.
-  if (navigator.userAgent.includes("Mac")) {
-    io.ConfigMacOSXBehaviors = true;
-  }
+export type ImStrHandle = number;
 
-  // TODO: Fix too fast repeated inputs (Backspace, Delete...).
-  canvas.addEventListener("keydown", (e) => handleKeyboardEvent(e, true, io));
-  canvas.addEventListener("keyup", (e) => handleKeyboardEvent(e, false, io));
-};
+/**
+ * Returns the string of an {@linkcode ImStrHandle}, or the string itself. Functions taking several
+ * strings resolve their handles with this when mixing handles and strings.
+ */
+const getString = (value: string | ImStrHandle): string =>
+  typeof value === "number" ? (State.internedHandles[value] ?? "") : value;
 
 /**
- * Sets up touch input handling as well as showing the virtual keyboard. Note the following:
+ * Records Dear ImGui calls into a buffer in the WASM heap and runs all of them with a single
+ * call into WASM in {@linkcode ImGuiCommandBuffer.Execute}. Calls which return a value give
+ * back a result slot, read it with {@linkcode ImGuiCommandBuffer.GetBool} & co. after executing.
  *
- * - Single-finger touches are treated as mouse left clicks.
- * - Two-finger touches are treated as mouse scrolls.
+ * Strings can be passed as {@linkcode ImStrHandle} to skip encoding constant labels every frame.
  *
- * @param canvas The canvas element to set up.
+ * ```js
+ * const cmd = ImGuiCommandBuffer.New();
+ * const label = ImGuiImplWeb.Intern("Click me");
+ *
+ * // In the render loop:
+ * cmd.Begin("Window");
+ * const clicked = cmd.Button(label);
+ * cmd.End();
+ * cmd.Execute();
+ * if (cmd.GetBool(clicked)) { ... }
+ * ```
  */
-const setupTouchIO = (canvas: HTMLCanvasElement) => {
-  const io = ImGui.GetIO();
-  const scrollSpeed = 0.02;
-  let lastPos = { x: 0, y: 0 };
+export class ImGuiCommandBuffer {
+  /**
+   * The address of the command words in the WASM heap, followed by the result words.
+   */
+  ptr = 0;
 
-  const handleTouchEvent = (event: TouchEvent, isButtonDown?: boolean) => {
-    event.preventDefault();
-    const rect = canvas.getBoundingClientRect();
+  /**
+   * The capacity of the command and result words each.
+   */
+  capacity = 0;
 
-    if (event.touches.length === 2) {
-      const touch1 = event.touches[0];
-      const touch2 = event.touches[1];
+  /**
+   * The number of recorded command words.
+   */
+  length = 0;
 
-      const currentPos = {
-        x: (touch1.clientX + touch2.clientX) / 2,
-        y: (touch1.clientY + touch2.clientY) / 2,
-      };
+  #slots = 0;
+  #i32 = new Int32Array(0);
+  #f32 = new Float32Array(0);
+  #u8 = new Uint8Array(0);
 
-      if (lastPos.x > 0 && lastPos.y > 0) {
-        const deltaX = (lastPos.x - currentPos.x) * scrollSpeed;
-        const deltaY = (lastPos.y - currentPos.y) * scrollSpeed;
-        io.AddMouseWheelEvent(-deltaX, -deltaY);
-      }
+  /**
+   * Allocate a new command buffer.
+   *
+   * @param capacity The initial capacity in 32-bit words, grows as needed.
+   */
+  static New(capacity = 4096): ImGuiCommandBuffer {
+    const cmd = new ImGuiCommandBuffer();
+    cmd.capacity = capacity;
+    cmd.ptr = Mod.export.heap_alloc(capacity * 8);
+    return cmd;
+  }
 
-      lastPos = currentPos;
-      return;
+  /**
+   * Free the command buffer's native allocated memory.
+   */
+  Drop(): void {
+    Mod.export.heap_free(this.ptr);
+    this.ptr = 0;
+  }
+
+  /**
+   * Executes all recorded commands and clears the buffer for the next frame. The results stay
+   * readable until the next call.
+   */
+  Execute(): void {
+    const count = Mod.export.ExecuteCommandBuffer(
+      this.ptr,
+      this.length,
+      this.ptr + this.capacity * 4,
+    );
+
+    if (count < 0) {
+      throw new Error("jsimgui: Invalid opcode or truncated arguments in command buffer.");
     }
 
-    lastPos = { x: 0, y: 0 };
-    const touch = event.touches[0];
+    this.length = 0;
+    this.#slots = 0;
+  }
 
-    if (touch) {
-      io.AddMousePosEvent(touch.clientX - rect.left, touch.clientY - rect.top);
-    }
+  /**
+   * Returns a boolean result of the last {@linkcode ImGuiCommandBuffer.Execute}.
+   */
+  GetBool(slot: number): boolean {
+    return this.GetInt(slot) !== 0;
+  }
 
-    if (typeof isButtonDown === "boolean") {
-      io.AddMouseButtonEvent(ImGui.MouseButton.Left, isButtonDown);
-    }
-  };
+  /**
+   * Returns an integer result of the last {@linkcode ImGuiCommandBuffer.Execute}.
+   */
+  GetInt(slot: number): number {
+    this.#updateViews();
+    return this.#i32[(this.ptr >> 2) + this.capacity + slot];
+  }
 
-  // Since the Virtual Keyboard API isn't widely supported yet, we use an invisible
-  // <input> element to show the on-screen keyboard and handle the text input.
-  // See: https://developer.mozilla.org/en-US/docs/Web/API/VirtualKeyboard_API
-  const input = document.createElement("input");
-  input.style.position = "absolute";
-  input.style.opacity = "0";
-  input.style.pointerEvents = "none";
+  /**
+   * Returns a float result of the last {@linkcode ImGuiCommandBuffer.Execute}.
+   */
+  GetFloat(slot: number): number {
+    this.#updateViews();
+    return this.#f32[(this.ptr >> 2) + this.capacity + slot];
+  }
 
-  const keyDownHandler = (e: KeyboardEvent) => handleKeyboardEvent(e, true, io);
-  const keyUpHandler = (e: KeyboardEvent) => handleKeyboardEvent(e, false, io);
-  const blurHandler = () => {
-    input.removeEventListener("keydown", keyDownHandler);
-    input.removeEventListener("keyup", keyUpHandler);
-    input.remove();
-  };
+  #updateViews(): void {
+    const buffer = Mod.export.HEAPU8.buffer;
+    if (this.#i32.buffer !== buffer) {
+      this.#i32 = new Int32Array(buffer);
+      this.#f32 = new Float32Array(buffer);
+      this.#u8 = new Uint8Array(buffer);
+    }
+  }
 
-  const handleTextInput = () => {
-    if (io.WantTextInput) {
-      document.body.appendChild(input);
-      input.focus();
+  #reserve(words: number): void {
+    if (this.length + words > this.capacity) {
+      const capacity = Math.max(this.capacity * 2, this.length + words);
+      const ptr = Mod.export.heap_alloc(capacity * 8);
 
-      input.addEventListener("blur", blurHandler);
-      input.addEventListener("keydown", keyDownHandler);
-      input.addEventListener("keyup", (e) => {
-        keyUpHandler(e);
+      this.#updateViews();
+      this.#i32.copyWithin(ptr >> 2, this.ptr >> 2, (this.ptr >> 2) + this.length);
+      Mod.export.heap_free(this.ptr);
 
-        // Exits single-line input fields when pressing Enter.
-        if (!io.WantTextInput) {
-          blurHandler();
-        }
-      });
-    } else {
-      blurHandler();
+      this.ptr = ptr;
+      this.capacity = capacity;
     }
-  };
 
-  canvas.addEventListener("touchstart", (e) => handleTouchEvent(e, true));
-  canvas.addEventListener("touchmove", (e) => handleTouchEvent(e));
+    this.#updateViews();
+  }
 
-  canvas.addEventListener("touchend", (e) => {
-    lastPos = { x: 0, y: 0 };
-    handleTouchEvent(e, false);
-    handleTextInput();
-  });
+  #op(op: number, results = 0): number {
+    this.#int(op);
 
-  canvas.addEventListener("touchcancel", (e) => {
-    lastPos = { x: 0, y: 0 };
-    handleTouchEvent(e, false);
-  });
-};
+    const slot = this.#slots;
+    this.#slots += results;
+    return slot;
+  }
 
-/**
- * Sets up the clipboard functionality to work between the browser and Dear ImGui.
- */
-const setupClipboardIO = () => {
-  const getClipboard = (): string => {
-    return State.clipboardData;
-  };
+  #int(value: number): void {
+    this.#reserve(1);
+    this.#i32[(this.ptr >> 2) + this.length++] = value;
+  }
 
-  const setClipboard = (text: string) => {
-    navigator.clipboard.writeText(text);
-    State.clipboardData = text;
-  };
+  #float(value: number): void {
+    this.#reserve(1);
+    this.#f32[(this.ptr >> 2) + this.length++] = value;
+  }
 
-  Mod.export.SetupClipboardFunctions(getClipboard, setClipboard);
+  #vec2(value: ImVec2): void {
+    this.#float(value.x);
+    this.#float(value.y);
+  }
 
-  document.addEventListener("paste", (e) => {
-    State.clipboardData = e.clipboardData?.getData("text/plain") ?? "";
-  });
-};
+  #str(value: string | ImStrHandle): void {
+    if (typeof value === "number") {
+      this.#int(value);
+      return;
+    }
 
-/**
- * Sets up Dear ImGui for the browser. This includes:
- * - Setting up the canvas and resize events.
- * - Setting up mouse input, movement and cursor handling.
- * - Setting up keyboard input handling.
- * - Setting up touch input handling.
- *
- * This function is called by {@linkcode ImGuiImplWeb.Init}.
- *
- * @param canvas The canvas element to set up.
- */
-const setupBrowserIO = (canvas: HTMLCanvasElement) => {
-  const io = ImGui.GetIO();
-  io.BackendFlags = ImGui.BackendFlags.HasMouseCursors;
+    // Worst case is 3 UTF-8 bytes per UTF-16 code unit, plus the NUL terminator.
+    const maxBytes = value.length * 3 + 1;
+    this.#reserve(1 + Math.ceil(maxBytes / 4));
 
-  canvas.tabIndex = 1;
-  canvas.addEventListener("contextmenu", (e) => e.preventDefault());
-  canvas.addEventListener("focus", () => io.AddFocusEvent(true));
-  canvas.addEventListener("blur", () => io.AddFocusEvent(false));
+    const start = this.ptr + (this.length + 1) * 4;
+    const { written } = textEncoder.encodeInto(value, this.#u8.subarray(start, start + maxBytes));
+    this.#u8[start + written] = 0;
 
-  setDisplayProperties(canvas);
+    this.#i32[(this.ptr >> 2) + this.length] = -(written + 1);
+    this.length += 1 + Math.ceil((written + 1) / 4);
+  }
 
-  setupMouseIO(canvas);
-  setupKeyboardIO(canvas);
-  setupTouchIO(canvas);
-  setupClipboardIO();
+  Begin(name: string | ImStrHandle, flags: ImGuiWindowFlags = 0): number {
+    const slot = this.#op(CommandOp.Begin, 1);
+    this.#str(name);
+    this.#int(flags);
+    return slot;
+  }
 
-  Mod.export.SetupIniSettings();
-};
+  End(): void {
+    this.#op(CommandOp.End);
+  }
 
-/**
- * Object containing some state information for jsimgui. Users most likely don't need to worry
- * about this.
- */
-export const State = {
-  canvas: null as HTMLCanvasElement | null,
-  device: null as GPUDevice | null,
-  backend: null as "webgl" | "webgl2" | "webgpu" | null,
+  BeginChild(
+    str_id: string | ImStrHandle,
+    size: ImVec2 = new ImVec2(0, 0),
+    child_flags: ImGuiChildFlags = 0,
+    window_flags: ImGuiWindowFlags = 0,
+  ): number {
+    const slot = this.#op(CommandOp.BeginChild, 1);
+    this.#str(str_id);
+    this.#vec2(size);
+    this.#int(child_flags);
+    this.#int(window_flags);
+    return slot;
+  }
 
-  beginRenderFn: null as (() => void) | null,
-  endRenderFn: null as ((passEncoder?: GPURenderPassEncoder) => void) | null,
+  EndChild(): void {
+    this.#op(CommandOp.EndChild);
+  }
 
-  clipboardData: "" as string,
+  Text(text: string | ImStrHandle): void {
+    this.#op(CommandOp.Text);
+    this.#str(text);
+  }
 
-  saveIniSettingsFn: null as ((iniData: string) => void) | null,
-  loadIniSettingsFn: null as (() => string) | null,
-};
+  TextColored(col: ImVec4, text: string | ImStrHandle): void {
+    this.#op(CommandOp.TextColored);
+    this.#float(col.x);
+    this.#float(col.y);
+    this.#float(col.z);
+    this.#float(col.w);
+    this.#str(text);
+  }
 
-/**
- * Options for loading a texture.
- */
-export interface TextureOptions {
-  /**
-   * The texture reference to update. Only required if you want to update an existing texture.
-   */
-  ref?: ImTextureRef;
+  TextDisabled(text: string | ImStrHandle): void {
+    this.#op(CommandOp.TextDisabled);
+    this.#str(text);
+  }
 
-  /**
-   * The width of the texture. This needs to be specified if the texture is loaded
-   * from a `Uint8Array`.
-   */
-  width?: number;
+  TextWrapped(text: string | ImStrHandle): void {
+    this.#op(CommandOp.TextWrapped);
+    this.#str(text);
+  }
 
-  /**
-   * The height of the texture. This needs to be specified if the texture is loaded
-   * from a `Uint8Array`.
-   */
-  height?: number;
+  LabelText(label: string | ImStrHandle, text: string | ImStrHandle): void {
+    this.#op(CommandOp.LabelText);
+    this.#str(label);
+    this.#str(text);
+  }
 
-  /**
-   * Custom load function to use for loading the texture/image. You can use this if you require
-   * additional processing. Note that you will need to write backend-specific code for this.
-   *
-   * @param data The image data to load.
-   * @param options The options for loading the texture.
-   * @returns The ImTextureID of the loaded image.
-   */
-  processFn?: (
-    data?: HTMLImageElement | Uint8Array,
-    options?: TextureOptions,
-  ) => WebGLTexture | [GPUTexture, GPUTextureView];
-}
+  BulletText(text: string | ImStrHandle): void {
+    this.#op(CommandOp.BulletText);
+    this.#str(text);
+  }
 
-/**
- * Object containing memory information of the WASM heap, mallinfo and stack.
- */
-interface MemoryInfo {
-  heap: {
-    size: number;
-    max: number;
-    sbrk_ptr: number;
-  };
-  mall: {
-    arena: number;
-    ordblks: number;
-    smblks: number;
-    hblks: number;
-    hblkhd: number;
-    usmblks: number;
-    fsmblks: number;
-    uordblks: number;
-    fordblks: number;
-    keepcost: number;
-  };
-  stack: {
-    base: number;
-    end: number;
-    current: number;
-    free: number;
-  };
-}
+  SeparatorText(label: string | ImStrHandle): void {
+    this.#op(CommandOp.SeparatorText);
+    this.#str(label);
+  }
+
+  Button(label: string | ImStrHandle, size: ImVec2 = new ImVec2(0, 0)): number {
+    const slot = this.#op(CommandOp.Button, 1);
+    this.#str(label);
+    this.#vec2(size);
+    return slot;
+  }
+
+  SmallButton(label: string | ImStrHandle): number {
+    const slot = this.#op(CommandOp.SmallButton, 1);
+    this.#str(label);
+    return slot;
+  }
 
-/**
- * Initialization options for jsimgui used in {@linkcode ImGuiImplWeb.Init}.
- */
-export interface InitOptions {
   /**
-   * The canvas element to render Dear ImGui on.
+   * Result slot is whether the value changed, the next slot holds the new value.
    */
-  canvas: HTMLCanvasElement;
+  Checkbox(label: string | ImStrHandle, value: boolean): number {
+    const slot = this.#op(CommandOp.Checkbox, 2);
+    this.#str(label);
+    this.#int(value ? 1 : 0);
+    return slot;
+  }
+
+  RadioButton(label: string | ImStrHandle, active: boolean): number {
+    const slot = this.#op(CommandOp.RadioButton, 1);
+    this.#str(label);
+    this.#int(active ? 1 : 0);
+    return slot;
+  }
 
   /**
-   * The WebGPU device used for rendering. This is only required when using the WebGPU backend.
+   * Result slot is whether the value changed, the next slot holds the new value.
    */
-  device?: GPUDevice;
+  SliderFloat(
+    label: string | ImStrHandle,
+    value: number,
+    v_min: number,
+    v_max: number,
+    format: string | ImStrHandle = "%.3f",
+    flags: ImGuiSliderFlags = 0,
+  ): number {
+    const slot = this.#op(CommandOp.SliderFloat, 2);
+    this.#str(label);
+    this.#float(value);
+    this.#float(v_min);
+    this.#float(v_max);
+    this.#str(format);
+    this.#int(flags);
+    return slot;
+  }
 
   /**
-   * Specify the rendering backend to use. If not specified, will be inferred from the canvas or
-   * from {@linkcode device}.
+   * Result slot is whether the value changed, the next slot holds the new value.
    */
-  backend?: "webgl" | "webgl2" | "webgpu";
+  SliderInt(
+    label: string | ImStrHandle,
+    value: number,
+    v_min: number,
+    v_max: number,
+    format: string | ImStrHandle = "%d",
+    flags: ImGuiSliderFlags = 0,
+  ): number {
+    const slot = this.#op(CommandOp.SliderInt, 2);
+    this.#str(label);
+    this.#int(value);
+    this.#int(v_min);
+    this.#int(v_max);
+    this.#str(format);
+    this.#int(flags);
+    return slot;
+  }
 
   /**
-   * The font loader and rasterizer to use for loading fonts. Can be one of the following:
-   *
-   * - `truetype` (stb_truetype) is the default option.
-   * - `freetype` (FreeType) is an alternative option which supports more features than `truetype`
-   * but this also loads an increased WASM file (+500kb).
-   *
-   * Default is `truetype`.
+   * Result slot is whether the value changed, the next slot holds the new value.
    */
-  fontLoader?: "truetype" | "freetype";
+  DragFloat(
+    label: string | ImStrHandle,
+    value: number,
+    v_speed: number = 1.0,
+    v_min: number = 0.0,
+    v_max: number = 0.0,
+    format: string | ImStrHandle = "%.3f",
+    flags: ImGuiSliderFlags = 0,
+  ): number {
+    const slot = this.#op(CommandOp.DragFloat, 2);
+    this.#str(label);
+    this.#float(value);
+    this.#float(v_speed);
+    this.#float(v_min);
+    this.#float(v_max);
+    this.#str(format);
+    this.#int(flags);
+    return slot;
+  }
 
   /**
-   * Whether to enable Dear ImGui extensions (imnodes, implot, ...).
+   * Result slot is whether the value changed, the next slot holds the new value.
    */
-  extensions?: boolean;
+  DragInt(
+    label: string | ImStrHandle,
+    value: number,
+    v_speed: number = 1.0,
+    v_min: number = 0,
+    v_max: number = 0,
+    format: string | ImStrHandle = "%d",
+    flags: ImGuiSliderFlags = 0,
+  ): number {
+    const slot = this.#op(CommandOp.DragInt, 2);
+    this.#str(label);
+    this.#int(value);
+    this.#float(v_speed);
+    this.#int(v_min);
+    this.#int(v_max);
+    this.#str(format);
+    this.#int(flags);
+    return slot;
+  }
 
-  /**
-   * Custom path to the emscripten loader script. If not provided, will be constructed
-   * automatically. If you use jsimgui via a package manager or CDN, you will most likely not
-   * need to worry about this.
-   */
-  loaderPath?: string;
-}
+  Selectable(
+    label: string | ImStrHandle,
+    selected: boolean = false,
+    flags: ImGuiSelectableFlags = 0,
+    size: ImVec2 = new ImVec2(0, 0),
+  ): number {
+    const slot = this.#op(CommandOp.Selectable, 1);
+    this.#str(label);
+    this.#int(selected ? 1 : 0);
+    this.#int(flags);
+    this.#vec2(size);
+    return slot;
+  }
 
-/**
- * This infers the backend to use for the given configuration.
- *
- * @param canvas The canvas element to infer the backend from.
- * @param device The WebGPU device to use. This overrides the backend to WebGPU.
- * @param backend The backend to use. This will explicitly use this backend.
- * @returns The backend to use.
- */
-const getUsedBackend = (
-  canvas: HTMLCanvasElement,
-  device?: GPUDevice,
-  backend?: "webgl" | "webgl2" | "webgpu",
-): "webgl" | "webgl2" | "webgpu" => {
-  if (backend) return backend;
-  if (device) return "webgpu";
+  TreeNode(label: string | ImStrHandle): number {
+    const slot = this.#op(CommandOp.TreeNode, 1);
+    this.#str(label);
+    return slot;
+  }
 
-  const ctx =
-    canvas.getContext("webgl2") ||
-    canvas.getContext("webgl") ||
-    canvas.getContext("webgpu") ||
-    canvas.getContext("2d") ||
-    canvas.getContext("bitmaprenderer");
+  TreePop(): void {
+    this.#op(CommandOp.TreePop);
+  }
 
-  if (ctx instanceof WebGLRenderingContext) return "webgl";
-  if (ctx instanceof WebGL2RenderingContext) return "webgl2";
-  if (ctx instanceof GPUCanvasContext) return "webgpu";
+  CollapsingHeader(label: string | ImStrHandle, flags: ImGuiTreeNodeFlags = 0): number {
+    const slot = this.#op(CommandOp.CollapsingHeader, 1);
+    this.#str(label);
+    this.#int(flags);
+    return slot;
+  }
 
-  if (ctx instanceof CanvasRenderingContext2D) {
-    throw new Error("jsimgui: 2D canvas context is not supported.");
+  Separator(): void {
+    this.#op(CommandOp.Separator);
   }
-  if (ctx instanceof ImageBitmapRenderingContext) {
-    throw new Error("jsimgui: ImageBitmapRenderingContext is not supported.");
+
+  SameLine(offset_from_start_x: number = 0.0, spacing: number = -1.0): void {
+    this.#op(CommandOp.SameLine);
+    this.#float(offset_from_start_x);
+    this.#float(spacing);
   }
 
-  return "webgl2";
-};
+  NewLine(): void {
+    this.#op(CommandOp.NewLine);
+  }
 
-/**
- * This initializes the WebGL/WebGL2 backend.
- *
- * @param canvas The canvas element to initialize the WebGL/WebGL2 backend on.
- */
-const initWebGL = (canvas: HTMLCanvasElement) => {
-  const ctx = canvas.getContext("webgl2") || canvas.getContext("webgl");
-  if (!ctx) {
-    throw new Error("jsimgui: Could not create WebGL/WebGL2 context.");
+  Spacing(): void {
+    this.#op(CommandOp.Spacing);
   }
 
-  const handle = Mod.export.GL.registerContext(
-    ctx,
-    ctx.getContextAttributes() as WebGLContextAttributes,
-  ) as number;
+  Dummy(size: ImVec2): void {
+    this.#op(CommandOp.Dummy);
+    this.#vec2(size);
+  }
 
-  Mod.export.GL.makeContextCurrent(handle);
-  ImGuiImplOpenGL3.Init();
+  Indent(indent_w: number = 0.0): void {
+    this.#op(CommandOp.Indent);
+    this.#float(indent_w);
+  }
 
-  State.beginRenderFn = () => {
-    ImGuiImplOpenGL3.NewFrame();
-  };
+  Unindent(indent_w: number = 0.0): void {
+    this.#op(CommandOp.Unindent);
+    this.#float(indent_w);
+  }
 
-  State.endRenderFn = () => {
-    ImGuiImplOpenGL3.RenderDrawData(ImGui.GetDrawData());
-  };
+  PushID(str_id: string | ImStrHandle): void {
+    this.#op(CommandOp.PushID);
+    this.#str(str_id);
+  }
 
-  State.canvas = canvas;
-};
+  PopID(): void {
+    this.#op(CommandOp.PopID);
+  }
 
-/**
- * This initializes the WebGPU backend.
- *
- * @param canvas The canvas element to initialize the WebGPU backend on.
- * @param device The WebGPU device to use.
- */
-const initWebGPU = (canvas: HTMLCanvasElement, device: GPUDevice | undefined) => {
-  if (!device) {
-    throw new Error("jsimgui: WebGPU device is not provided.");
+  SetNextItemWidth(item_width: number): void {
+    this.#op(CommandOp.SetNextItemWidth);
+    this.#float(item_width);
   }
 
-  ImGuiImplWGPU.Init(device);
+  PushStyleColor(idx: ImGuiCol, col: ImU32): void {
+    this.#op(CommandOp.PushStyleColor);
+    this.#int(idx);
+    this.#int(col);
+  }
 
-  State.beginRenderFn = () => {
-    ImGuiImplWGPU.NewFrame();
-  };
+  PopStyleColor(count: number = 1): void {
+    this.#op(CommandOp.PopStyleColor);
+    this.#int(count);
+  }
 
-  State.endRenderFn = (passEncoder?: GPURenderPassEncoder) => {
-    ImGuiImplWGPU.RenderDrawData(ImGui.GetDrawData(), passEncoder as GPURenderPassEncoder);
-  };
+  IsItemHovered(flags: ImGuiHoveredFlags = 0): number {
+    const slot = this.#op(CommandOp.IsItemHovered, 1);
+    this.#int(flags);
+    return slot;
+  }
 
-  State.canvas = canvas;
-  State.device = device;
-};
+  IsItemClicked(mouse_button: ImGuiMouseButton = 0): number {
+    const slot = this.#op(CommandOp.IsItemClicked, 1);
+    this.#int(mouse_button);
+    return slot;
+  }
+
+  BeginTable(
+    str_id: string | ImStrHandle,
+    columns: number,
+    flags: ImGuiTableFlags = 0,
+    outer_size: ImVec2 = new ImVec2(0.0, 0.0),
+    inner_width: number = 0.0,
+  ): number {
+    const slot = this.#op(CommandOp.BeginTable, 1);
+    this.#str(str_id);
+    this.#int(columns);
+    this.#int(flags);
+    this.#vec2(outer_size);
+    this.#float(inner_width);
+    return slot;
+  }
+
+  EndTable(): void {
+    this.#op(CommandOp.EndTable);
+  }
+
+  TableNextRow(row_flags: ImGuiTableRowFlags = 0, min_row_height: number = 0.0): void {
+    this.#op(CommandOp.TableNextRow);
+    this.#int(row_flags);
+    this.#float(min_row_height);
+  }
+
+  TableNextColumn(): number {
+    return this.#op(CommandOp.TableNextColumn, 1);
+  }
+
+  TableSetColumnIndex(column_n: number): number {
+    const slot = this.#op(CommandOp.TableSetColumnIndex, 1);
+    this.#int(column_n);
+    return slot;
+  }
+
+  TableSetupColumn(
+    label: string | ImStrHandle,
+    flags: ImGuiTableColumnFlags = 0,
+    init_width_or_weight: number = 0.0,
+    user_id: ImGuiID = 0,
+  ): void {
+    this.#op(CommandOp.TableSetupColumn);
+    this.#str(label);
+    this.#int(flags);
+    this.#float(init_width_or_weight);
+    this.#int(user_id);
+  }
+
+  TableHeadersRow(): void {
+    this.#op(CommandOp.TableHeadersRow);
+  }
+
+  ProgressBar(
+    fraction: number,
+    size_arg: ImVec2 = new ImVec2(-Number.MIN_VALUE, 0),
+    overlay: string | ImStrHandle = "",
+  ): void {
+    this.#op(CommandOp.ProgressBar);
+    this.#float(fraction);
+    this.#vec2(size_arg);
+    this.#str(overlay);
+  }
+
+  BeginMenuBar(): number {
+    return this.#op(CommandOp.BeginMenuBar, 1);
+  }
+
+  EndMenuBar(): void {
+    this.#op(CommandOp.EndMenuBar);
+  }
+
+  BeginMenu(label: string | ImStrHandle, enabled: boolean = true): number {
+    const slot = this.#op(CommandOp.BeginMenu, 1);
+    this.#str(label);
+    this.#int(enabled ? 1 : 0);
+    return slot;
+  }
+
+  EndMenu(): void {
+    this.#op(CommandOp.EndMenu);
+  }
+
+  MenuItem(
+    label: string | ImStrHandle,
+    shortcut: string | ImStrHandle = "",
+    selected: boolean = false,
+    enabled: boolean = true,
+  ): number {
+    const slot = this.#op(CommandOp.MenuItem, 1);
+    this.#str(label);
+    this.#str(shortcut);
+    this.#int(selected ? 1 : 0);
+    this.#int(enabled ? 1 : 0);
+    return slot;
+  }
+}
 
 /**
  * Object providing easy to use functions for initializing jsimgui as well as other things like
@@ -915,6 +3328,17 @@ export const ImGuiImplWeb = {
     return Mod.export;
   },
 
+  /**
+   * Loads side modules of the split build (`build.ts --split`) after
+   * {@linkcode ImGuiImplWeb.Init}, e.g. the demo window only once it's opened. Does nothing for
+   * the other builds.
+   *
+   * @param modules The side modules to load.
+   */
+  async LoadModules(...modules: SideModule[]): Promise<void> {
+    await Mod.loadModules(modules);
+  },
+
   /**
    * Returns memory information of the WASM heap, mallinfo and stack.
    *
@@ -925,9 +3349,155 @@ export const ImGuiImplWeb = {
       heap: Mod.export.get_wasm_heap_info(),
       mall: Mod.export.get_wasm_mall_info(),
       stack: Mod.export.get_wasm_stack_info(),
+      arena: Mod.export.get_wasm_arena_info(),
+      alloc: Mod.export.get_wasm_alloc_info(),
+    };
+  },
+
+  /**
+   * Returns the hottest bindings by cumulative time (or by calls while timing is disabled) since
+   * the last {@linkcode ImGuiImplWeb.ResetBindingStats}. The stats are only recorded by builds with
+   * instrumented bindings (`node build.ts --instrument`), otherwise the list is empty.
+   *
+   * @param count The number of bindings to return.
+   * @returns The bindings, hottest first.
+   */
+  GetBindingStats(count = 20): BindingStats[] {
+    return Mod.export.get_binding_stats(count);
+  },
+
+  /**
+   * Resets the call counts and times returned by {@linkcode ImGuiImplWeb.GetBindingStats}.
+   */
+  ResetBindingStats(): void {
+    Mod.export.reset_binding_stats();
+  },
+
+  /**
+   * Enables timing the instrumented bindings in addition to counting their calls. Disabled by
+   * default since reading the clock costs more than most bindings themselves.
+   *
+   * @param enabled Whether to time the bindings.
+   */
+  SetBindingTiming(enabled: boolean): void {
+    Mod.export.set_binding_timing(enabled);
+  },
+
+  /**
+   * Resets the high-water mark of the heap allocations reported by
+   * {@linkcode ImGuiImplWeb.GetMemoryInfo} to the bytes currently alive.
+   */
+  ResetMemoryPeak(): void {
+    Mod.export.reset_wasm_alloc_peak();
+  },
+
+  /**
+   * Returns the typed array access to the hot {@linkcode ImGuiIO} fields of the current context,
+   * see {@linkcode ImGuiIOFields}.
+   */
+  GetIOFields(): ImGuiIOFields {
+    const structs = ContextStructs.Current();
+    structs.ioFields ??= new ImGuiIOFields();
+    return structs.ioFields;
+  },
+
+  /**
+   * Returns views onto the vertex, index and command buffers of the draw data, for renderers
+   * uploading the Dear ImGui geometry themselves. Nothing is copied, so the views are only valid
+   * until the next frame or until the WASM memory grows.
+   *
+   * @param drawData The draw data, defaults to `ImGui.GetDrawData()`.
+   */
+  GetDrawDataView(drawData: ImDrawData = ImGui.GetDrawData()): ImDrawDataView {
+    const buffer = Mod.export.HEAPU8.buffer;
+    const ptr = Mod.export.get_draw_data_layout(drawData.ptr);
+    const layout = new Int32Array(buffer, ptr);
+    const floats = new Float32Array(buffer, ptr);
+
+    const count = layout[0];
+    const cmdLists: ImDrawListView[] = [];
+
+    for (let i = 0; i < count; i++) {
+      const o = 9 + i * 7;
+      const [vtxPtr, vtxCount, idxPtr, idxCount, cmdOffset, cmdCount, changed] = layout.subarray(
+        o,
+        o + 7,
+      );
+      const cmdEnd = cmdOffset + cmdCount * IMDRAWCMD_STRIDE;
+
+      cmdLists.push({
+        VtxBuffer: new Float32Array(buffer, vtxPtr, vtxCount * 5),
+        VtxBytes: new Uint8Array(buffer, vtxPtr, vtxCount * 20),
+        IdxBuffer: new Uint16Array(buffer, idxPtr, idxCount),
+        CmdBuffer: layout.subarray(cmdOffset, cmdEnd),
+        CmdFloats: floats.subarray(cmdOffset, cmdEnd),
+        Changed: changed !== 0,
+      });
+    }
+
+    return {
+      TotalVtxCount: layout[1],
+      TotalIdxCount: layout[2],
+      DisplayPos: new ImVec2(floats[3], floats[4]),
+      DisplaySize: new ImVec2(floats[5], floats[6]),
+      FramebufferScale: new ImVec2(floats[7], floats[8]),
+      CmdLists: cmdLists,
+    };
+  },
+
+  /**
+   * Like {@linkcode ImGuiImplWeb.GetDrawDataView}, but with all draw lists merged into one vertex
+   * and one index buffer, so the geometry of a frame is uploaded with a single call each. The
+   * buffers are copied natively into reused memory, the views are valid until the next call.
+   *
+   * @param drawData The draw data, defaults to `ImGui.GetDrawData()`.
+   */
+  GetMergedDrawDataView(drawData: ImDrawData = ImGui.GetDrawData()): ImMergedDrawDataView {
+    const buffer = Mod.export.HEAPU8.buffer;
+    const ptr = Mod.export.get_merged_draw_data(drawData.ptr);
+    const layout = new Int32Array(buffer, ptr);
+    const floats = new Float32Array(buffer, ptr);
+
+    const [vtxPtr, idxPtr, cmdCount] = layout.subarray(9, 12);
+    const cmdEnd = 12 + cmdCount * IMDRAWCMD_STRIDE;
+
+    return {
+      TotalVtxCount: layout[1],
+      TotalIdxCount: layout[2],
+      DisplayPos: new ImVec2(floats[3], floats[4]),
+      DisplaySize: new ImVec2(floats[5], floats[6]),
+      FramebufferScale: new ImVec2(floats[7], floats[8]),
+      VtxBuffer: new Float32Array(buffer, vtxPtr, layout[1] * 5),
+      VtxBytes: new Uint8Array(buffer, vtxPtr, layout[1] * 20),
+      IdxBuffer: new Uint16Array(buffer, idxPtr, layout[2]),
+      CmdBuffer: layout.subarray(12, cmdEnd),
+      CmdFloats: floats.subarray(12, cmdEnd),
+      Changed: Mod.export.draw_data_changed(),
     };
   },
 
+  /**
+   * Interns a string in the WASM heap and returns its handle. The native string lives as long as
+   * the module, so only intern constant strings like labels, not changing text.
+   *
+   * The handle can be passed to `ImGui` functions instead of the string, e.g.
+   * `ImGui.Button(handle)`, which skips the UTF-8 conversion and allocation of the string on every
+   * call. Functions taking several strings only skip the conversion if all of them are handles or
+   * keep their default value, mixed calls resolve the handles and pass strings.
+   *
+   * @param str The string to intern.
+   * @returns The handle of the interned string.
+   */
+  Intern(str: string): ImStrHandle {
+    let handle = State.internedStrings.get(str);
+    if (handle === undefined) {
+      handle = Mod.export.InternString(str) as number;
+      State.internedStrings.set(str, handle);
+      State.internedHandles[handle] = str;
+    }
+    return handle;
+  },
+
   /**
    * Set the callback for saving the Dear ImGui ini settings. The ini settings will be passed as
    * string to the callback.
@@ -982,11 +3552,29 @@ export const ImGuiImplWeb = {
    * Begins a new ImGui frame. Call this at the beginning of your render loop.
    */
   BeginRender() {
-    setDisplayProperties(State.canvas as HTMLCanvasElement);
+    const io = ImGuiImplWeb.GetIOFields();
+
+    if (State.inputQueue) {
+      const [width, height] = State.inputQueue.getDisplaySize();
+      State.inputQueue.drain(State.inputRing as InputRingBuffer);
+      io.Set(IOField.DisplayWidth, width);
+      io.Set(IOField.DisplayHeight, height);
+
+      // The OffscreenCanvas isn't laid out, so it follows the size of its element.
+      const canvas = State.canvas as OffscreenCanvas;
+      if (canvas.width !== width || canvas.height !== height) {
+        canvas.width = width;
+        canvas.height = height;
+      }
+    } else if (State.canvas) {
+      setDisplayProperties(State.canvas as HTMLCanvasElement);
+    }
 
-    if (ImGui.GetIO().WantSaveIniSettings) {
+    State.inputRing?.drain();
+
+    if (io.Get(IOField.WantSaveIniSettings)) {
       State.saveIniSettingsFn?.(ImGui.SaveIniSettingsToMemory());
-      ImGui.GetIO().WantSaveIniSettings = false;
+      io.Set(IOField.WantSaveIniSettings, 0);
     }
 
     State.beginRenderFn?.();
@@ -1000,10 +3588,212 @@ export const ImGuiImplWeb = {
    * @param passEncoder The WebGPU render pass encoder to use.
    */
   EndRender(passEncoder?: GPURenderPassEncoder) {
+    State.inputQueue?.setFeedback(
+      ImGui.GetMouseCursor(),
+      ImGuiImplWeb.GetIOFields().Get(IOField.WantTextInput) !== 0,
+    );
     ImGui.Render();
     State.endRenderFn?.(passEncoder);
   },
 
+  /**
+   * Whether the draw data of the last {@linkcode ImGuiImplWeb.EndRender} differs from the last
+   * frame this was asked for (or a draw data view was taken). Always `true` unless
+   * {@linkcode InitOptions.diffDrawData} is enabled.
+   */
+  DrawDataChanged(): boolean {
+    return Mod.export.draw_data_changed();
+  },
+
+  /**
+   * Requests a new frame from the loop started with {@linkcode ImGuiImplWeb.RunLazy}. Call this
+   * when the state shown in the UI changed outside of Dear ImGui, e.g. after receiving new data.
+   */
+  Invalidate(): void {
+    State.wakeFn?.();
+  },
+
+  /**
+   * Runs a render loop which only renders frames while something happens. After a frame in which
+   * nothing changed and nothing animates, the loop sleeps until an input event arrives,
+   * {@linkcode ImGuiImplWeb.Invalidate} is called or `maxIdleMs` elapsed. This enables
+   * {@linkcode InitOptions.diffDrawData} to find such frames, every frame that runs still renders
+   * in full, so the frame callback may clear the canvas.
+   *
+   * ```js
+   * const stop = ImGuiImplWeb.RunLazy(() => {
+   *     ImGuiImplWeb.BeginRender();
+   *     ImGui.Text(`Time: ${Date.now()}`);
+   *     ImGuiImplWeb.EndRender();
+   * });
+   * ```
+   *
+   * @param frameFn The frame callback, calling {@linkcode ImGuiImplWeb.BeginRender} and
+   * {@linkcode ImGuiImplWeb.EndRender}.
+   * @param maxIdleMs The longest time without a frame, for UIs showing timers or polled data.
+   * @returns A function stopping the loop.
+   */
+  RunLazy(frameFn: () => void, maxIdleMs = 1000): () => void {
+    Mod.export.set_draw_data_diffing(true);
+
+    let stopped = false;
+    let scheduled = false;
+    let idleTimer: ReturnType<typeof setTimeout> | undefined;
+
+    const schedule = () => {
+      if (stopped || scheduled) return;
+
+      scheduled = true;
+      clearTimeout(idleTimer);
+      State.inputQueue?.markBusy();
+      requestAnimationFrame(frame);
+    };
+
+    const frame = () => {
+      scheduled = false;
+      if (stopped) return;
+
+      frameFn();
+
+      if (Mod.export.needs_redraw()) {
+        schedule();
+      } else if (State.inputQueue?.markIdle()) {
+        // Input arrived in the worker after this frame drained the queue.
+        schedule();
+      } else {
+        idleTimer = setTimeout(schedule, maxIdleMs);
+      }
+    };
+
+    State.wakeFn = schedule;
+    schedule();
+
+    return () => {
+      stopped = true;
+      clearTimeout(idleTimer);
+      if (State.wakeFn === schedule) State.wakeFn = null;
+    };
+  },
+
+  /**
+   * Moves Dear ImGui to a worker, so building the UI doesn't compete with the main thread. The
+   * canvas is transferred to the worker as `OffscreenCanvas`, while its input events stay on the
+   * main thread and are forwarded through an {@linkcode InputEventQueue} in shared memory. The
+   * worker calls {@linkcode ImGuiImplWeb.InitInWorker} and runs the frames.
+   *
+   * Shared memory requires the page to be cross-origin isolated (COOP/COEP headers).
+   *
+   * @example
+   * ```ts
+   * // main.js
+   * const worker = new Worker(new URL("./worker.js", import.meta.url), { type: "module" });
+   * const { stop } = ImGuiImplWeb.StartWorker(canvas, worker);
+   *
+   * // worker.js
+   * await ImGuiImplWeb.InitInWorker({ backend: "webgl2" });
+   * const frame = () => {
+   *     ImGuiImplWeb.BeginRender();
+   *     ImGui.Text("Hello from a worker");
+   *     ImGuiImplWeb.EndRender();
+   *     requestAnimationFrame(frame);
+   * };
+   * requestAnimationFrame(frame);
+   * ```
+   *
+   * @param canvas The canvas element to render Dear ImGui on.
+   * @param worker The worker running Dear ImGui.
+   * @param queueCapacity The number of input events the queue holds, a power of two.
+   * @returns The input queue, e.g. to check for dropped events, and a function removing the
+   * listeners of the main thread, e.g. before terminating the worker.
+   */
+  StartWorker(
+    canvas: HTMLCanvasElement,
+    worker: Worker,
+    queueCapacity = 1024,
+  ): { queue: InputEventQueue; stop: () => void } {
+    const queue = new InputEventQueue(queueCapacity);
+    const controller = new AbortController();
+    const { signal } = controller;
+
+    const wake = () => {
+      if (queue.claimWake()) worker.postMessage({ type: "jsimgui:wake" });
+    };
+
+    const resize = () => {
+      queue.setDisplaySize(Math.floor(canvas.clientWidth), Math.floor(canvas.clientHeight));
+      wake();
+    };
+    resize();
+    const resizeObserver = new ResizeObserver(resize);
+    resizeObserver.observe(canvas);
+
+    setupCanvasInput(canvas, queue, queue, wake, signal);
+
+    document.addEventListener(
+      "paste",
+      (e) => {
+        const text = e.clipboardData?.getData("text/plain") ?? "";
+        worker.postMessage({ type: "jsimgui:paste", text });
+      },
+      { signal },
+    );
+    worker.addEventListener(
+      "message",
+      (e) => {
+        if (e.data?.type === "jsimgui:copy") {
+          navigator.clipboard.writeText(e.data.text);
+        }
+      },
+      { signal },
+    );
+
+    const offscreen = canvas.transferControlToOffscreen();
+    worker.postMessage({ type: "jsimgui:init", canvas: offscreen, queue: queue.buffer }, [
+      offscreen,
+    ]);
+
+    const stop = () => {
+      controller.abort();
+      resizeObserver.disconnect();
+    };
+    return { queue, stop };
+  },
+
+  /**
+   * Initializes Dear ImGui in a worker started with {@linkcode ImGuiImplWeb.StartWorker}. Waits
+   * for the canvas and input queue from the main thread and then calls
+   * {@linkcode ImGuiImplWeb.Init}. Any loader runs in a worker, the input queue is shared on its
+   * own and doesn't need the pthreads loader (`build.ts --pthread`).
+   *
+   * @param options The initialization options, the canvas comes from the main thread.
+   */
+  async InitInWorker(options: Omit<InitOptions, "canvas"> = {}): Promise<void> {
+    const { canvas, queue } = await new Promise<{
+      canvas: OffscreenCanvas;
+      queue: SharedArrayBuffer;
+    }>((resolve) => {
+      const onInit = (e: MessageEvent) => {
+        if (e.data?.type !== "jsimgui:init") return;
+
+        globalThis.removeEventListener("message", onInit);
+        resolve(e.data);
+      };
+      globalThis.addEventListener("message", onInit);
+    });
+
+    globalThis.addEventListener("message", (e: MessageEvent) => {
+      if (e.data?.type === "jsimgui:wake") {
+        State.wakeFn?.();
+      } else if (e.data?.type === "jsimgui:paste") {
+        State.clipboardData = e.data.text;
+      }
+    });
+
+    State.inputQueue = new InputEventQueue(queue);
+
+    await ImGuiImplWeb.Init({ backend: "webgl2", ...options, canvas });
+  },
+
   /**
    * Initialize Dear ImGui with the specified configuration. This is asynchronous because it
    * waits for the WASM file to be loaded.
@@ -1018,23 +3808,70 @@ export const ImGuiImplWeb = {
       fontLoader = "truetype",
       loaderPath,
       extensions = false,
+      split = false,
+      wasm = false,
+      simd = false,
+      pthread = false,
+      wasmCache,
+      enableDemos = false,
+      diffDrawData = false,
+      displaySize = new ImVec2(1280, 720),
     } = options;
 
-    const usedBackend = getUsedBackend(canvas, device, backend);
+    if (!canvas && backend && backend !== "null") {
+      throw new Error(`jsimgui: The ${backend} backend requires a canvas.`);
+    }
+
+    const usedBackend = canvas ? getUsedBackend(canvas, device, backend) : "null";
     State.backend = usedBackend;
 
-    await Mod.init(fontLoader === "freetype", extensions, loaderPath);
+    const variant = {
+      freetype: fontLoader === "freetype",
+      extensions,
+      node: isNode(),
+      split,
+      wasm,
+      simd,
+      pthread,
+    };
+    await Mod.init(variant, loaderPath, wasmCache);
+
+    const modules: SideModule[] = [];
+    if (usedBackend === "webgl" || usedBackend === "webgl2") modules.push("opengl3");
+    if (usedBackend === "webgpu") modules.push("wgpu");
+    if (extensions) modules.push("imnodes");
+    if (enableDemos) modules.push("demo");
+    await Mod.loadModules(modules);
 
     Mod.export.FS.mount(Mod.export.MEMFS, { root: "." }, ".");
 
     ImGui.CreateContext();
-    setupBrowserIO(canvas);
+
+    if (State.inputQueue) {
+      setupWorkerIO();
+    } else if (canvas) {
+      setupBrowserIO(canvas as HTMLCanvasElement);
+    } else {
+      ImGui.GetIO().DisplaySize = displaySize;
+      Mod.export.SetupIniSettings();
+    }
+
+    Mod.export.set_draw_data_diffing(diffDrawData);
 
     if (State.loadIniSettingsFn) {
       const iniData = State.loadIniSettingsFn() || "";
       ImGui.LoadIniSettingsFromMemory(iniData, iniData.length);
     }
 
+    if (usedBackend === "null") {
+      initNull(canvas);
+      return;
+    }
+
+    if (!canvas) {
+      return;
+    }
+
     if (usedBackend === "webgl" || usedBackend === "webgl2") {
       initWebGL(canvas);
       return;
@@ -98,14 +98,14 @@ function getValueStructsCpp(): string {
   ].join("\n");
 }
 
-export function generateImGuiBindings(): void {
+export function generateImGuiBindings(instrument = false): void {
   const configFile = readFileSync("./src/imgui/config.json", "utf-8");
   const dataFile = readFileSync("./src/imgui/data/dcimgui.json", "utf-8");
 
   const config = JSON.parse(configFile) as GeneratorConfig;
   const data = filterData(JSON.parse(dataFile), true, true) as DearBindingsData;
 
-  const context: GeneratorContext = { config };
+  const context: GeneratorContext = { config, instrument };
 
   const typedefs = mapTypedefs(data.typedefs);
   const enums = mapEnums(data.enums);
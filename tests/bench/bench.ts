@@ -0,0 +1,371 @@
+/**
+ * Frame-time benchmark running fixed synthetic scenes headless through the null backend.
+ *
+ * Requires a Node.js loader built with `node build.ts --node` (with `--extensions` for the imnodes
+ * scene, which also needs `--extensions` here) and reports per scene as JSON:
+ * - `nsPerFrame`: mean, median and 95th percentile of the frame time.
+ * - `embindCallsPerFrame`: calls crossing the JS/WASM boundary, counted in a separate frame.
+ * - `mallocsPerFrame`: heap allocations of Dear ImGui and the bindings, only with
+ *   `node build.ts --instrument`.
+ * - `heapHighWater`: the peak of the live heap bytes (only with `--instrument`) and the final WASM
+ *   heap size.
+ * - `hottestBindings`: the bindings taking the most time, only with `node build.ts --instrument`.
+ *
+ * Usage: node tests/bench/bench.ts [--frames=600] [--warmup=60] [--scene=<name>] [--extensions]
+ *        [--simd] [--out=<file>]
+ *
+ * `--simd` loads a `node build.ts --node --simd` loader, compare its report with a scalar run.
+ */
+
+import { writeFileSync } from "node:fs";
+import { argv, stdout } from "node:process";
+import {
+  ColumnTable,
+  HeapArray,
+  ImGui,
+  ImGuiImplWeb,
+  ImGuiListClipper,
+  ImVec2,
+  LogBuffer,
+  TableColumnType,
+} from "../../build/imgui.js";
+
+interface Scene {
+  name: string;
+  extensions?: boolean;
+  setup?: () => void;
+  frame: () => void;
+  teardown?: () => void;
+}
+
+const args = Object.fromEntries(
+  argv
+    .slice(2)
+    .filter((arg) => arg.startsWith("--"))
+    .map((arg) => {
+      const [key, value = "true"] = arg.slice(2).split("=");
+      return [key, value];
+    }),
+);
+
+const frames = Number(args.frames ?? 600);
+const warmup = Number(args.warmup ?? 60);
+
+// biome-ignore lint/suspicious/noExplicitAny: _
+let exports: any = null;
+
+const windowPos = new ImVec2(0, 0);
+const windowSize = new ImVec2(1280, 720);
+
+const beginWindow = (name: string) => {
+  ImGui.SetNextWindowPos(windowPos);
+  ImGui.SetNextWindowSize(windowSize);
+  ImGui.Begin(name);
+};
+
+const TEXT_LINES = 10_000;
+const TABLE_ROWS = 1_000;
+const COLUMN_TABLE_ROWS = 100_000;
+const LOG_LINES_PER_FRAME = 1_700;
+const SLIDERS = 500;
+const NODES = 200;
+
+const sliderValues = Array.from({ length: SLIDERS }, (_, i): [number] => [i / SLIDERS]);
+let clipper: ImGuiListClipper | null = null;
+let columnTable: ColumnTable | null = null;
+let columnIds: HeapArray<Int32Array> | null = null;
+let columnNames: HeapArray<Int32Array> | null = null;
+let columnValues: HeapArray<Float64Array> | null = null;
+let log: LogBuffer | null = null;
+let logLines = "";
+let nodesContext: unknown = null;
+
+const scenes: Scene[] = [
+  {
+    name: "text-10k",
+    frame: () => {
+      beginWindow("Text");
+      for (let i = 0; i < TEXT_LINES; i++) {
+        ImGui.Text(`Line ${i}`);
+      }
+      ImGui.End();
+    },
+  },
+  {
+    name: "table-clipper-1k",
+    setup: () => {
+      clipper = ImGuiListClipper.New();
+    },
+    frame: () => {
+      beginWindow("Table");
+      const flags = ImGui.TableFlags.ScrollY | ImGui.TableFlags.RowBg | ImGui.TableFlags.BordersV;
+      if (ImGui.BeginTable("rows", 3, flags)) {
+        clipper!.Begin(TABLE_ROWS);
+        while (clipper!.Step()) {
+          for (let row = clipper!.DisplayStart; row < clipper!.DisplayEnd; row++) {
+            ImGui.TableNextRow();
+            ImGui.TableSetColumnIndex(0);
+            ImGui.Text(`${row}`);
+            ImGui.TableSetColumnIndex(1);
+            ImGui.Text(`Item ${row}`);
+            ImGui.TableSetColumnIndex(2);
+            ImGui.Text(`${(row * 0.5).toFixed(1)}`);
+          }
+        }
+        ImGui.EndTable();
+      }
+      ImGui.End();
+    },
+    teardown: () => {
+      clipper?.Drop();
+      clipper = null;
+    },
+  },
+  {
+    name: "column-table-100k",
+    setup: () => {
+      columnIds = HeapArray.New<Int32Array>(Int32Array, COLUMN_TABLE_ROWS);
+      columnNames = HeapArray.New<Int32Array>(Int32Array, COLUMN_TABLE_ROWS);
+      columnValues = HeapArray.New<Float64Array>(Float64Array, COLUMN_TABLE_ROWS);
+      for (let row = 0; row < COLUMN_TABLE_ROWS; row++) {
+        columnIds.view[row] = row;
+        columnNames.view[row] = row % 3;
+        columnValues.view[row] = row * 0.5;
+      }
+
+      columnTable = ColumnTable.New([
+        { label: "Id", type: TableColumnType.Int32 },
+        { label: "Name", type: TableColumnType.String },
+        { label: "Value", type: TableColumnType.Float64, format: "%.1f" },
+      ]);
+      columnTable.SetColumn(0, columnIds);
+      columnTable.SetStringColumn(1, columnNames, ["Item A", "Item B", "Item C"]);
+      columnTable.SetColumn(2, columnValues);
+      columnTable.Rows = COLUMN_TABLE_ROWS;
+    },
+    frame: () => {
+      beginWindow("Column table");
+      columnTable!.Render("rows");
+      ImGui.End();
+    },
+    teardown: () => {
+      columnTable?.Drop();
+      columnIds?.Drop();
+      columnNames?.Drop();
+      columnValues?.Drop();
+      columnTable = null;
+      columnIds = null;
+      columnNames = null;
+      columnValues = null;
+    },
+  },
+  {
+    // 1.7k lines per frame at 60 fps is ~100k lines per second.
+    name: "log-100k-per-second",
+    setup: () => {
+      log = LogBuffer.New();
+      logLines = Array.from(
+        { length: LOG_LINES_PER_FRAME },
+        (_, i) => `[info] request ${i} handled in ${i % 97} ms\n`,
+      ).join("");
+    },
+    frame: () => {
+      log!.Append(logLines);
+      beginWindow("Log");
+      log!.Render("lines");
+      ImGui.End();
+    },
+    teardown: () => {
+      log?.Drop();
+      log = null;
+      logLines = "";
+    },
+  },
+  {
+    name: "sliders-500",
+    frame: () => {
+      beginWindow("Sliders");
+      for (let i = 0; i < SLIDERS; i++) {
+        ImGui.SliderFloat(`Slider ${i}`, sliderValues[i], 0, 1);
+      }
+      ImGui.End();
+    },
+  },
+  {
+    name: "imnodes-200",
+    extensions: true,
+    setup: () => {
+      nodesContext = exports.ImNodes_CreateContext();
+      for (let id = 0; id < NODES; id++) {
+        const pos = new ImVec2((id % 20) * 160, Math.floor(id / 20) * 120);
+        exports.ImNodes_SetNodeEditorSpacePos(id, pos);
+      }
+    },
+    frame: () => {
+      beginWindow("Nodes");
+      exports.ImNodes_BeginNodeEditor();
+      for (let id = 0; id < NODES; id++) {
+        exports.ImNodes_BeginNode(id);
+        exports.ImNodes_BeginNodeTitleBar();
+        ImGui.Text(`Node ${id}`);
+        exports.ImNodes_EndNodeTitleBar();
+        exports.ImNodes_BeginInputAttribute(id * 2, 1);
+        ImGui.Text("in");
+        exports.ImNodes_EndInputAttribute();
+        exports.ImNodes_BeginOutputAttribute(id * 2 + 1, 1);
+        ImGui.Text("out");
+        exports.ImNodes_EndOutputAttribute();
+        exports.ImNodes_EndNode();
+      }
+      for (let id = 1; id < NODES; id++) {
+        exports.ImNodes_Link(id, (id - 1) * 2 + 1, id * 2);
+      }
+      exports.ImNodes_EndNodeEditor();
+      ImGui.End();
+    },
+    teardown: () => {
+      exports.ImNodes_DestroyContext(nodesContext);
+      nodesContext = null;
+    },
+  },
+  {
+    name: "demo-window",
+    frame: () => {
+      ImGui.ShowDemoWindow();
+    },
+  },
+];
+
+/**
+ * Replaces the functions of the emscripten exports and the methods and accessors of the embind
+ * classes with counting wrappers. Returns the counter and a function restoring the originals.
+ */
+const countEmbindCalls = (): { calls: { count: number }; restore: () => void } => {
+  const calls = { count: 0 };
+  const restores: (() => void)[] = [];
+
+  // biome-ignore lint/suspicious/noExplicitAny: _
+  const wrap = (fn: any) =>
+    // biome-ignore lint/suspicious/noExplicitAny: _
+    function (this: any, ...fnArgs: any[]) {
+      calls.count++;
+      return fn.apply(this, fnArgs);
+    };
+
+  for (const key of Object.keys(exports)) {
+    const value = exports[key];
+    if (typeof value !== "function") continue;
+
+    const proto = value.prototype;
+    const members = proto
+      ? Object.getOwnPropertyNames(proto).filter((member) => member !== "constructor")
+      : [];
+
+    // Free functions are wrapped directly, embind classes through their prototype.
+    if (members.length === 0) {
+      exports[key] = wrap(value);
+      restores.push(() => {
+        exports[key] = value;
+      });
+      continue;
+    }
+
+    for (const member of members) {
+      const desc = Object.getOwnPropertyDescriptor(proto, member)!;
+      if (!desc.configurable) continue;
+
+      Object.defineProperty(proto, member, {
+        ...desc,
+        ...(typeof desc.value === "function" ? { value: wrap(desc.value) } : {}),
+        ...(desc.get ? { get: wrap(desc.get) } : {}),
+        ...(desc.set ? { set: wrap(desc.set) } : {}),
+      });
+      restores.push(() => Object.defineProperty(proto, member, desc));
+    }
+  }
+
+  return { calls, restore: () => restores.forEach((restore) => restore()) };
+};
+
+const percentile = (sorted: number[], p: number) =>
+  sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))];
+
+const runFrame = (scene: Scene) => {
+  ImGuiImplWeb.BeginRender();
+  scene.frame();
+  ImGuiImplWeb.EndRender();
+};
+
+const runScene = (scene: Scene) => {
+  if (scene.extensions && typeof exports.ImNodes_CreateContext !== "function") {
+    return { scene: scene.name, skipped: "loader was built without the imnodes bindings" };
+  }
+
+  scene.setup?.();
+
+  for (let i = 0; i < warmup; i++) {
+    runFrame(scene);
+  }
+
+  ImGuiImplWeb.ResetMemoryPeak();
+  const before = ImGuiImplWeb.GetMemoryInfo();
+
+  const times = new Array<number>(frames);
+  for (let i = 0; i < frames; i++) {
+    const start = performance.now();
+    runFrame(scene);
+    times[i] = (performance.now() - start) * 1e6;
+  }
+
+  const memory = ImGuiImplWeb.GetMemoryInfo();
+
+  // The counting wrappers and binding timers slow down every call, so calls are counted and
+  // timed in a separate frame.
+  ImGuiImplWeb.ResetBindingStats();
+  ImGuiImplWeb.SetBindingTiming(true);
+  const { calls, restore } = countEmbindCalls();
+  try {
+    runFrame(scene);
+  } finally {
+    restore();
+    ImGuiImplWeb.SetBindingTiming(false);
+  }
+
+  scene.teardown?.();
+
+  const sorted = [...times].sort((a, b) => a - b);
+  return {
+    scene: scene.name,
+    frames,
+    nsPerFrame: {
+      mean: Math.round(times.reduce((sum, t) => sum + t, 0) / frames),
+      p50: Math.round(percentile(sorted, 0.5)),
+      p95: Math.round(percentile(sorted, 0.95)),
+    },
+    embindCallsPerFrame: calls.count,
+    hottestBindings: ImGuiImplWeb.GetBindingStats(10),
+    mallocsPerFrame: memory.alloc.counted
+      ? (memory.alloc.allocs - before.alloc.allocs + memory.arena.mallocs - before.arena.mallocs) /
+        frames
+      : null,
+    heapHighWater: {
+      liveBytes: memory.alloc.counted ? memory.alloc.peak : null,
+      heapSize: memory.heap.size,
+    },
+  };
+};
+
+const simd = args.simd === "true";
+await ImGuiImplWeb.Init({ extensions: args.extensions === "true", simd });
+exports = ImGuiImplWeb.GetEmscriptenExports();
+
+const results = scenes
+  .filter((scene) => !args.scene || scene.name === args.scene)
+  .map((scene) => runScene(scene));
+
+const report = JSON.stringify({ warmup, simd, results }, null, 2);
+if (args.out) {
+  writeFileSync(args.out, `${report}\n`);
+} else {
+  stdout.write(`${report}\n`);
+}
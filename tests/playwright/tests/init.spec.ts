@@ -1,9 +1,10 @@
-import { expect, test } from "@playwright/test";
+import { expect, type Page, test } from "@playwright/test";
 
 const backends = [
   { name: "WebGL", file: "webgl.html" },
   { name: "WebGL2", file: "webgl2.html" },
   { name: "WebGPU", file: "webgpu.html" },
+  { name: "Null", file: "null.html" },
 ] as const;
 
 backends.forEach((backend) => {
@@ -17,3 +18,95 @@ backends.forEach((backend) => {
     ).toBeTruthy();
   });
 });
+
+// Needs `node build.ts --split` and `node build.ts --split --simd`, whose side modules differ.
+["", "?simd"].forEach((query) => {
+  test(`Init split${query && " SIMD"}`, async ({ page }) => {
+    await page.goto(`tests/playwright/tests/split.html${query}`);
+
+    expect(
+      await page.waitForEvent("console", {
+        predicate: (msg) => msg.text().includes("render complete"),
+      }),
+    ).toBeTruthy();
+  });
+});
+
+test("RunLazy keeps drawing while the mouse is held on an unchanged UI", async ({ page }) => {
+  await page.goto("tests/playwright/tests/lazy.html");
+  await page.waitForEvent("console", {
+    predicate: (msg) => msg.text().startsWith("lazy frame"),
+  });
+
+  // Hold the mouse on the window body, the draw data stays the same while frames keep coming.
+  await page.mouse.move(100, 100);
+  await page.mouse.down();
+
+  const frames: string[] = [];
+  while (frames.length < 10) {
+    const msg = await page.waitForEvent("console", {
+      predicate: (msg) => msg.text().startsWith("lazy frame"),
+    });
+    frames.push(msg.text());
+  }
+
+  await page.mouse.up();
+
+  expect(frames.every((frame) => frame === "lazy frame drawn")).toBeTruthy();
+});
+
+const pageResult = async (page: Page, file: string, name: string) => {
+  await page.goto(`tests/playwright/tests/${file}`);
+  const msg = await page.waitForEvent("console", {
+    predicate: (msg) => msg.text().startsWith(`${name} result `),
+  });
+  return JSON.parse(msg.text().slice(`${name} result `.length));
+};
+
+test("TextFilterIndex matches ImGuiTextFilter.PassFilter", async ({ page }) => {
+  const results: { filter: string; index: number[]; imgui: number[] }[] = await pageResult(
+    page,
+    "filter.html",
+    "filter",
+  );
+
+  for (const { filter, index, imgui } of results) {
+    expect(index, `filter "${filter}"`).toEqual(imgui);
+  }
+
+  const matches = Object.fromEntries(results.map(({ filter, index }) => [filter, index]));
+  expect(matches[""]).toEqual([0, 1, 2, 3, 4, 5, 6, 7]);
+  expect(matches.APPLE).toEqual([0, 1, 3]);
+  expect(matches["-apple"]).toEqual([2, 4, 5, 6, 7]);
+  expect(matches[" banana , grape "]).toEqual([2, 4]);
+
+  // The first matching term decides.
+  expect(matches["apple,-pie"]).toEqual([0, 1, 3]);
+  expect(matches["-pie,apple"]).toEqual([1, 3]);
+
+  // "xap" + "plex" and "apple pie" + "Applesauce" don't match across the string boundary.
+  expect(matches.apple).toEqual([0, 1, 3]);
+  expect(matches.eap).toEqual([3]);
+});
+
+test("LogBuffer evicts, compacts and splits lines", async ({ page }) => {
+  const results = await pageResult(page, "log.html", "log");
+
+  expect(results.byLines).toEqual({
+    lines: ["line 996", "line 997", "line 998", "line 999"],
+    bytes: 36,
+  });
+  expect(results.byBytes).toEqual({ lines: ["bbbb", "cccc", "dddd"], bytes: 15 });
+  expect(results.split).toEqual(["ghij"]);
+  expect(results.continued).toEqual(["ghijkl"]);
+  expect(results.utf8).toEqual(["é"]);
+  expect(results.appends).toEqual(["hello", "world"]);
+  expect(results.cleared).toEqual({ lines: 0, bytes: 0 });
+});
+
+test("TableSorter sorts NaN last and keeps the order of ties", async ({ page }) => {
+  const results = await pageResult(page, "sort.html", "sort");
+
+  expect(results.ascending).toEqual([2, 4, 5, 0, 1, 3, 6]);
+  expect(results.descending).toEqual([0, 5, 2, 4, 1, 3, 6]);
+});